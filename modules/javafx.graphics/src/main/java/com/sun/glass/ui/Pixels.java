@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,11 @@ public abstract class Pixels {
     private final float scalex;
     private final float scaley;
 
+    // The (x, y, width, height) quadruples of the regions that changed since
+    // the previous Pixels presented to the same view; null if all did.
+    private int[] dirtyRects;
+    private int dirtyRectCount;
+
     protected Pixels(final int width, final int height, final ByteBuffer pixels) {
         this(width, height, pixels, 1.0f, 1.0f);
     }
@@ -208,6 +213,40 @@ public abstract class Pixels {
         }
     }
 
+    /**
+     * Records the regions of this {@code Pixels} that differ from the
+     * previous {@code Pixels} uploaded to the same view. A platform may use
+     * them to present only the changed parts of the window.
+     *
+     * @param rects (x, y, width, height) quadruples in pixels, or null if
+     * the entire image needs to be presented
+     * @param count the number of rectangles in {@code rects}
+     */
+    public final void setDirtyRects(int[] rects, int count) {
+        if (rects == null || count <= 0) {
+            this.dirtyRectCount = 0;
+            return;
+        }
+        if (this.dirtyRects == null || this.dirtyRects.length < 4 * count) {
+            this.dirtyRects = new int[4 * count];
+        }
+        System.arraycopy(rects, 0, this.dirtyRects, 0, 4 * count);
+        this.dirtyRectCount = count;
+    }
+
+    /**
+     * Returns the rectangles recorded by {@link #setDirtyRects}.
+     *
+     * @return the dirty rectangles, or null if the entire image is dirty
+     */
+    public final int[] getDirtyRects() {
+        return this.dirtyRectCount > 0 ? this.dirtyRects : null;
+    }
+
+    public final int getDirtyRectCount() {
+        return this.dirtyRectCount;
+    }
+
     /*
      * Return a copy of pixels as bytes.
      */
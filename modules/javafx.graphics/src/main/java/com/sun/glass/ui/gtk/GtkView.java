@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,24 +86,26 @@ final class GtkView extends View {
     @Override
     protected void _uploadPixels(long ptr, Pixels pixels) {
         Buffer data = pixels.getPixels();
+        int[] rects = pixels.getDirtyRects();
+        int rectCount = pixels.getDirtyRectCount();
         if (data.isDirect() == true) {
-            _uploadPixelsDirect(ptr, data, pixels.getWidth(), pixels.getHeight());
+            _uploadPixelsDirect(ptr, data, pixels.getWidth(), pixels.getHeight(), rects, rectCount);
         } else if (data.hasArray() == true) {
             if (pixels.getBytesPerComponent() == 1) {
                 ByteBuffer bytes = (ByteBuffer)data;
-                _uploadPixelsByteArray(ptr, bytes.array(), bytes.arrayOffset(), pixels.getWidth(), pixels.getHeight());
+                _uploadPixelsByteArray(ptr, bytes.array(), bytes.arrayOffset(), pixels.getWidth(), pixels.getHeight(), rects, rectCount);
             } else {
                 IntBuffer ints = (IntBuffer)data;
-                _uploadPixelsIntArray(ptr, ints.array(), ints.arrayOffset(), pixels.getWidth(), pixels.getHeight());
+                _uploadPixelsIntArray(ptr, ints.array(), ints.arrayOffset(), pixels.getWidth(), pixels.getHeight(), rects, rectCount);
             }
         } else {
             // gznote: what are the circumstances under which this can happen?
-            _uploadPixelsDirect(ptr, pixels.asByteBuffer(), pixels.getWidth(), pixels.getHeight());
+            _uploadPixelsDirect(ptr, pixels.asByteBuffer(), pixels.getWidth(), pixels.getHeight(), rects, rectCount);
         }
     }
-    private native void _uploadPixelsDirect(long viewPtr, Buffer pixels, int width, int height);
-    private native void _uploadPixelsByteArray(long viewPtr, byte[] pixels, int offset, int width, int height);
-    private native void _uploadPixelsIntArray(long viewPtr, int[] pixels, int offset, int width, int height);
+    private native void _uploadPixelsDirect(long viewPtr, Buffer pixels, int width, int height, int[] dirtyRects, int dirtyRectCount);
+    private native void _uploadPixelsByteArray(long viewPtr, byte[] pixels, int offset, int width, int height, int[] dirtyRects, int dirtyRectCount);
+    private native void _uploadPixelsIntArray(long viewPtr, int[] pixels, int offset, int width, int height, int[] dirtyRects, int dirtyRectCount);
 
     @Override
     protected native boolean _enterFullscreen(long ptr, boolean animate, boolean keepRatio, boolean hideCursor);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.geom.Path2D;
 import com.sun.javafx.geom.Point2D;
 import com.sun.javafx.geom.Shape;
+import java.util.Arrays;
 
 public class CompositeStrike implements FontStrike {
 
@@ -174,6 +175,31 @@ public class CompositeStrike implements FontStrike {
         return getStrikeSlot(slot).getGlyph(slotglyphCode);
     }
 
+    @Override
+    public void prepareGlyphs(int[] glyphCodes, int count) {
+        /* Hand each slot strike the glyphs it renders, marking the
+         * glyphs already handed over with -1. */
+        int[] codes = Arrays.copyOf(glyphCodes, count);
+        int[] slotCodes = new int[count];
+        int done = 0;
+        while (done < count) {
+            int slot = -1;
+            int slotCount = 0;
+            for (int i = 0; i < count; i++) {
+                int glyphCode = codes[i];
+                if (glyphCode == -1) continue;
+                if (slot == -1) slot = glyphCode >>> 24;
+                if ((glyphCode >>> 24) == slot) {
+                    slotCodes[slotCount++] = glyphCode & CompositeGlyphMapper.GLYPHMASK;
+                    codes[i] = -1;
+                }
+            }
+            if (slot == -1) break;
+            getStrikeSlot(slot).prepareGlyphs(slotCodes, slotCount);
+            done += slotCount;
+        }
+    }
+
      /**
      * Access to individual character advances are frequently needed for layout
      * understand that advance may vary for single glyph if ligatures or kerning
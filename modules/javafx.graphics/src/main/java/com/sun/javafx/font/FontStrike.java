@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,14 @@ public interface FontStrike {
     public Metrics getMetrics();
     public Glyph getGlyph(char symbol);
     public Glyph getGlyph(int glyphCode);
+
+    /**
+     * Hints that the given glyphs are about to be rasterized, allowing the
+     * strike to prepare them together rather than one at a time.
+     * The default implementation does nothing.
+     */
+    public default void prepareGlyphs(int[] glyphCodes, int count) {
+    }
     public void clearDesc(); // for cache management.
     public int getAAMode();
 
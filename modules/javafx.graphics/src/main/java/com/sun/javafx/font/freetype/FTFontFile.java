@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@ import com.sun.javafx.font.PrismFontFile;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
 import com.sun.javafx.geom.transform.BaseTransform;
+import java.nio.ByteBuffer;
 
 class FTFontFile extends PrismFontFile {
     /*
@@ -52,6 +53,13 @@ class FTFontFile extends PrismFontFile {
     private long face;
     private FTDisposer disposer;
 
+    /* Staging area for the glyphs rasterized by initGlyphs() */
+    private static final int BATCH_SIZE = 64;
+    private static final int ATLAS_SIZE = 64 * 1024;
+    private ByteBuffer atlas;
+    private int[] batchCodes;
+    private int[] batchMetrics;
+
     FTFontFile(String name, String filename, int fIndex, boolean register,
                boolean embedded, boolean copy, boolean tracked) throws Exception {
         super(name, filename, fIndex, register, embedded, copy, tracked);
@@ -117,19 +125,13 @@ class FTFontFile extends PrismFontFile {
         return OSFreetype.FT_Outline_Decompose(face);
     }
 
-    synchronized void initGlyph(FTGlyph glyph, FTFontStrike strike) {
-        float size = strike.getSize();
-        if (size == 0) {
-            glyph.buffer = new byte[0];
-            glyph.bitmap = new FT_Bitmap();
-            return;
-        }
-        int size26dot6 = (int)(size * 64);
+    /* Sets the face up for rendering the glyphs of the strike and returns
+     * the FT_Load_Glyph flags to use.
+     */
+    private int prepareLoadGlyph(FTFontStrike strike, boolean lcd) {
+        int size26dot6 = (int)(strike.getSize() * 64);
         OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
 
-        boolean lcd = strike.getAAMode() == FontResource.AA_LCD &&
-                      FTFactory.LCD_SUPPORT;
-
         int flags = OSFreetype.FT_LOAD_RENDER | OSFreetype.FT_LOAD_NO_HINTING | OSFreetype.FT_LOAD_NO_BITMAP;
         FT_Matrix matrix = strike.matrix;
         if (matrix != null) {
@@ -142,6 +144,115 @@ class FTFontFile extends PrismFontFile {
         } else {
             flags |= OSFreetype.FT_LOAD_TARGET_NORMAL;
         }
+        return flags;
+    }
+
+    /* Initializes the glyphs with one native call per batch instead of
+     * several calls and allocations per glyph.
+     */
+    synchronized void initGlyphs(FTGlyph[] glyphs, int count, FTFontStrike strike) {
+        if (strike.getSize() == 0) {
+            for (int i = 0; i < count; i++) {
+                initGlyph(glyphs[i], strike);
+            }
+            return;
+        }
+        boolean lcd = strike.getAAMode() == FontResource.AA_LCD &&
+                      FTFactory.LCD_SUPPORT;
+        int flags = prepareLoadGlyph(strike, lcd);
+
+        if (atlas == null) {
+            atlas = ByteBuffer.allocateDirect(ATLAS_SIZE);
+            batchCodes = new int[BATCH_SIZE];
+            batchMetrics = new int[BATCH_SIZE * OSFreetype.GLYPH_METRICS_SIZE];
+        }
+        int start = 0;
+        while (start < count) {
+            int batchCount = Math.min(BATCH_SIZE, count - start);
+            for (int i = 0; i < batchCount; i++) {
+                batchCodes[i] = glyphs[start + i].getGlyphCode();
+            }
+            int done = OSFreetype.rasterizeGlyphs(face, batchCodes, batchCount,
+                                                  flags, atlas, batchMetrics);
+            if (done <= 0) break;
+            for (int i = 0; i < done; i++) {
+                FTGlyph glyph = glyphs[start + i];
+                if (!setGlyph(glyph, i * OSFreetype.GLYPH_METRICS_SIZE, flags, lcd)) {
+                    /* The bitmap does not fit in the atlas */
+                    initGlyph(glyph, strike);
+                }
+            }
+            start += done;
+        }
+        for (int i = start; i < count; i++) {
+            initGlyph(glyphs[i], strike);
+        }
+    }
+
+    /* Initializes the glyph from the output of rasterizeGlyphs().
+     * Returns false if the glyph has to be rendered on its own.
+     */
+    private boolean setGlyph(FTGlyph glyph, int m, int flags, boolean lcd) {
+        int glyphCode = glyph.getGlyphCode();
+        int error = batchMetrics[m + OSFreetype.GLYPH_METRICS_ERROR];
+        if (error != 0) {
+            if (PrismFontFactory.debugFonts) {
+                System.err.println("FT_Load_Glyph failed " + error +
+                                   " glyph code " + glyphCode +
+                                   " load falgs " + flags);
+            }
+            return true;
+        }
+        int pixelMode = batchMetrics[m + OSFreetype.GLYPH_METRICS_PIXEL_MODE];
+        if (pixelMode != OSFreetype.FT_PIXEL_MODE_GRAY && pixelMode != OSFreetype.FT_PIXEL_MODE_LCD) {
+            /* See initGlyph() */
+            if (PrismFontFactory.debugFonts) {
+                System.err.println("Unexpected pixel mode: " + pixelMode +
+                                   " glyph code " + glyphCode +
+                                   " load falgs " + flags);
+            }
+            return true;
+        }
+        int width = batchMetrics[m + OSFreetype.GLYPH_METRICS_WIDTH];
+        int height = batchMetrics[m + OSFreetype.GLYPH_METRICS_HEIGHT];
+        int offset = batchMetrics[m + OSFreetype.GLYPH_METRICS_OFFSET];
+        byte[] buffer;
+        if (width != 0 && height != 0) {
+            if (offset < 0) return false;
+            buffer = new byte[width * height];
+            atlas.get(offset, buffer);
+        } else {
+            /* white space */
+            buffer = new byte[0];
+        }
+
+        FT_Bitmap bitmap = new FT_Bitmap();
+        bitmap.width = width;
+        bitmap.rows = height;
+        bitmap.pitch = width;
+        bitmap.pixel_mode = (byte)pixelMode;
+
+        glyph.buffer = buffer;
+        glyph.bitmap = bitmap;
+        glyph.bitmap_left = batchMetrics[m + OSFreetype.GLYPH_METRICS_LEFT];
+        glyph.bitmap_top = batchMetrics[m + OSFreetype.GLYPH_METRICS_TOP];
+        glyph.advanceX = batchMetrics[m + OSFreetype.GLYPH_METRICS_ADVANCE_X] / 64f;    /* Fixed 26.6*/
+        glyph.advanceY = batchMetrics[m + OSFreetype.GLYPH_METRICS_ADVANCE_Y] / 64f;
+        glyph.userAdvance = batchMetrics[m + OSFreetype.GLYPH_METRICS_LINEAR_ADVANCE] / 65536.0f; /* Fixed 16.16 */
+        glyph.lcd = lcd;
+        return true;
+    }
+
+    synchronized void initGlyph(FTGlyph glyph, FTFontStrike strike) {
+        float size = strike.getSize();
+        if (size == 0) {
+            glyph.buffer = new byte[0];
+            glyph.bitmap = new FT_Bitmap();
+            return;
+        }
+        boolean lcd = strike.getAAMode() == FontResource.AA_LCD &&
+                      FTFactory.LCD_SUPPORT;
+        int flags = prepareLoadGlyph(strike, lcd);
 
         int glyphCode = glyph.getGlyphCode();
         int error = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
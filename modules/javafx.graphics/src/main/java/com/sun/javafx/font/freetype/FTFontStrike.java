@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@ import com.sun.javafx.font.PrismFontFactory;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
 import com.sun.javafx.geom.transform.BaseTransform;
+import java.util.BitSet;
 
 class FTFontStrike extends PrismFontStrike<FTFontFile> {
     FT_Matrix matrix;
@@ -78,6 +79,25 @@ class FTFontStrike extends PrismFontStrike<FTFontFile> {
         return fontResource.createGlyphOutline(glyphCode, getSize());
     }
 
+    @Override
+    public void prepareGlyphs(int[] glyphCodes, int count) {
+        FTGlyph[] glyphs = new FTGlyph[count];
+        BitSet pending = new BitSet();
+        int pendingCount = 0;
+        for (int i = 0; i < count; i++) {
+            int glyphCode = glyphCodes[i];
+            if (pending.get(glyphCode)) continue;
+            FTGlyph glyph = (FTGlyph)getGlyph(glyphCode);
+            if (glyph.bitmap == null) {
+                pending.set(glyphCode);
+                glyphs[pendingCount++] = glyph;
+            }
+        }
+        if (pendingCount > 1) {
+            getFontResource().initGlyphs(glyphs, pendingCount, this);
+        }
+    }
+
     void initGlyph(FTGlyph glyph) {
         FTFontFile fontResource = getFontResource();
         fontResource.initGlyph(glyph, this);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.javafx.font.freetype;
 
+import java.lang.annotation.Native;
+import java.nio.ByteBuffer;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import com.sun.glass.utils.NativeLibLoader;
@@ -109,8 +111,23 @@ class OSFreetype {
     static final native int FT_Set_Char_Size(long face, long char_width, long char_height, int horz_resolution, int vert_resolution);
     static final native int FT_Load_Glyph(long face, int glyph_index, int load_flags);
     static final native void FT_Set_Transform(long face, FT_Matrix matrix, long delta_x, long delta_y);
+    /* Layout of the metrics filled by rasterizeGlyphs(), per glyph */
+    @Native static final int GLYPH_METRICS_ERROR          = 0; /* FT_Load_Glyph error */
+    @Native static final int GLYPH_METRICS_PIXEL_MODE     = 1;
+    @Native static final int GLYPH_METRICS_WIDTH          = 2;
+    @Native static final int GLYPH_METRICS_HEIGHT         = 3;
+    @Native static final int GLYPH_METRICS_LEFT           = 4;
+    @Native static final int GLYPH_METRICS_TOP            = 5;
+    @Native static final int GLYPH_METRICS_ADVANCE_X      = 6; /* Fixed 26.6 */
+    @Native static final int GLYPH_METRICS_ADVANCE_Y      = 7; /* Fixed 26.6 */
+    @Native static final int GLYPH_METRICS_LINEAR_ADVANCE = 8; /* Fixed 16.16 */
+    @Native static final int GLYPH_METRICS_OFFSET         = 9; /* Bitmap offset in the atlas, -1 if none */
+    @Native static final int GLYPH_METRICS_SIZE           = 10;
+
     static final native FT_GlyphSlotRec getGlyphSlot(long face);
     static final native byte[] getBitmapData(long face);
+    static final native int rasterizeGlyphs(long face, int[] glyphCodes, int count, int load_flags,
+                                            ByteBuffer atlas, int[] metrics);
     static final native boolean isPangoEnabled();
     static final native boolean isHarfbuzzEnabled();
 }
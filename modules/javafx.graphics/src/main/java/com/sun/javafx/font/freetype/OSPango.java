@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -79,6 +79,12 @@ class OSPango {
     static final native void pango_attr_list_insert(long list, long attr);
     static final native long pango_itemize(long context, long text, int start_index, int length, long attrs, long cached_iter);
     static final native PangoGlyphString pango_shape(long text, long pangoItem);
+    /* Itemizes and shapes a run, reusing the result of a previous call with the same arguments */
+    static final native PangoGlyphString[] pango_shape_cached(long fontmap, String family, float size,
+                                                              int style, int weight, boolean fallback,
+                                                              boolean rtl, char[] text, int start, int length);
+    /* Fills stats with the hits, misses, evictions and entry count of the shaping cache */
+    static final native void pango_shape_cache_stats(long[] stats);
     static final native void pango_item_free(long item);
 
     /* Miscellaneous (glib, fontconfig) */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -175,6 +175,13 @@ final class UploadingPainter extends ViewPainter {
             }
 
             if (pix != null) {
+                // The painted regions are only meaningful when the pixels
+                // map one to one onto the scene buffer.
+                if (rtt == rttexture) {
+                    pix.setDirtyRects(getPaintedRects(), getPaintedRectCount());
+                } else {
+                    pix.setDirtyRects(null, 0);
+                }
                 /* transparent pixels created and ready for upload */
                 // Copy references, which are volatile, used by upload. Thus
                 // ensure they still exist once event queue is consumed.
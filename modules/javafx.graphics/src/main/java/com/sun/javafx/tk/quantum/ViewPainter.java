@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -103,6 +103,11 @@ abstract class ViewPainter implements Runnable {
     private RectBounds dirtyRegionTemp;
     private DirtyRegionPool dirtyRegionPool;
     private DirtyRegionContainer dirtyRegionContainer;
+    // Device space bounds of the dirty regions painted by the last call to
+    // paintImpl(), stored as (x, y, width, height). A count of 0 means that
+    // the entire scene was painted.
+    private int[] paintedRects;
+    private int paintedRectCount;
     private Affine3D tx;
     private Affine3D scaleTx;
     private GeneralTransform3D viewProjTx;
@@ -139,6 +144,7 @@ abstract class ViewPainter implements Runnable {
             dirtyRegionTemp = new RectBounds();
             dirtyRegionPool = new DirtyRegionPool(PrismSettings.dirtyRegionCount);
             dirtyRegionContainer = dirtyRegionPool.checkOut();
+            paintedRects = new int[4 * PrismSettings.dirtyRegionCount];
         }
     }
 
@@ -162,7 +168,22 @@ abstract class ViewPainter implements Runnable {
         }
     }
 
+    /**
+     * Returns the device space bounds of the regions painted by the last
+     * call to {@link #paintImpl}, as (x, y, width, height) quadruples.
+     *
+     * @return the painted rectangles, or null if the entire scene was painted
+     */
+    protected final int[] getPaintedRects() {
+        return paintedRectCount > 0 ? paintedRects : null;
+    }
+
+    protected final int getPaintedRectCount() {
+        return paintedRectCount;
+    }
+
     protected void paintImpl(final Graphics backBufferGraphics) {
+        paintedRectCount = 0;
         // We should not be painting anything with a width / height
         // that is <= 0, so we might as well bail right off.
         if (width <= 0 || height <= 0 || backBufferGraphics == null) {
@@ -316,6 +337,13 @@ abstract class ViewPainter implements Runnable {
                     dirtyRect.y = y0 = (int) Math.floor(dirtyRegion.getMinY() * pixelScaleY);
                     dirtyRect.width  = (int) Math.ceil (dirtyRegion.getMaxX() * pixelScaleX) - x0;
                     dirtyRect.height = (int) Math.ceil (dirtyRegion.getMaxY() * pixelScaleY) - y0;
+                    if (!showDirtyOpts) {
+                        int n = 4 * paintedRectCount++;
+                        paintedRects[n] = dirtyRect.x;
+                        paintedRects[n + 1] = dirtyRect.y;
+                        paintedRects[n + 2] = dirtyRect.width;
+                        paintedRects[n + 3] = dirtyRect.height;
+                    }
                     g.setClipRect(dirtyRect);
                     g.setClipRectIndex(i);
                     doPaint(g, getRootPath(i));
@@ -333,6 +361,7 @@ abstract class ViewPainter implements Runnable {
         // If we have an overlay then we need to render it too.
         if (overlayRoot != null) {
             overlayRoot.render(g);
+            paintedRectCount = 0;
         }
 
         // If we're showing dirty regions or overdraw, then we're going to need to draw
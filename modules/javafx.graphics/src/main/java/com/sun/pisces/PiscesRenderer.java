@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -316,6 +316,24 @@ public final class PiscesRenderer {
         this.setClipImpl(0, 0, surface.getWidth(), surface.getHeight());
     }
 
+    /**
+     * Sets the number of threads used to render large fills, images and
+     * masks. The destination rows are split into tiles which are rendered in
+     * parallel by a shared pool of worker threads; the output is identical to
+     * the output of serial rendering.
+     *
+     * @param threadCount number of threads, 1 (the default) renders every
+     * primitive on the calling thread
+     */
+    public void setThreadCount(int threadCount) {
+        if (threadCount < 1) {
+            throw new IllegalArgumentException("Invalid thread count: " + threadCount);
+        }
+        this.setThreadCountImpl(threadCount);
+    }
+
+    private native void setThreadCountImpl(int threadCount);
+
     /**
      * Clears rectangle (x, y, x + w, y + h). Clear sets all pixels to transparent black (0x00000000 ARGB).
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -63,6 +63,9 @@ public class GlyphCache {
     private static final int HEIGHT = PrismSettings.glyphCacheHeight; // in pixels
     private static ByteBuffer emptyMask;
 
+    // Scratch array for the glyph codes passed to FontStrike.prepareGlyphs()
+    private int[] glyphCodes;
+
     private final BaseContext context;
     private final FontStrike strike;
 
@@ -133,6 +136,7 @@ public class GlyphCache {
         int len = gl.getGlyphCount();
         Color currentColor = null;
         Point2D pt = new Point2D();
+        boolean prepared = false;
 
         for (int gi = 0; gi < len; gi++) {
             int gc = gl.getGlyphCode(gi);
@@ -147,6 +151,14 @@ public class GlyphCache {
             xform.transform(pt, pt);
             int subPixel = strike.getQuantizedPosition(pt);
             GlyphData data = getCachedGlyph(gc, subPixel);
+            if (data == null) {
+                if (!prepared) {
+                    // Let the strike rasterize the glyphs still to come together
+                    prepareGlyphs(gl, gi, len);
+                    prepared = true;
+                }
+                data = cacheGlyph(gc, subPixel);
+            }
             if (data != null) {
                 if (clip != null) {
                     // Always check clipping using user space.
@@ -243,11 +255,29 @@ public class GlyphCache {
         int subIndex = glyphCode & SEGMASK;
         segIndex |= (subPixel << SUBPIXEL_SHIFT);
         GlyphData[] segment = glyphDataMap.get(segIndex);
-        if (segment != null) {
-            if (segment[subIndex] != null) {
-                return segment[subIndex];
+        return segment != null ? segment[subIndex] : null;
+    }
+
+    private void prepareGlyphs(GlyphList gl, int start, int end) {
+        if (glyphCodes == null || glyphCodes.length < end - start) {
+            glyphCodes = new int[end - start];
+        }
+        int count = 0;
+        for (int gi = start; gi < end; gi++) {
+            int gc = gl.getGlyphCode(gi);
+            if ((gc & CompositeGlyphMapper.GLYPHMASK) != CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
+                glyphCodes[count++] = gc;
             }
-        } else {
+        }
+        strike.prepareGlyphs(glyphCodes, count);
+    }
+
+    private GlyphData cacheGlyph(int glyphCode, int subPixel) {
+        int segIndex = glyphCode >>> SEGSHIFT;
+        int subIndex = glyphCode & SEGMASK;
+        segIndex |= (subPixel << SUBPIXEL_SHIFT);
+        GlyphData[] segment = glyphDataMap.get(segIndex);
+        if (segment == null) {
             segment = new GlyphData[SEGSIZE];
             glyphDataMap.put(segIndex, segment);
         }
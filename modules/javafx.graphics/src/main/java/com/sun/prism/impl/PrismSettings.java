@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,7 @@ public final class PrismSettings {
     public static final boolean forceUploadingPainter;
     public static final boolean forceAlphaTestShader;
     public static final boolean forceNonAntialiasedShape;
+    public static final int swThreadCount;
 
     public static enum RasterizerType {
         DoubleMarlin("Double Precision Marlin Rasterizer");
@@ -352,6 +353,15 @@ public final class PrismSettings {
         // Force non anti-aliasing (not smooth) shape rendering
         forceNonAntialiasedShape = getBoolean(systemProperties, "prism.forceNonAntialiasedShape", false);
 
+        /*
+         * Number of threads the SW pipeline uses to render large fills.
+         * The default of 1 renders on the render thread only, "true" uses
+         * one thread per available processor.
+         */
+        swThreadCount = Utils.clamp(1, getInt(systemProperties, "prism.sw.threads", 1,
+                Runtime.getRuntime().availableProcessors(),
+                "Try -Dprism.sw.threads=<number>"), 64);
+
     }
 
     private static int parseInt(String s, int dflt, int trueDflt,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -64,6 +64,9 @@ public class QueuedPixelSource implements PixelSource {
     private final List<WeakReference<Pixels>> saved =
          new ArrayList<>(3);
     private final boolean useDirectBuffers;
+    // Set when a frame was dropped, so that the dirty regions recorded on
+    // the next frame no longer cover everything that changed on screen.
+    private boolean presentAll;
 
     public QueuedPixelSource(boolean useDirectBuffers) {
         this.useDirectBuffers = useDirectBuffers;
@@ -94,6 +97,9 @@ public class QueuedPixelSource implements PixelSource {
         if (beingConsumed != null) {
             throw new IllegalStateException("cannot skip while processing: "+beingConsumed);
         }
+        if (enqueued != null) {
+            presentAll = true;
+        }
         enqueued = null;
     }
 
@@ -166,10 +172,17 @@ public class QueuedPixelSource implements PixelSource {
      * Place the indicated {@code Pixels} object into the enqueued state,
      * replacing any other objects that are currently enqueued but not yet
      * being used by the consumer.
+     * If a frame is replaced or was skipped, the dirty regions of the
+     * indicated {@code Pixels} are discarded since the consumer never saw
+     * the changes of the dropped frame.
      *
      * @param pixels the {@code Pixels} object to be enqueued
      */
     public synchronized void enqueuePixels(Pixels pixels) {
+        if (presentAll || (enqueued != null && enqueued != pixels)) {
+            pixels.setDirtyRects(null, 0);
+            presentAll = false;
+        }
         enqueued = pixels;
     }
 }
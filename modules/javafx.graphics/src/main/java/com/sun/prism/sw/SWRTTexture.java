@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -117,6 +117,7 @@ class SWRTTexture extends SWArgbPreTexture implements RTTexture {
     public Graphics createGraphics() {
         if (pr == null) {
             pr = new PiscesRenderer(this.surface);
+            pr.setThreadCount(PrismSettings.swThreadCount);
         }
         return new SWGraphics(this, getResourceFactory().getContext(), pr);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 
 #include <jni.h>
 #include "SSEUtils.h"
+#include "SSEKernels.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer.h"
 
 JNIEXPORT void JNICALL
@@ -114,28 +115,17 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBlack
     amax += (jint) ((255 - amax) * spread);
     jint kscale = 0x7fffffff / amax;
     jint amin = (amax / 255);
-    jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            // Accumulate the data for this row location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            // Clamp, scale and convert the sum into a color.
-            dstPixels[dstoff] =
-                ((suma < amin) ? 0
-                 : ((suma >= amax) ? 0xff000000
-                    : (((suma * kscale) >> 23) << 24)));
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+    BoxShadowParams params;
+    params.amin = amin;
+    params.amax = amax;
+    params.kscalea = kscale;
+    params.kscaler = 0;
+    params.kscaleg = 0;
+    params.kscaleb = 0;
+    params.shadowRGB = (int32_t) 0xff000000;
+    boxShadowVertical(getKernelLevel(),
+                      (int32_t *) dstPixels, dstw, dsth, dstscan,
+                      (const int32_t *) srcPixels, srch, srcscan, &params);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -176,36 +166,22 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVertical
     jint kscaleb = (jint) (kscalea * shadowColor[2]);
     kscalea = (jint) (kscalea * shadowColor[3]);
     jint amin = (amax / 255);
-    jint voff = vsize * srcscan;
     jint shadowRGB =
         (((jint) (shadowColor[0] * 255)) << 16) |
         (((jint) (shadowColor[1] * 255)) <<  8) |
         (((jint) (shadowColor[2] * 255))      ) |
         (((jint) (shadowColor[3] * 255)) << 24);
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            // Accumulate the data for this row location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            // Clamp, scale and convert the sum into a color.
-            dstPixels[dstoff] =
-                ((suma < amin) ? 0
-                 : ((suma >= amax) ? shadowRGB
-                    : ((((suma * kscalea) >> 23) << 24) |
-                       (((suma * kscaler) >> 23) << 16) |
-                       (((suma * kscaleg) >> 23) <<  8) |
-                       (((suma * kscaleb) >> 23)      ))));
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+    BoxShadowParams params;
+    params.amin = amin;
+    params.amax = amax;
+    params.kscalea = kscalea;
+    params.kscaler = kscaler;
+    params.kscaleg = kscaleg;
+    params.kscaleb = kscaleb;
+    params.shadowRGB = shadowRGB;
+    boxShadowVertical(getKernelLevel(),
+                      (int32_t *) dstPixels, dstw, dsth, dstscan,
+                      (const int32_t *) srcPixels, srch, srcscan, &params);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -0,0 +1,556 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdlib.h>
+#include "SSEKernels.h"
+
+#ifdef DECORA_USE_SSE2
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif /* DECORA_USE_SSE2 */
+
+/*
+ * Scalar reference kernels.
+ */
+
+static void boxBlurHorizontalScalar(int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                                    const int32_t *src, int32_t srcw, int32_t srcscan)
+{
+    int32_t hsize = dstw - srcw + 1;
+    int32_t kscale = 0x7fffffff / (hsize * 255);
+    int32_t srcoff = 0;
+    int32_t dstoff = 0;
+    for (int32_t y = 0; y < dsth; y++) {
+        int32_t suma = 0;
+        int32_t sumr = 0;
+        int32_t sumg = 0;
+        int32_t sumb = 0;
+        for (int32_t x = 0; x < dstw; x++) {
+            int32_t rgb;
+            // Un-accumulate the data for col-hsize location into the sums.
+            rgb = (x >= hsize) ? src[srcoff + x - hsize] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            sumr -= (rgb >> 16) & 0xff;
+            sumg -= (rgb >>  8) & 0xff;
+            sumb -= (rgb      ) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (x < srcw) ? src[srcoff + x] : 0;
+            suma += (rgb >> 24) & 0xff;
+            sumr += (rgb >> 16) & 0xff;
+            sumg += (rgb >>  8) & 0xff;
+            sumb += (rgb      ) & 0xff;
+            dst[dstoff + x] =
+                (((suma * kscale) >> 23) << 24) +
+                (((sumr * kscale) >> 23) << 16) +
+                (((sumg * kscale) >> 23) <<  8) +
+                (((sumb * kscale) >> 23)      );
+        }
+        srcoff += srcscan;
+        dstoff += dstscan;
+    }
+}
+
+static void boxBlurVerticalScalar(int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                                  const int32_t *src, int32_t srch, int32_t srcscan)
+{
+    int32_t vsize = dsth - srch + 1;
+    int32_t kscale = 0x7fffffff / (vsize * 255);
+    int32_t voff = vsize * srcscan;
+    for (int32_t x = 0; x < dstw; x++) {
+        int32_t suma = 0;
+        int32_t sumr = 0;
+        int32_t sumg = 0;
+        int32_t sumb = 0;
+        int32_t srcoff = x;
+        int32_t dstoff = x;
+        for (int32_t y = 0; y < dsth; y++) {
+            int32_t rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? src[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            sumr -= (rgb >> 16) & 0xff;
+            sumg -= (rgb >>  8) & 0xff;
+            sumb -= (rgb      ) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (y < srch) ? src[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            sumr += (rgb >> 16) & 0xff;
+            sumg += (rgb >>  8) & 0xff;
+            sumb += (rgb      ) & 0xff;
+            dst[dstoff] =
+                (((suma * kscale) >> 23) << 24) +
+                (((sumr * kscale) >> 23) << 16) +
+                (((sumg * kscale) >> 23) <<  8) +
+                (((sumb * kscale) >> 23)      );
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
+static void boxShadowVerticalScalar(int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                                    const int32_t *src, int32_t srch, int32_t srcscan,
+                                    const BoxShadowParams *params)
+{
+    int32_t vsize = dsth - srch + 1;
+    int32_t voff = vsize * srcscan;
+    for (int32_t x = 0; x < dstw; x++) {
+        int32_t suma = 0;
+        int32_t srcoff = x;
+        int32_t dstoff = x;
+        for (int32_t y = 0; y < dsth; y++) {
+            int32_t rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? src[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this row location into the sums.
+            rgb = (y < srch) ? src[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            // Clamp, scale and convert the sum into a color.
+            dst[dstoff] =
+                ((suma < params->amin) ? 0
+                 : ((suma >= params->amax) ? params->shadowRGB
+                    : ((((suma * params->kscalea) >> 23) << 24) |
+                       (((suma * params->kscaler) >> 23) << 16) |
+                       (((suma * params->kscaleg) >> 23) <<  8) |
+                       (((suma * params->kscaleb) >> 23)      ))));
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
+#ifdef DECORA_USE_SSE2
+
+/*
+ * SSE2 kernels.
+ *
+ * A pixel is unpacked into one 32-bit lane per channel, in memory (BGRA)
+ * order, so that packing the lanes back restores the original layout.
+ *
+ * The vertical kernels sweep the image row by row and keep the running sums
+ * of all the columns in a row of accumulators, instead of walking the image
+ * column by column with a stride of srcscan.
+ */
+
+static inline __m128i unpackPixel(int32_t rgb)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i p = _mm_unpacklo_epi8(_mm_cvtsi32_si128(rgb), zero);
+    return _mm_unpacklo_epi16(p, zero);
+}
+
+static inline int32_t packPixel(__m128i channels)
+{
+    __m128i p = _mm_packs_epi32(channels, channels);
+    return _mm_cvtsi128_si32(_mm_packus_epi16(p, p));
+}
+
+// (sums * kscale) >> 23 in each lane. SSE2 lacks a 32-bit multiply,
+// so the even and odd lanes are multiplied into 64 bits separately.
+static inline __m128i scaleSums(__m128i sums, __m128i kscale)
+{
+    const __m128i evenMask = _mm_set_epi32(0, -1, 0, -1);
+    __m128i even = _mm_srli_epi64(_mm_mul_epu32(sums, kscale), 23);
+    __m128i odd = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(sums, 32), kscale), 23);
+    return _mm_or_si128(_mm_and_si128(even, evenMask), _mm_slli_epi64(odd, 32));
+}
+
+static void boxBlurHorizontalSSE2(int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                                  const int32_t *src, int32_t srcw, int32_t srcscan)
+{
+    int32_t hsize = dstw - srcw + 1;
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / (hsize * 255));
+    for (int32_t y = 0; y < dsth; y++) {
+        const int32_t *srcRow = src + (size_t) y * srcscan;
+        int32_t *dstRow = dst + (size_t) y * dstscan;
+        __m128i sums = _mm_setzero_si128();
+        for (int32_t x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sums = _mm_sub_epi32(sums, unpackPixel(srcRow[x - hsize]));
+            }
+            if (x < srcw) {
+                sums = _mm_add_epi32(sums, unpackPixel(srcRow[x]));
+            }
+            dstRow[x] = packPixel(scaleSums(sums, kscale));
+        }
+    }
+}
+
+static void boxBlurVerticalRowSSE2(int32_t *dstRow, const int32_t *addRow, const int32_t *subRow,
+                                   int32_t *sums, int32_t x, int32_t dstw, __m128i kscale)
+{
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 4 <= dstw; x += 4) {
+        __m128i *acc = (__m128i *) (sums + 4 * x);
+        __m128i s0 = _mm_loadu_si128(acc + 0);
+        __m128i s1 = _mm_loadu_si128(acc + 1);
+        __m128i s2 = _mm_loadu_si128(acc + 2);
+        __m128i s3 = _mm_loadu_si128(acc + 3);
+        if (addRow) {
+            __m128i p = _mm_loadu_si128((const __m128i *) (addRow + x));
+            __m128i lo = _mm_unpacklo_epi8(p, zero);
+            __m128i hi = _mm_unpackhi_epi8(p, zero);
+            s0 = _mm_add_epi32(s0, _mm_unpacklo_epi16(lo, zero));
+            s1 = _mm_add_epi32(s1, _mm_unpackhi_epi16(lo, zero));
+            s2 = _mm_add_epi32(s2, _mm_unpacklo_epi16(hi, zero));
+            s3 = _mm_add_epi32(s3, _mm_unpackhi_epi16(hi, zero));
+        }
+        if (subRow) {
+            __m128i p = _mm_loadu_si128((const __m128i *) (subRow + x));
+            __m128i lo = _mm_unpacklo_epi8(p, zero);
+            __m128i hi = _mm_unpackhi_epi8(p, zero);
+            s0 = _mm_sub_epi32(s0, _mm_unpacklo_epi16(lo, zero));
+            s1 = _mm_sub_epi32(s1, _mm_unpackhi_epi16(lo, zero));
+            s2 = _mm_sub_epi32(s2, _mm_unpacklo_epi16(hi, zero));
+            s3 = _mm_sub_epi32(s3, _mm_unpackhi_epi16(hi, zero));
+        }
+        _mm_storeu_si128(acc + 0, s0);
+        _mm_storeu_si128(acc + 1, s1);
+        _mm_storeu_si128(acc + 2, s2);
+        _mm_storeu_si128(acc + 3, s3);
+        __m128i c01 = _mm_packs_epi32(scaleSums(s0, kscale), scaleSums(s1, kscale));
+        __m128i c23 = _mm_packs_epi32(scaleSums(s2, kscale), scaleSums(s3, kscale));
+        _mm_storeu_si128((__m128i *) (dstRow + x), _mm_packus_epi16(c01, c23));
+    }
+    for (; x < dstw; x++) {
+        __m128i *acc = (__m128i *) (sums + 4 * x);
+        __m128i s = _mm_loadu_si128(acc);
+        if (addRow) {
+            s = _mm_add_epi32(s, unpackPixel(addRow[x]));
+        }
+        if (subRow) {
+            s = _mm_sub_epi32(s, unpackPixel(subRow[x]));
+        }
+        _mm_storeu_si128(acc, s);
+        dstRow[x] = packPixel(scaleSums(s, kscale));
+    }
+}
+
+typedef struct {
+    __m128i amin;
+    __m128i amax;
+    __m128i kscalea;
+    __m128i kscaler;
+    __m128i kscaleg;
+    __m128i kscaleb;
+    __m128i shadowRGB;
+} BoxShadowVectors;
+
+static inline __m128i shadowPixels(__m128i suma, const BoxShadowVectors *v)
+{
+    __m128i rgb = _mm_or_si128(
+        _mm_or_si128(_mm_slli_epi32(scaleSums(suma, v->kscalea), 24),
+                     _mm_slli_epi32(scaleSums(suma, v->kscaler), 16)),
+        _mm_or_si128(_mm_slli_epi32(scaleSums(suma, v->kscaleg), 8),
+                     scaleSums(suma, v->kscaleb)));
+    __m128i saturated = _mm_andnot_si128(_mm_cmplt_epi32(suma, v->amax),
+                                         _mm_set1_epi32(-1));
+    rgb = _mm_or_si128(_mm_and_si128(saturated, v->shadowRGB),
+                       _mm_andnot_si128(saturated, rgb));
+    return _mm_andnot_si128(_mm_cmplt_epi32(suma, v->amin), rgb);
+}
+
+static void boxShadowVerticalRowSSE2(int32_t *dstRow, const int32_t *addRow, const int32_t *subRow,
+                                     int32_t *sums, int32_t x, int32_t dstw,
+                                     const BoxShadowVectors *v)
+{
+    for (; x + 4 <= dstw; x += 4) {
+        __m128i *acc = (__m128i *) (sums + x);
+        __m128i suma = _mm_loadu_si128(acc);
+        if (addRow) {
+            suma = _mm_add_epi32(suma, _mm_srli_epi32(
+                _mm_loadu_si128((const __m128i *) (addRow + x)), 24));
+        }
+        if (subRow) {
+            suma = _mm_sub_epi32(suma, _mm_srli_epi32(
+                _mm_loadu_si128((const __m128i *) (subRow + x)), 24));
+        }
+        _mm_storeu_si128(acc, suma);
+        _mm_storeu_si128((__m128i *) (dstRow + x), shadowPixels(suma, v));
+    }
+    for (; x < dstw; x++) {
+        if (addRow) {
+            sums[x] += (addRow[x] >> 24) & 0xff;
+        }
+        if (subRow) {
+            sums[x] -= (subRow[x] >> 24) & 0xff;
+        }
+        dstRow[x] = _mm_cvtsi128_si32(shadowPixels(_mm_cvtsi32_si128(sums[x]), v));
+    }
+}
+
+/*
+ * AVX2 kernels, 2 pixels (horizontal) or 8 pixels (vertical) per step.
+ * The 256-bit unpack and pack instructions work within 128-bit lanes, so the
+ * accumulators of the vertical kernels hold the pixels of a step in a
+ * permuted order which is undone by the packing.
+ */
+
+TARGET_AVX2
+static inline __m256i unpackPixelPair(int32_t rgb0, int32_t rgb1)
+{
+    return _mm256_cvtepu8_epi32(_mm_unpacklo_epi32(_mm_cvtsi32_si128(rgb0),
+                                                   _mm_cvtsi32_si128(rgb1)));
+}
+
+TARGET_AVX2
+static void boxBlurHorizontalAVX2(int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                                  const int32_t *src, int32_t srcw, int32_t srcscan)
+{
+    int32_t hsize = dstw - srcw + 1;
+    __m256i kscale = _mm256_set1_epi32(0x7fffffff / (hsize * 255));
+    int32_t y = 0;
+    for (; y + 2 <= dsth; y += 2) {
+        const int32_t *srcRow0 = src + (size_t) y * srcscan;
+        const int32_t *srcRow1 = srcRow0 + srcscan;
+        int32_t *dstRow0 = dst + (size_t) y * dstscan;
+        int32_t *dstRow1 = dstRow0 + dstscan;
+        __m256i sums = _mm256_setzero_si256();
+        for (int32_t x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sums = _mm256_sub_epi32(sums, unpackPixelPair(srcRow0[x - hsize], srcRow1[x - hsize]));
+            }
+            if (x < srcw) {
+                sums = _mm256_add_epi32(sums, unpackPixelPair(srcRow0[x], srcRow1[x]));
+            }
+            __m256i c = _mm256_srli_epi32(_mm256_mullo_epi32(sums, kscale), 23);
+            c = _mm256_packs_epi32(c, c);
+            c = _mm256_packus_epi16(c, c);
+            dstRow0[x] = _mm_cvtsi128_si32(_mm256_castsi256_si128(c));
+            dstRow1[x] = _mm_cvtsi128_si32(_mm256_extracti128_si256(c, 1));
+        }
+    }
+    if (y < dsth) {
+        boxBlurHorizontalSSE2(dst + (size_t) y * dstscan, dstw, dsth - y, dstscan,
+                              src + (size_t) y * srcscan, srcw, srcscan);
+    }
+}
+
+TARGET_AVX2
+static int32_t boxBlurVerticalRowAVX2(int32_t *dstRow, const int32_t *addRow, const int32_t *subRow,
+                                      int32_t *sums, int32_t dstw, int32_t k)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i kscale = _mm256_set1_epi32(k);
+    int32_t x = 0;
+    for (; x + 8 <= dstw; x += 8) {
+        __m256i *acc = (__m256i *) (sums + 4 * x);
+        __m256i s0 = _mm256_loadu_si256(acc + 0);
+        __m256i s1 = _mm256_loadu_si256(acc + 1);
+        __m256i s2 = _mm256_loadu_si256(acc + 2);
+        __m256i s3 = _mm256_loadu_si256(acc + 3);
+        if (addRow) {
+            __m256i p = _mm256_loadu_si256((const __m256i *) (addRow + x));
+            __m256i lo = _mm256_unpacklo_epi8(p, zero);
+            __m256i hi = _mm256_unpackhi_epi8(p, zero);
+            s0 = _mm256_add_epi32(s0, _mm256_unpacklo_epi16(lo, zero));
+            s1 = _mm256_add_epi32(s1, _mm256_unpackhi_epi16(lo, zero));
+            s2 = _mm256_add_epi32(s2, _mm256_unpacklo_epi16(hi, zero));
+            s3 = _mm256_add_epi32(s3, _mm256_unpackhi_epi16(hi, zero));
+        }
+        if (subRow) {
+            __m256i p = _mm256_loadu_si256((const __m256i *) (subRow + x));
+            __m256i lo = _mm256_unpacklo_epi8(p, zero);
+            __m256i hi = _mm256_unpackhi_epi8(p, zero);
+            s0 = _mm256_sub_epi32(s0, _mm256_unpacklo_epi16(lo, zero));
+            s1 = _mm256_sub_epi32(s1, _mm256_unpackhi_epi16(lo, zero));
+            s2 = _mm256_sub_epi32(s2, _mm256_unpacklo_epi16(hi, zero));
+            s3 = _mm256_sub_epi32(s3, _mm256_unpackhi_epi16(hi, zero));
+        }
+        _mm256_storeu_si256(acc + 0, s0);
+        _mm256_storeu_si256(acc + 1, s1);
+        _mm256_storeu_si256(acc + 2, s2);
+        _mm256_storeu_si256(acc + 3, s3);
+        __m256i c01 = _mm256_packs_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(s0, kscale), 23),
+                                         _mm256_srli_epi32(_mm256_mullo_epi32(s1, kscale), 23));
+        __m256i c23 = _mm256_packs_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(s2, kscale), 23),
+                                         _mm256_srli_epi32(_mm256_mullo_epi32(s3, kscale), 23));
+        _mm256_storeu_si256((__m256i *) (dstRow + x), _mm256_packus_epi16(c01, c23));
+    }
+    return x;
+}
+
+TARGET_AVX2
+static inline __m256i shadowPixelsAVX2(__m256i suma, const BoxShadowVectors *v)
+{
+    __m256i kscalea = _mm256_broadcastsi128_si256(v->kscalea);
+    __m256i kscaler = _mm256_broadcastsi128_si256(v->kscaler);
+    __m256i kscaleg = _mm256_broadcastsi128_si256(v->kscaleg);
+    __m256i kscaleb = _mm256_broadcastsi128_si256(v->kscaleb);
+    __m256i rgb = _mm256_or_si256(
+        _mm256_or_si256(_mm256_slli_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(suma, kscalea), 23), 24),
+                        _mm256_slli_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(suma, kscaler), 23), 16)),
+        _mm256_or_si256(_mm256_slli_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(suma, kscaleg), 23), 8),
+                        _mm256_srli_epi32(_mm256_mullo_epi32(suma, kscaleb), 23)));
+    __m256i below = _mm256_cmpgt_epi32(_mm256_broadcastsi128_si256(v->amin), suma);
+    __m256i unsaturated = _mm256_cmpgt_epi32(_mm256_broadcastsi128_si256(v->amax), suma);
+    rgb = _mm256_blendv_epi8(_mm256_broadcastsi128_si256(v->shadowRGB), rgb, unsaturated);
+    return _mm256_andnot_si256(below, rgb);
+}
+
+TARGET_AVX2
+static int32_t boxShadowVerticalRowAVX2(int32_t *dstRow, const int32_t *addRow, const int32_t *subRow,
+                                        int32_t *sums, int32_t dstw, const BoxShadowVectors *v)
+{
+    int32_t x = 0;
+    for (; x + 8 <= dstw; x += 8) {
+        __m256i *acc = (__m256i *) (sums + x);
+        __m256i suma = _mm256_loadu_si256(acc);
+        if (addRow) {
+            suma = _mm256_add_epi32(suma, _mm256_srli_epi32(
+                _mm256_loadu_si256((const __m256i *) (addRow + x)), 24));
+        }
+        if (subRow) {
+            suma = _mm256_sub_epi32(suma, _mm256_srli_epi32(
+                _mm256_loadu_si256((const __m256i *) (subRow + x)), 24));
+        }
+        _mm256_storeu_si256(acc, suma);
+        _mm256_storeu_si256((__m256i *) (dstRow + x), shadowPixelsAVX2(suma, v));
+    }
+    return x;
+}
+
+static bool cpuSupportsAVX2()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    // The OS must save the AVX state (OSXSAVE and XCR0 bits 1 and 2).
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+        (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif /* DECORA_USE_SSE2 */
+
+int getKernelLevel()
+{
+#ifdef DECORA_USE_SSE2
+    static int level = cpuSupportsAVX2() ? KERNEL_LEVEL_AVX2 : KERNEL_LEVEL_SSE2;
+    return level;
+#else
+    return KERNEL_LEVEL_SCALAR;
+#endif
+}
+
+void boxBlurHorizontal(int level,
+                       int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                       const int32_t *src, int32_t srcw, int32_t srcscan)
+{
+#ifdef DECORA_USE_SSE2
+    if (level >= KERNEL_LEVEL_AVX2) {
+        boxBlurHorizontalAVX2(dst, dstw, dsth, dstscan, src, srcw, srcscan);
+        return;
+    }
+    if (level >= KERNEL_LEVEL_SSE2) {
+        boxBlurHorizontalSSE2(dst, dstw, dsth, dstscan, src, srcw, srcscan);
+        return;
+    }
+#endif
+    boxBlurHorizontalScalar(dst, dstw, dsth, dstscan, src, srcw, srcscan);
+}
+
+void boxBlurVertical(int level,
+                     int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                     const int32_t *src, int32_t srch, int32_t srcscan)
+{
+#ifdef DECORA_USE_SSE2
+    int32_t *sums = (level >= KERNEL_LEVEL_SSE2)
+        ? (int32_t *) calloc((size_t) dstw * 4, sizeof(int32_t))
+        : NULL;
+    if (sums != NULL) {
+        int32_t vsize = dsth - srch + 1;
+        int32_t kscale = 0x7fffffff / (vsize * 255);
+        for (int32_t y = 0; y < dsth; y++) {
+            const int32_t *addRow = (y < srch) ? src + (size_t) y * srcscan : NULL;
+            const int32_t *subRow = (y >= vsize) ? src + (size_t) (y - vsize) * srcscan : NULL;
+            int32_t *dstRow = dst + (size_t) y * dstscan;
+            int32_t x = 0;
+            if (level >= KERNEL_LEVEL_AVX2) {
+                x = boxBlurVerticalRowAVX2(dstRow, addRow, subRow, sums, dstw, kscale);
+            }
+            boxBlurVerticalRowSSE2(dstRow, addRow, subRow, sums, x, dstw,
+                                   _mm_set1_epi32(kscale));
+        }
+        free(sums);
+        return;
+    }
+#endif
+    boxBlurVerticalScalar(dst, dstw, dsth, dstscan, src, srch, srcscan);
+}
+
+void boxShadowVertical(int level,
+                       int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                       const int32_t *src, int32_t srch, int32_t srcscan,
+                       const BoxShadowParams *params)
+{
+#ifdef DECORA_USE_SSE2
+    int32_t *sums = (level >= KERNEL_LEVEL_SSE2)
+        ? (int32_t *) calloc((size_t) dstw, sizeof(int32_t))
+        : NULL;
+    if (sums != NULL) {
+        BoxShadowVectors v;
+        v.amin = _mm_set1_epi32(params->amin);
+        v.amax = _mm_set1_epi32(params->amax);
+        v.kscalea = _mm_set1_epi32(params->kscalea);
+        v.kscaler = _mm_set1_epi32(params->kscaler);
+        v.kscaleg = _mm_set1_epi32(params->kscaleg);
+        v.kscaleb = _mm_set1_epi32(params->kscaleb);
+        v.shadowRGB = _mm_set1_epi32(params->shadowRGB);
+        int32_t vsize = dsth - srch + 1;
+        for (int32_t y = 0; y < dsth; y++) {
+            const int32_t *addRow = (y < srch) ? src + (size_t) y * srcscan : NULL;
+            const int32_t *subRow = (y >= vsize) ? src + (size_t) (y - vsize) * srcscan : NULL;
+            int32_t *dstRow = dst + (size_t) y * dstscan;
+            int32_t x = 0;
+            if (level >= KERNEL_LEVEL_AVX2) {
+                x = boxShadowVerticalRowAVX2(dstRow, addRow, subRow, sums, dstw, &v);
+            }
+            boxShadowVerticalRowSSE2(dstRow, addRow, subRow, sums, x, dstw, &v);
+        }
+        free(sums);
+        return;
+    }
+#endif
+    boxShadowVerticalScalar(dst, dstw, dsth, dstscan, src, srch, srcscan, params);
+}
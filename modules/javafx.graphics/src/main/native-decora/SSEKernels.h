@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _Included_SSEKernels
+#define _Included_SSEKernels
+
+#include <stdint.h>
+
+/*
+ * The SIMD kernels are compiled in whenever the target guarantees SSE2,
+ * AVX2 kernels are compiled for specific functions and only used when the
+ * processor supports them.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DECORA_USE_SSE2
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Instruction set levels of the kernels, in increasing order.
+ * The scalar kernels are the reference implementation, all the other
+ * levels produce bit-identical results.
+ */
+#define KERNEL_LEVEL_SCALAR 0
+#define KERNEL_LEVEL_SSE2   1
+#define KERNEL_LEVEL_AVX2   2
+
+/*
+ * Returns the highest kernel level supported by both this build and
+ * the processor. The result is computed once and cached.
+ */
+int getKernelLevel();
+
+/*
+ * Parameters of the box shadow kernels, see SSEBoxShadowPeer.cc.
+ * Sums below amin produce a transparent pixel, sums at or above amax
+ * produce shadowRGB, other sums are scaled by kscale{a,r,g,b}.
+ */
+typedef struct {
+    int32_t amin;
+    int32_t amax;
+    int32_t kscalea;
+    int32_t kscaler;
+    int32_t kscaleg;
+    int32_t kscaleb;
+    int32_t shadowRGB;
+} BoxShadowParams;
+
+/*
+ * Box blur of each row of src into dst, dstw - srcw + 1 pixels wide.
+ */
+void boxBlurHorizontal(int level,
+                       int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                       const int32_t *src, int32_t srcw, int32_t srcscan);
+
+/*
+ * Box blur of each column of src into dst, dsth - srch + 1 pixels high.
+ */
+void boxBlurVertical(int level,
+                     int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                     const int32_t *src, int32_t srch, int32_t srcscan);
+
+/*
+ * Box blur of the alpha of each column of src into a shadow in dst,
+ * dsth - srch + 1 pixels high.
+ */
+void boxShadowVertical(int level,
+                       int32_t *dst, int32_t dstw, int32_t dsth, int32_t dstscan,
+                       const int32_t *src, int32_t srch, int32_t srcscan,
+                       const BoxShadowParams *params);
+
+#ifdef __cplusplus
+};
+#endif /* __cplusplus */
+
+#endif /* _Included_SSEKernels */
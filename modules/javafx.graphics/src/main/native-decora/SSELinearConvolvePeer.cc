@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include <jni.h>
 #include <math.h>
 #include "SSEUtils.h"
+#include "SSEKernels.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer.h"
 
 #define cmin 1.0f
@@ -38,6 +39,51 @@
 
 #define fvaltobyte(f) (((f) < cmin) ? 0 : (((f) > cmax) ? 255 : ((jint) (f))))
 
+#ifdef DECORA_USE_SSE2
+#include <emmintrin.h>
+
+/*
+ * Convolves one row of filterHV with all four components of a pixel held
+ * in a single vector, in memory (BGRA) order.  The per-component sums are
+ * accumulated in the same order as the scalar loop so the results match.
+ */
+static void filterRowSSE2(jint *dstPixels, jint dstoff, jint dstcols, jint dcolinc,
+                          const jint *srcPixels, jint srcoff, jint srccols, jint scolinc,
+                          const jfloat *kvals, jint kernelSize)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 vcmin = _mm_set1_ps(cmin);
+    const __m128 vcmax = _mm_set1_ps(cmax);
+    const __m128i v255 = _mm_set1_epi32(255);
+    __m128 cvals[128];
+    for (jint i = 0; i < kernelSize; i++) {
+        cvals[i] = _mm_setzero_ps();
+    }
+    jint koff = kernelSize;
+    for (jint c = 0; c < dstcols; c++) {
+        jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
+        __m128i p = _mm_unpacklo_epi8(_mm_cvtsi32_si128(rgb), zero);
+        cvals[kernelSize - koff] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(p, zero));
+        if (--koff <= 0) {
+            koff += kernelSize;
+        }
+        __m128 sum = _mm_setzero_ps();
+        for (jint i = 0; i < kernelSize; i++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(cvals[i], _mm_set1_ps(kvals[koff + i])));
+        }
+        // Clamp as fvaltobyte does: below cmin is 0, above cmax is 255.
+        __m128i bytes = _mm_cvttps_epi32(sum);
+        __m128i over = _mm_castps_si128(_mm_cmpgt_ps(sum, vcmax));
+        bytes = _mm_or_si128(_mm_andnot_si128(over, bytes), _mm_and_si128(over, v255));
+        bytes = _mm_andnot_si128(_mm_castps_si128(_mm_cmplt_ps(sum, vcmin)), bytes);
+        bytes = _mm_packs_epi32(bytes, bytes);
+        dstPixels[dstoff] = _mm_cvtsi128_si32(_mm_packus_epi16(bytes, bytes));
+        dstoff += dcolinc;
+        srcoff += scolinc;
+    }
+}
+#endif /* DECORA_USE_SSE2 */
+
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterVector
     (JNIEnv *env, jobject lcpthis,
@@ -130,6 +176,17 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterHV
         return;
     }
 
+#ifdef DECORA_USE_SSE2
+    jint dstrow = 0;
+    jint srcrow = 0;
+    for (jint r = 0; r < dstrows; r++) {
+        filterRowSSE2(dstPixels, dstrow, dstcols, dcolinc,
+                      srcPixels, srcrow, srccols, scolinc,
+                      kvals, kernelSize);
+        dstrow += drowinc;
+        srcrow += srowinc;
+    }
+#else
     // cvals stores the component values from the surrounding K pixels
     // from x-r to x+r
     jfloat cvals[128*4];
@@ -179,6 +236,7 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterHV
         dstrow += drowinc;
         srcrow += srowinc;
     }
+#endif /* DECORA_USE_SSE2 */
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,11 +31,62 @@
 #include <jni.h>
 #include <math.h>
 #include "SSEUtils.h"
+#include "SSEKernels.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer.h"
 
 #define cmin 1.0f
 #define cmax (255.0f - 1.0f/32.0f)
 
+#define shadowrgb(shadowRGBs, sum) \
+    (((sum) < 0.0f) ? 0 \
+     : (((sum) >= 254.0f) ? (shadowRGBs)[255] \
+        : (shadowRGBs)[((jint) (sum)) + 1]))
+
+#ifdef DECORA_USE_SSE2
+#include <emmintrin.h>
+
+/*
+ * Convolves four consecutive rows of filterHV at once, one row per vector
+ * lane.  Only the alpha channel is blurred, so unlike the component-wise
+ * kernel of SSELinearConvolvePeer there is nothing to spread across the
+ * lanes within a row.  Each lane performs the same sequence of operations
+ * as the scalar loop so the results match.
+ */
+static void filterRowsSSE2(jint *dstPixels, jint dstoff, jint dstcols, jint dcolinc, jint drowinc,
+                           const jint *srcPixels, jint srcoff, jint srccols, jint scolinc, jint srowinc,
+                           const jfloat *kvals, jint kernelSize, const jint *shadowRGBs)
+{
+    __m128 avals[128];
+    for (jint i = 0; i < kernelSize; i++) {
+        avals[i] = _mm_setzero_ps();
+    }
+    jint koff = kernelSize;
+    for (jint c = 0; c < dstcols; c++) {
+        __m128i rgb = (c < srccols)
+            ? _mm_set_epi32(srcPixels[srcoff + 3 * srowinc],
+                            srcPixels[srcoff + 2 * srowinc],
+                            srcPixels[srcoff + srowinc],
+                            srcPixels[srcoff])
+            : _mm_setzero_si128();
+        avals[kernelSize - koff] = _mm_cvtepi32_ps(_mm_srli_epi32(rgb, 24));
+        if (--koff <= 0) {
+            koff += kernelSize;
+        }
+        __m128 sum = _mm_set1_ps(-0.5f);
+        for (jint i = 0; i < kernelSize; i++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(avals[i], _mm_set1_ps(kvals[koff + i])));
+        }
+        jfloat sums[4];
+        _mm_storeu_ps(sums, sum);
+        for (jint k = 0; k < 4; k++) {
+            dstPixels[dstoff + k * drowinc] = shadowrgb(shadowRGBs, sums[k]);
+        }
+        dstoff += dcolinc;
+        srcoff += scolinc;
+    }
+}
+#endif /* DECORA_USE_SSE2 */
+
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer_filterVector
     (JNIEnv *env, jclass klass,
@@ -147,12 +198,22 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer_filterHV
         return;
     }
 
+    jint dstrow = 0;
+    jint srcrow = 0;
+    jint r = 0;
+#ifdef DECORA_USE_SSE2
+    for (; r + 4 <= dstrows; r += 4) {
+        filterRowsSSE2(dstPixels, dstrow, dstcols, dcolinc, drowinc,
+                       srcPixels, srcrow, srccols, scolinc, srowinc,
+                       kvals, kernelSize, shadowRGBs);
+        dstrow += drowinc * 4;
+        srcrow += srowinc * 4;
+    }
+#endif /* DECORA_USE_SSE2 */
     // avals stores the alpha values from the surrounding K pixels
     // from x-r to x+r
     jfloat avals[128];
-    jint dstrow = 0;
-    jint srcrow = 0;
-    for (jint r = 0; r < dstrows; r++) {
+    for (; r < dstrows; r++) {
         jint dstoff = dstrow;
         jint srcoff = srcrow;
         // Must clear out the array at the start of every line
@@ -174,10 +235,7 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer_filterHV
             for (jint i = 0; i < kernelSize; i++) {
                 sum += avals[i] * kvals[koff + i];
             }
-            dstPixels[dstoff] =
-                ((sum < 0.0f) ? 0
-                 : ((sum >= 254.0f) ? shadowRGBs[255]
-                    : shadowRGBs[((jint) sum) + 1]));
+            dstPixels[dstoff] = shadowrgb(shadowRGBs, sum);
             dstoff += dcolinc;
             srcoff += scolinc;
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include <dlfcn.h>
 #include <ft2build.h>
 #include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include FT_FREETYPE_H
 #include FT_OUTLINE_H
@@ -397,6 +398,90 @@ JNIEXPORT jbyteArray JNICALL OS_NATIVE(getBitmapData)(JNIEnv *env, jclass that,
     return result;
 }
 
+#define GM(name) com_sun_javafx_font_freetype_OSFreetype_GLYPH_METRICS_##name
+
+/*
+ * Loads and renders count glyphs of the face with the given load flags and
+ * packs their bitmaps into the atlas, one byte per sample with the row
+ * padding removed. The size and transform of the face must have been set.
+ * Fills GLYPH_METRICS_SIZE values per glyph in metrics and returns the
+ * number of glyphs processed, which is less than count if the atlas is full.
+ */
+JNIEXPORT jint JNICALL OS_NATIVE(rasterizeGlyphs)
+    (JNIEnv *env, jclass that, jlong facePtr, jintArray glyphCodes, jint count,
+     jint loadFlags, jobject atlas, jintArray metrics)
+{
+    if (!facePtr || !glyphCodes || !atlas || !metrics || count <= 0) return 0;
+    if ((*env)->GetArrayLength(env, glyphCodes) < count) return 0;
+    if ((*env)->GetArrayLength(env, metrics) < count * GM(SIZE)) return 0;
+
+    FT_Face face = (FT_Face)facePtr;
+    unsigned char* dst = (*env)->GetDirectBufferAddress(env, atlas);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, atlas);
+    if (!dst || capacity <= 0) return 0;
+
+    jint *codes = NULL, *lpMetrics = NULL;
+    jint done = 0;
+    jlong offset = 0;
+    if ((codes = (*env)->GetIntArrayElements(env, glyphCodes, NULL)) == NULL) goto fail;
+    if ((lpMetrics = (*env)->GetIntArrayElements(env, metrics, NULL)) == NULL) goto fail;
+
+    for (; done < count; done++) {
+        jint* m = lpMetrics + done * GM(SIZE);
+        memset(m, 0, GM(SIZE) * sizeof(jint));
+        m[GM(OFFSET)] = -1;
+
+        FT_Error error = FT_Load_Glyph(face, (FT_UInt)codes[done], (FT_Int32)loadFlags);
+        if (error) {
+            m[GM(ERROR)] = error;
+            continue;
+        }
+        FT_GlyphSlot slot = face->glyph;
+        FT_Bitmap* bitmap = &slot->bitmap;
+        m[GM(PIXEL_MODE)] = bitmap->pixel_mode;
+        m[GM(WIDTH)] = bitmap->width;
+        m[GM(HEIGHT)] = bitmap->rows;
+        m[GM(LEFT)] = slot->bitmap_left;
+        m[GM(TOP)] = slot->bitmap_top;
+        m[GM(ADVANCE_X)] = (jint)slot->advance.x;
+        m[GM(ADVANCE_Y)] = (jint)slot->advance.y;
+        m[GM(LINEAR_ADVANCE)] = (jint)slot->linearHoriAdvance;
+
+        if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY && bitmap->pixel_mode != FT_PIXEL_MODE_LCD) continue;
+        if (!bitmap->buffer || bitmap->pitch <= 0 || bitmap->width == 0 || bitmap->rows == 0) continue;
+        if ((int)bitmap->width > bitmap->pitch) continue;
+
+        jlong size = (jlong)bitmap->width * bitmap->rows;
+        if (size > capacity - offset) {
+            if (offset == 0) {
+                /* Never fits, report it as if the bitmap were not available */
+                continue;
+            }
+            break; /* Leave the glyph to the next batch */
+        }
+        unsigned char* src = bitmap->buffer;
+        unsigned char* out = dst + offset;
+        if (bitmap->pitch == (int)bitmap->width) {
+            memcpy(out, src, (size_t)size);
+        } else {
+            /* Common for LCD glyphs */
+            unsigned int y;
+            for (y = 0; y < bitmap->rows; y++) {
+                memcpy(out, src, bitmap->width);
+                out += bitmap->width;
+                src += bitmap->pitch;
+            }
+        }
+        m[GM(OFFSET)] = (jint)offset;
+        offset += size;
+    }
+
+fail:
+    if (lpMetrics) (*env)->ReleaseIntArrayElements(env, metrics, lpMetrics, 0);
+    if (codes) (*env)->ReleaseIntArrayElements(env, glyphCodes, codes, JNI_ABORT);
+    return done;
+}
+
 JNIEXPORT void JNICALL OS_NATIVE(FT_1Set_1Transform)
     (JNIEnv *env, jclass that, jlong arg0, jobject arg1, jlong arg2, jlong arg3)
 {
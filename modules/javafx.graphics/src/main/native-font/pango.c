@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include <pango/pango.h>
 #include <pango/pangoft2.h>
 #include <dlfcn.h>
+#include <string.h>
 
 #ifdef STATIC_BUILD
 JNIEXPORT jint JNICALL
@@ -231,6 +232,318 @@ fail:
     return result;
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*                           Shaping cache                                */
+/*                                                                        */
+/**************************************************************************/
+
+/*
+ * Text is often laid out again without changes (labels, table cells, ...),
+ * so the result of itemizing and shaping a run is kept in a cache keyed by
+ * the font description, the direction and the UTF-16 text of the run.
+ * The least recently used entry is dropped once the cache is full.
+ */
+#define SHAPE_CACHE_MAX_ENTRIES 1024
+#define SHAPE_CACHE_MAX_TEXT    1024 /* Longer runs are not cached */
+
+typedef struct {
+    gint offset, length, num_chars, num_glyphs;
+    PangoFont *font;
+    jint *glyphs, *widths, *clusters;
+} ShapedItem;
+
+typedef struct {
+    /* key */
+    PangoFontMap *fontmap;
+    gchar *family;
+    jfloat size;
+    jint style, weight;
+    jboolean fallback, rtl;
+    jchar *text;
+    jint text_length;
+    /* value */
+    gint item_count;
+    ShapedItem *items;
+    GList link; /* in shapeCache.lru, most recent first */
+} ShapeEntry;
+
+static struct {
+    GMutex lock;
+    GHashTable *entries;
+    GQueue lru;
+    jlong hits, misses, evictions;
+} shapeCache;
+
+static guint shape_entry_hash(gconstpointer data)
+{
+    const ShapeEntry *entry = data;
+    guint hash = g_str_hash(entry->family);
+    jint i;
+    hash = hash * 31 + (guint)(entry->size * 64);
+    hash = hash * 31 + (guint)entry->style;
+    hash = hash * 31 + (guint)entry->weight;
+    hash = hash * 31 + (entry->fallback ? 2 : 0) + (entry->rtl ? 1 : 0);
+    for (i = 0; i < entry->text_length; i++) {
+        hash = hash * 31 + entry->text[i];
+    }
+    return hash;
+}
+
+static gboolean shape_entry_equal(gconstpointer a, gconstpointer b)
+{
+    const ShapeEntry *e1 = a, *e2 = b;
+    return e1->fontmap == e2->fontmap &&
+           e1->size == e2->size &&
+           e1->style == e2->style &&
+           e1->weight == e2->weight &&
+           e1->fallback == e2->fallback &&
+           e1->rtl == e2->rtl &&
+           e1->text_length == e2->text_length &&
+           memcmp(e1->text, e2->text, e1->text_length * sizeof(jchar)) == 0 &&
+           strcmp(e1->family, e2->family) == 0;
+}
+
+static void shape_entry_free(gpointer data)
+{
+    ShapeEntry *entry = data;
+    gint i;
+    for (i = 0; i < entry->item_count; i++) {
+        ShapedItem *item = &entry->items[i];
+        if (item->font) g_object_unref(item->font);
+        g_free(item->glyphs);
+        g_free(item->widths);
+        g_free(item->clusters);
+    }
+    g_free(entry->items);
+    g_free(entry->family);
+    g_free(entry->text);
+    g_free(entry);
+}
+
+/* Itemizes and shapes the text of the entry, filling its items. */
+static gboolean shape_entry_fill(ShapeEntry *entry)
+{
+    gboolean result = FALSE;
+    PangoContext *context = NULL;
+    PangoFontDescription *desc = NULL;
+    PangoAttrList *attrList = NULL;
+    gchar *str = NULL;
+    GList *runs = NULL, *run;
+    gint i;
+
+    context = pango_font_map_create_context(entry->fontmap);
+    if (!context) goto fail;
+    if (entry->rtl) {
+        pango_context_set_base_dir(context, PANGO_DIRECTION_RTL);
+    }
+    desc = pango_font_description_new();
+    if (!desc) goto fail;
+    pango_font_description_set_family(desc, entry->family);
+    pango_font_description_set_absolute_size(desc, entry->size * PANGO_SCALE);
+    pango_font_description_set_stretch(desc, PANGO_STRETCH_NORMAL);
+    pango_font_description_set_style(desc, (PangoStyle)entry->style);
+    pango_font_description_set_weight(desc, (PangoWeight)entry->weight);
+    attrList = pango_attr_list_new();
+    if (!attrList) goto fail;
+    /* pango_attr_list_unref() also frees the attributes it contains */
+    pango_attr_list_insert(attrList, pango_attr_font_desc_new(desc));
+    if (!entry->fallback) {
+        pango_attr_list_insert(attrList, pango_attr_fallback_new(FALSE));
+    }
+
+    str = g_utf16_to_utf8((const gunichar2 *)entry->text, entry->text_length, NULL, NULL, NULL);
+    if (!str) goto fail;
+    runs = pango_itemize(context, str, 0, (int)strlen(str), attrList, NULL);
+
+    entry->item_count = g_list_length(runs);
+    entry->items = g_new0(ShapedItem, entry->item_count > 0 ? entry->item_count : 1);
+    for (run = runs, i = 0; run != NULL; run = run->next, i++) {
+        PangoItem *pangoItem = run->data;
+        ShapedItem *item = &entry->items[i];
+        const gchar *text = str + pangoItem->offset;
+        PangoGlyphString *glyphString = pango_glyph_string_new();
+        int count, j;
+
+        pango_shape(text, pangoItem->length, &pangoItem->analysis, glyphString);
+        count = glyphString->num_glyphs;
+        if (count > 0 && (size_t)count < INT_MAX / sizeof(jint)) {
+            item->glyphs = g_new(jint, count);
+            item->widths = g_new(jint, count);
+            item->clusters = g_new(jint, count);
+            for (j = 0; j < count; j++) {
+                item->glyphs[j] = glyphString->glyphs[j].glyph;
+                item->widths[j] = glyphString->glyphs[j].geometry.width;
+                /* translate byte index to char index */
+                item->clusters[j] = (jint)g_utf8_pointer_to_offset(text, text + glyphString->log_clusters[j]);
+            }
+            item->num_glyphs = count;
+            item->offset = pangoItem->offset;
+            item->length = pangoItem->length;
+            item->num_chars = pangoItem->num_chars;
+            item->font = pangoItem->analysis.font;
+            if (item->font) g_object_ref(item->font);
+        }
+        pango_glyph_string_free(glyphString);
+        pango_item_free(pangoItem);
+    }
+    result = TRUE;
+
+fail:
+    if (runs) g_list_free(runs);
+    if (str) g_free(str);
+    if (attrList) pango_attr_list_unref(attrList);
+    if (desc) pango_font_description_free(desc);
+    if (context) g_object_unref(context);
+    return result;
+}
+
+static void shape_cache_clear()
+{
+    g_mutex_lock(&shapeCache.lock);
+    if (shapeCache.entries) {
+        g_hash_table_remove_all(shapeCache.entries);
+        g_queue_init(&shapeCache.lru);
+    }
+    g_mutex_unlock(&shapeCache.lock);
+}
+
+static jobject newPangoGlyphString(JNIEnv *env, ShapedItem *item)
+{
+    int count = item->num_glyphs;
+    jobject result = NULL;
+    jintArray glyphsArray = (*env)->NewIntArray(env, count);
+    jintArray widthsArray = (*env)->NewIntArray(env, count);
+    jintArray clusterArray = (*env)->NewIntArray(env, count);
+    if (glyphsArray && widthsArray && clusterArray) {
+        (*env)->SetIntArrayRegion(env, glyphsArray, 0, count, item->glyphs);
+        (*env)->SetIntArrayRegion(env, widthsArray, 0, count, item->widths);
+        (*env)->SetIntArrayRegion(env, clusterArray, 0, count, item->clusters);
+        if ((*env)->ExceptionOccurred(env)) {
+            fprintf(stderr, "OS_NATIVE error: JNI exception");
+            goto fail;
+        }
+        result = (*env)->NewObject(env, PangoGlyphStringFc.clazz, PangoGlyphStringFc.init);
+        if (result) {
+            (*env)->SetIntField(env, result, PangoGlyphStringFc.num_glyphs, count);
+            (*env)->SetObjectField(env, result, PangoGlyphStringFc.glyphs, glyphsArray);
+            (*env)->SetObjectField(env, result, PangoGlyphStringFc.widths, widthsArray);
+            (*env)->SetObjectField(env, result, PangoGlyphStringFc.log_clusters, clusterArray);
+            (*env)->SetIntField(env, result, PangoGlyphStringFc.offset, item->offset);
+            (*env)->SetIntField(env, result, PangoGlyphStringFc.length, item->length);
+            (*env)->SetIntField(env, result, PangoGlyphStringFc.num_chars, item->num_chars);
+            (*env)->SetLongField(env, result, PangoGlyphStringFc.font, (jlong)item->font);
+        }
+    }
+fail:
+    if (glyphsArray) (*env)->DeleteLocalRef(env, glyphsArray);
+    if (widthsArray) (*env)->DeleteLocalRef(env, widthsArray);
+    if (clusterArray) (*env)->DeleteLocalRef(env, clusterArray);
+    return result;
+}
+
+/*
+ * Returns the shaped items of text[start, start + length), using the cache.
+ * Items without glyphs are returned as null. As with pango_shape(), the
+ * fonts of the items are owned by the fontmap.
+ */
+JNIEXPORT jobjectArray JNICALL OS_NATIVE(pango_1shape_1cached)
+    (JNIEnv *env, jclass that, jlong fontmap, jstring family, jfloat size, jint style,
+     jint weight, jboolean fallback, jboolean rtl, jcharArray text, jint start, jint length)
+{
+    if (!fontmap || !family || !text || start < 0 || length <= 0) return NULL;
+    if (start > (*env)->GetArrayLength(env, text) - length) return NULL;
+    if (!PangoGlyphStringFc.cached) cachePangoGlyphStringFields(env);
+    if (!PangoGlyphStringFc.cached) return NULL;
+
+    ShapeEntry *entry = g_new0(ShapeEntry, 1);
+    const char *familyUTF = (*env)->GetStringUTFChars(env, family, NULL);
+    if (!familyUTF) {
+        g_free(entry);
+        return NULL;
+    }
+    entry->fontmap = (PangoFontMap *)fontmap;
+    entry->family = g_strdup(familyUTF);
+    (*env)->ReleaseStringUTFChars(env, family, familyUTF);
+    entry->size = size;
+    entry->style = style;
+    entry->weight = weight;
+    entry->fallback = fallback;
+    entry->rtl = rtl;
+    entry->text = g_new(jchar, length);
+    entry->text_length = length;
+    (*env)->GetCharArrayRegion(env, text, start, length, entry->text);
+    entry->link.data = entry;
+
+    g_mutex_lock(&shapeCache.lock);
+    if (!shapeCache.entries) {
+        shapeCache.entries = g_hash_table_new_full(shape_entry_hash, shape_entry_equal, NULL, shape_entry_free);
+        g_queue_init(&shapeCache.lru);
+    }
+    ShapeEntry *cached = g_hash_table_lookup(shapeCache.entries, entry);
+    if (cached) {
+        shapeCache.hits++;
+        g_queue_unlink(&shapeCache.lru, &cached->link);
+        g_queue_push_head_link(&shapeCache.lru, &cached->link);
+        shape_entry_free(entry);
+        entry = cached;
+    } else {
+        shapeCache.misses++;
+        if (!shape_entry_fill(entry)) {
+            g_mutex_unlock(&shapeCache.lock);
+            shape_entry_free(entry);
+            return NULL;
+        }
+        if (length <= SHAPE_CACHE_MAX_TEXT) {
+            while (g_hash_table_size(shapeCache.entries) >= SHAPE_CACHE_MAX_ENTRIES) {
+                ShapeEntry *oldest = g_queue_peek_tail(&shapeCache.lru);
+                g_queue_unlink(&shapeCache.lru, &oldest->link);
+                g_hash_table_remove(shapeCache.entries, oldest);
+                shapeCache.evictions++;
+            }
+            g_hash_table_add(shapeCache.entries, entry);
+            g_queue_push_head_link(&shapeCache.lru, &entry->link);
+        } else {
+            entry->link.data = NULL; /* Not cached, freed below */
+        }
+    }
+
+    /* Build the result while the entry is known to be alive */
+    jobjectArray result = (*env)->NewObjectArray(env, entry->item_count, PangoGlyphStringFc.clazz, NULL);
+    if (result) {
+        gint i;
+        for (i = 0; i < entry->item_count; i++) {
+            if (entry->items[i].num_glyphs > 0) {
+                jobject glyphString = newPangoGlyphString(env, &entry->items[i]);
+                if (!glyphString) {
+                    result = NULL;
+                    break;
+                }
+                (*env)->SetObjectArrayElement(env, result, i, glyphString);
+                (*env)->DeleteLocalRef(env, glyphString);
+            }
+        }
+    }
+    if (!entry->link.data) shape_entry_free(entry);
+    g_mutex_unlock(&shapeCache.lock);
+    return result;
+}
+
+/* Fills stats with the hits, misses, evictions and size of the shaping cache. */
+JNIEXPORT void JNICALL OS_NATIVE(pango_1shape_1cache_1stats)
+    (JNIEnv *env, jclass that, jlongArray stats)
+{
+    jlong values[4];
+    if (!stats || (*env)->GetArrayLength(env, stats) < 4) return;
+    g_mutex_lock(&shapeCache.lock);
+    values[0] = shapeCache.hits;
+    values[1] = shapeCache.misses;
+    values[2] = shapeCache.evictions;
+    values[3] = shapeCache.entries ? g_hash_table_size(shapeCache.entries) : 0;
+    g_mutex_unlock(&shapeCache.lock);
+    (*env)->SetLongArrayRegion(env, stats, 0, 4, values);
+}
+
 JNIEXPORT jstring JNICALL OS_NATIVE(pango_1font_1description_1get_1family)
     (JNIEnv *env, jclass that, jlong arg0)
 {
@@ -267,6 +580,10 @@ JNIEXPORT jboolean JNICALL OS_NATIVE(FcConfigAppFontAddFile)
             if (fp) {
                 rc = (jboolean)((int (*)(void *, const char *))fp)((void *)arg0, text);
             }
+            if (rc) {
+                /* The new font can change how cached runs are shaped */
+                shape_cache_clear();
+            }
             (*env)->ReleaseStringUTFChars(env, arg1, text);
         }
     }
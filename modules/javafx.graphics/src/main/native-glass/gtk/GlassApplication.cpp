@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,7 @@
 
 #include "glass_general.h"
 #include "glass_evloop.h"
+#include "glass_runqueue.h"
 #include "glass_dnd.h"
 #include "glass_window.h"
 #include "glass_screen.h"
@@ -52,28 +53,6 @@ PlatformSupport* platformSupport = NULL;
 
 extern gboolean disableGrab;
 
-static gboolean call_runnable (gpointer data)
-{
-    RunnableContext* context = reinterpret_cast<RunnableContext*>(data);
-
-    JNIEnv *env;
-    int envStatus = javaVM->GetEnv((void **)&env, JNI_VERSION_1_6);
-    if (envStatus == JNI_EDETACHED) {
-        javaVM->AttachCurrentThread((void **)&env, NULL);
-    }
-
-    env->CallVoidMethod(context->runnable, jRunnableRun, NULL);
-    LOG_EXCEPTION(env);
-    env->DeleteGlobalRef(context->runnable);
-    free(context);
-
-    if (envStatus == JNI_EDETACHED) {
-        javaVM->DetachCurrentThread();
-    }
-
-    return FALSE;
-}
-
 static void call_update_preferences()
 {
     if (platformSupport) {
@@ -267,6 +246,18 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1terminateLoop
 
     gtk_main_quit();
 
+    if (gtk_verbose) {
+        GlassRunQueueStats stats;
+        glass_runqueue_get_stats(&stats);
+        fprintf(stdout, "Glass GTK invokeLater: %" G_GINT64_FORMAT " runnables in %" G_GINT64_FORMAT
+                " batches, max queue depth %" G_GINT64_FORMAT ", latency avg %" G_GINT64_FORMAT
+                " us max %" G_GINT64_FORMAT " us\n",
+                stats.dispatched, stats.batches, stats.max_depth,
+                stats.dispatched > 0 ? stats.total_latency / stats.dispatched : 0,
+                stats.max_latency);
+        fflush(stdout);
+    }
+
     if (platformSupport) {
         delete platformSupport;
         platformSupport = NULL;
@@ -283,14 +274,7 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1submitForLater
 {
     (void)obj;
 
-    RunnableContext* context = (RunnableContext*)malloc(sizeof(RunnableContext));
-    if (context != NULL) {
-        context->runnable = env->NewGlobalRef(runnable);
-        gdk_threads_add_idle_full(G_PRIORITY_HIGH_IDLE + 30, call_runnable, context, NULL);
-        // we release this context in call_runnable
-    } else {
-        fprintf(stderr, "malloc failed in GtkApplication__1submitForLaterInvocation\n");
-    }
+    glass_runqueue_submit(env, runnable);
 }
 
 /*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -175,13 +175,34 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1scheduleRepaint
     (void)ptr;
 }
 
+// Prism never reports more than 15 dirty regions, more are presented as a
+// full update.
+#define MAX_DIRTY_RECTS 16
+
+static jint get_dirty_rects(JNIEnv *env, jintArray jrects, jint count, jint *rects)
+{
+    if (!jrects || count <= 0 || count > MAX_DIRTY_RECTS) {
+        return 0;
+    }
+    if (env->GetArrayLength(jrects) < 4 * count) {
+        return 0;
+    }
+    env->GetIntArrayRegion(jrects, 0, 4 * count, rects);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return 0;
+    }
+    return count;
+}
+
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsDirect
- * Signature: (JLjava/nio/Buffer;II)V
+ * Signature: (JLjava/nio/Buffer;II[II)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
-(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height)
+(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height,
+        jintArray jrects, jint jrectCount)
 {
     (void)jView;
 
@@ -190,19 +211,22 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
 
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
+        jint rects[4 * MAX_DIRTY_RECTS];
+        jint nrects = get_dirty_rects(env, jrects, jrectCount, rects);
         void *data = env->GetDirectBufferAddress(buffer);
 
-        view->current_window->paint(data, width, height);
+        view->current_window->paint(data, width, height, rects, nrects);
     }
 }
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsIntArray
- * Signature:  (J[IIII)V
+ * Signature:  (J[IIII[II)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
-  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height,
+        jintArray jrects, jint jrectCount)
 {
     (void)obj;
 
@@ -223,10 +247,12 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
 
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
+        jint rects[4 * MAX_DIRTY_RECTS];
+        jint nrects = get_dirty_rects(env, jrects, jrectCount, rects);
         int *data = NULL;
         data = (int*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height, rects, nrects);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -235,10 +261,11 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsByteArray
- * Signature:  (J[BIII)V
+ * Signature:  (J[BIII[II)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
-  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height,
+        jintArray jrects, jint jrectCount)
 {
     (void)obj;
 
@@ -259,11 +286,13 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
 
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
+        jint rects[4 * MAX_DIRTY_RECTS];
+        jint nrects = get_dirty_rects(env, jrects, jrectCount, rects);
         unsigned char *data = NULL;
 
         data = (unsigned char*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height, rects, nrects);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#include "glass_runqueue.h"
+#include "glass_general.h"
+
+#include <gdk/gdk.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <new>
+
+// The longest time a single dispatch keeps running runnables before it
+// yields to the other sources of the main loop, in microseconds.
+#define RUNQUEUE_BATCH_BUDGET 5000
+
+typedef struct _RunQueueNode {
+    std::atomic<struct _RunQueueNode *> next;
+    jobject runnable;
+    gint64 submit_time;
+} RunQueueNode;
+
+/*
+ * Intrusive multiple producer, single consumer queue. Producers only touch
+ * head, the main loop thread is the only consumer and owns tail.
+ */
+static RunQueueNode stub;
+static std::atomic<RunQueueNode *> head(&stub);
+static RunQueueNode *tail = &stub;
+
+// Set while an idle source that will drain the queue is attached.
+static std::atomic<bool> scheduled(false);
+
+static std::atomic<gint64> depth(0);
+static std::atomic<gint64> max_depth(0);
+static gint64 dispatched;
+static gint64 batches;
+static gint64 total_latency;
+static gint64 max_latency;
+
+static void push(RunQueueNode *node)
+{
+    node->next.store(NULL, std::memory_order_relaxed);
+    RunQueueNode *prev = head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+}
+
+// Returns NULL if the queue is empty, or if a producer is in the middle of
+// a push; the node will be returned by a later call in that case.
+static RunQueueNode *pop()
+{
+    RunQueueNode *t = tail;
+    RunQueueNode *next = t->next.load(std::memory_order_acquire);
+    if (t == &stub) {
+        if (next == NULL) {
+            return NULL;
+        }
+        tail = t = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next != NULL) {
+        tail = next;
+        return t;
+    }
+    if (t != head.load(std::memory_order_acquire)) {
+        return NULL;
+    }
+    push(&stub);
+    next = t->next.load(std::memory_order_acquire);
+    if (next != NULL) {
+        tail = next;
+        return t;
+    }
+    return NULL;
+}
+
+static bool is_empty()
+{
+    return tail == head.load(std::memory_order_acquire)
+            && tail->next.load(std::memory_order_acquire) == NULL;
+}
+
+static gboolean drain_runqueue(gpointer data)
+{
+    (void)data;
+
+    // This source is not dispatched recursively, so a runnable which enters
+    // a nested event loop needs another one for the runnables behind it.
+    scheduled.store(false, std::memory_order_seq_cst);
+    batches++;
+
+    JNIEnv *env;
+    int envStatus = javaVM->GetEnv((void **)&env, JNI_VERSION_1_6);
+    if (envStatus == JNI_EDETACHED) {
+        javaVM->AttachCurrentThread((void **)&env, NULL);
+    }
+
+    gint64 start = g_get_monotonic_time();
+    gint64 now = start;
+    RunQueueNode *node;
+    while (now - start < RUNQUEUE_BATCH_BUDGET && (node = pop()) != NULL) {
+        depth.fetch_sub(1, std::memory_order_relaxed);
+
+        gint64 latency = now - node->submit_time;
+        total_latency += latency;
+        if (latency > max_latency) {
+            max_latency = latency;
+        }
+        dispatched++;
+
+        // Attach that source before the runnable, whether the runnables
+        // behind it were queued before this batch or are submitted later.
+        if (!is_empty() && !scheduled.exchange(true, std::memory_order_seq_cst)) {
+            gdk_threads_add_idle_full(G_PRIORITY_HIGH_IDLE + 30, drain_runqueue, NULL, NULL);
+        }
+
+        env->CallVoidMethod(node->runnable, jRunnableRun, NULL);
+        LOG_EXCEPTION(env);
+        env->DeleteGlobalRef(node->runnable);
+        delete node;
+
+        now = g_get_monotonic_time();
+    }
+
+    if (envStatus == JNI_EDETACHED) {
+        javaVM->DetachCurrentThread();
+    }
+
+    // Keep this source if the budget ran out, unless another one was
+    // attached by a producer in the meantime.
+    if (!is_empty() && !scheduled.exchange(true, std::memory_order_seq_cst)) {
+        return TRUE;
+    }
+    return FALSE;
+}
+
+void glass_runqueue_submit(JNIEnv *env, jobject runnable)
+{
+    RunQueueNode *node = new (std::nothrow) RunQueueNode;
+    if (node == NULL) {
+        fprintf(stderr, "allocation failed in glass_runqueue_submit\n");
+        return;
+    }
+    node->runnable = env->NewGlobalRef(runnable);
+    node->submit_time = g_get_monotonic_time();
+
+    gint64 d = depth.fetch_add(1, std::memory_order_relaxed) + 1;
+    gint64 m = max_depth.load(std::memory_order_relaxed);
+    while (d > m && !max_depth.compare_exchange_weak(m, d, std::memory_order_relaxed)) {
+    }
+
+    push(node);
+
+    if (!scheduled.exchange(true, std::memory_order_seq_cst)) {
+        gdk_threads_add_idle_full(G_PRIORITY_HIGH_IDLE + 30, drain_runqueue, NULL, NULL);
+    }
+}
+
+void glass_runqueue_get_stats(GlassRunQueueStats *stats)
+{
+    stats->depth = depth.load(std::memory_order_relaxed);
+    stats->max_depth = max_depth.load(std::memory_order_relaxed);
+    stats->dispatched = dispatched;
+    stats->batches = batches;
+    stats->total_latency = total_latency;
+    stats->max_latency = max_latency;
+}
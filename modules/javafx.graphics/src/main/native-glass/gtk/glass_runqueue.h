@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#ifndef GLASS_RUNQUEUE_H
+#define GLASS_RUNQUEUE_H
+
+#include <glib.h>
+#include <jni.h>
+
+/*
+ * Queue of runnables submitted with Application.invokeLater().
+ *
+ * Any thread may submit runnables, they are run on the main loop thread by
+ * a single idle source that is only attached while the queue is not empty.
+ * Each dispatch runs the runnables in a batch until the queue is drained or
+ * the time budget of the batch is spent, so that a flood of submissions
+ * does not starve the other sources of the main loop.
+ */
+
+typedef struct {
+    gint64 depth;           // runnables currently in the queue
+    gint64 max_depth;       // largest depth observed
+    gint64 dispatched;      // runnables run so far
+    gint64 batches;         // dispatches of the idle source
+    gint64 total_latency;   // sum of submit to run latencies, in microseconds
+    gint64 max_latency;     // largest submit to run latency, in microseconds
+} GlassRunQueueStats;
+
+void glass_runqueue_submit(JNIEnv *env, jobject runnable);
+void glass_runqueue_get_stats(GlassRunQueueStats *stats);
+
+#endif
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#include "glass_shm.h"
+
+#include <gdk/gdkx.h>
+#include <X11/Xutil.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <string.h>
+
+ShmImage::ShmImage()
+        : display(NULL),
+          image(NULL),
+          gc(NULL),
+          gc_drawable(None),
+          disabled(false) {
+    shminfo.shmseg = 0;
+    shminfo.shmid = -1;
+    shminfo.shmaddr = NULL;
+    shminfo.readOnly = True;
+}
+
+ShmImage::~ShmImage() {
+    release_image();
+    if (gc) {
+        XFreeGC(display, gc);
+        gc = NULL;
+    }
+}
+
+void ShmImage::release_image() {
+    if (image) {
+        XShmDetach(display, &shminfo);
+        XDestroyImage(image);
+        image = NULL;
+    }
+    if (shminfo.shmaddr) {
+        shmdt(shminfo.shmaddr);
+        shminfo.shmaddr = NULL;
+    }
+    shminfo.shmid = -1;
+}
+
+bool ShmImage::ensure_image(Display* dpy, Visual* visual, int depth, int width, int height) {
+    if (image && image->width == width && image->height == height
+            && image->depth == depth) {
+        return true;
+    }
+    release_image();
+
+    image = XShmCreateImage(dpy, visual, depth, ZPixmap, NULL, &shminfo, width, height);
+    if (!image) {
+        return false;
+    }
+
+    // The pixels are copied row by row, so the image must have the same
+    // layout as the ARGB32 data cairo would otherwise read.
+    int native_order = (G_BYTE_ORDER == G_LITTLE_ENDIAN) ? LSBFirst : MSBFirst;
+    if (image->bits_per_pixel != 32 || image->byte_order != native_order) {
+        XDestroyImage(image);
+        image = NULL;
+        return false;
+    }
+
+    shminfo.shmid = shmget(IPC_PRIVATE, (size_t) image->bytes_per_line * height, IPC_CREAT | 0600);
+    if (shminfo.shmid < 0) {
+        XDestroyImage(image);
+        image = NULL;
+        return false;
+    }
+    shminfo.shmaddr = image->data = (char*) shmat(shminfo.shmid, NULL, 0);
+    if (shminfo.shmaddr == (char*) -1) {
+        shmctl(shminfo.shmid, IPC_RMID, NULL);
+        shminfo.shmaddr = NULL;
+        image->data = NULL;
+        XDestroyImage(image);
+        image = NULL;
+        return false;
+    }
+
+    // XShmAttach fails asynchronously when the server is remote.
+    gdk_error_trap_push();
+    Status attached = XShmAttach(dpy, &shminfo);
+    XSync(dpy, False);
+    bool failed = gdk_error_trap_pop() || !attached;
+
+    // The segment is destroyed as soon as both sides have detached.
+    shmctl(shminfo.shmid, IPC_RMID, NULL);
+
+    if (failed) {
+        image->data = NULL;
+        XDestroyImage(image);
+        image = NULL;
+        shmdt(shminfo.shmaddr);
+        shminfo.shmaddr = NULL;
+        return false;
+    }
+    return true;
+}
+
+bool ShmImage::put(GdkWindow* window, void* data, jint width, jint height, const cairo_region_t* region) {
+    if (disabled) {
+        return false;
+    }
+
+    Display* dpy = GDK_DISPLAY_XDISPLAY(gdk_window_get_display(window));
+    if (display == NULL) {
+        int major, minor;
+        Bool pixmaps;
+        if (!XShmQueryVersion(dpy, &major, &minor, &pixmaps)) {
+            disabled = true;
+            return false;
+        }
+        display = dpy;
+    }
+
+    GdkVisual* gdk_visual = gdk_window_get_visual(window);
+    Visual* visual = gdk_x11_visual_get_xvisual(gdk_visual);
+    if (dpy != display
+            || gdk_window_get_scale_factor(window) != 1
+            || visual->red_mask != 0xff0000
+            || visual->green_mask != 0xff00
+            || visual->blue_mask != 0xff) {
+        return false;
+    }
+
+    if (!ensure_image(dpy, visual, gdk_visual_get_depth(gdk_visual), width, height)) {
+        disabled = true;
+        return false;
+    }
+
+    Drawable drawable = GDK_WINDOW_XID(window);
+    if (gc == NULL || gc_drawable != drawable) {
+        if (gc) {
+            XFreeGC(display, gc);
+        }
+        gc = XCreateGC(display, drawable, 0, NULL);
+        gc_drawable = drawable;
+    }
+
+    const unsigned char* src = (const unsigned char*) data;
+    int n = cairo_region_num_rectangles(region);
+    for (int i = 0; i < n; i++) {
+        cairo_rectangle_int_t r;
+        cairo_region_get_rectangle(region, i, &r);
+        for (int y = r.y; y < r.y + r.height; y++) {
+            memcpy(image->data + (size_t) y * image->bytes_per_line + r.x * 4,
+                   src + ((size_t) y * width + r.x) * 4,
+                   (size_t) r.width * 4);
+        }
+        XShmPutImage(display, drawable, gc, image,
+                     r.x, r.y, r.x, r.y, r.width, r.height, False);
+    }
+
+    // The segment is reused for the next frame, wait for the server to
+    // finish reading from it.
+    XSync(display, False);
+    return true;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#ifndef GLASS_SHM_H
+#define GLASS_SHM_H
+
+#include <gdk/gdk.h>
+#include <cairo.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/XShm.h>
+
+#include <jni.h>
+
+/*
+ * An XImage backed by a MIT-SHM segment, used to present the pixels of a
+ * view without sending them through the X11 socket.
+ *
+ * Only the rectangles of the damage region are copied into the segment,
+ * the server then reads them directly from shared memory.
+ */
+class ShmImage {
+    Display* display;
+    XImage* image;
+    XShmSegmentInfo shminfo;
+    GC gc;
+    Drawable gc_drawable;
+    bool disabled;
+
+    bool ensure_image(Display*, Visual*, int depth, int width, int height);
+    void release_image();
+public:
+    ShmImage();
+    ~ShmImage();
+
+    /*
+     * Copies the region of the ARGB32 premultiplied data to the window.
+     * Returns false if MIT-SHM cannot be used for this window, in which case
+     * nothing was drawn and the caller should fall back to cairo.
+     */
+    bool put(GdkWindow*, void* data, jint width, jint height, const cairo_region_t*);
+};
+
+#endif
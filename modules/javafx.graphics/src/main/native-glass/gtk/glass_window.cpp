@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -514,10 +514,33 @@ void WindowContextBase::process_key(GdkEventKey* event) {
     }
 }
 
-void WindowContextBase::paint(void* data, jint width, jint height) {
-#ifdef GLASS_GTK3
+void WindowContextBase::paint(void* data, jint width, jint height, const jint* rects, jint nrects) {
     cairo_rectangle_int_t rect = {0, 0, width, height};
-    cairo_region_t *region = cairo_region_create_rectangle(&rect);
+    cairo_region_t *region;
+    if (nrects > 0) {
+        region = cairo_region_create();
+        for (jint i = 0; i < nrects; i++) {
+            cairo_rectangle_int_t r = {rects[4 * i], rects[4 * i + 1], rects[4 * i + 2], rects[4 * i + 3]};
+            cairo_region_union_rectangle(region, &r);
+        }
+        cairo_region_intersect_rectangle(region, &rect);
+    } else {
+        region = cairo_region_create_rectangle(&rect);
+    }
+
+    if (cairo_region_is_empty(region)) {
+        cairo_region_destroy(region);
+        return;
+    }
+
+    applyShapeMask(data, width, height);
+
+    if (shm_image.put(gdk_window, data, width, height, region)) {
+        cairo_region_destroy(region);
+        return;
+    }
+
+#ifdef GLASS_GTK3
     gdk_window_begin_paint_region(gdk_window, region);
 #endif
     cairo_t* context = gdk_cairo_create(gdk_window);
@@ -528,7 +551,8 @@ void WindowContextBase::paint(void* data, jint width, jint height) {
             CAIRO_FORMAT_ARGB32,
             width, height, width * 4);
 
-    applyShapeMask(data, width, height);
+    gdk_cairo_region(context, region);
+    cairo_clip(context);
 
     cairo_set_source_surface(context, cairo_surface, 0, 0);
     cairo_set_operator(context, CAIRO_OPERATOR_SOURCE);
@@ -536,8 +560,8 @@ void WindowContextBase::paint(void* data, jint width, jint height) {
 
 #ifdef GLASS_GTK3
     gdk_window_end_paint(gdk_window);
-    cairo_region_destroy(region);
 #endif
+    cairo_region_destroy(region);
 
     cairo_destroy(context);
     cairo_surface_destroy(cairo_surface);
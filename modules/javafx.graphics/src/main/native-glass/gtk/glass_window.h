@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@
 #include "DeletedMemDebug.h"
 
 #include "glass_view.h"
+#include "glass_shm.h"
 
 enum WindowManager {
     COMPIZ,
@@ -101,7 +102,12 @@ public:
     virtual bool filterIME(GdkEvent *) = 0;
     virtual void enableOrResetIME() = 0;
     virtual void disableIME() = 0;
-    virtual void paint(void* data, jint width, jint height) = 0;
+    /*
+     * Presents the pixels of the view. rects holds nrects (x, y, width,
+     * height) quadruples of the regions that changed since the previous
+     * call, all of the pixels are presented if nrects is 0.
+     */
+    virtual void paint(void* data, jint width, jint height, const jint* rects, jint nrects) = 0;
     virtual WindowFrameExtents get_frame_extents() = 0;
 
     virtual void enter_fullscreen() = 0;
@@ -176,6 +182,8 @@ class WindowContextBase: public WindowContext {
 
     size_t events_processing_cnt;
     bool can_be_deleted;
+
+    ShmImage shm_image;
 protected:
     std::set<WindowContextTop*> children;
     jobject jwindow;
@@ -213,7 +221,7 @@ public:
     bool filterIME(GdkEvent *);
     void enableOrResetIME();
     void disableIME();
-    void paint(void*, jint, jint);
+    void paint(void*, jint, jint, const jint*, jint);
     GdkWindow *get_gdk_window();
     jobject get_jwindow();
     jobject get_jview();
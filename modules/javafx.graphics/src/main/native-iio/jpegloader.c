@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1610,6 +1610,18 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
         (PTR) = NULL;     \
     }
 
+/*
+ * Scanlines are decoded into a native buffer in batches of up to
+ * ROW_BATCH_BYTES (and at most MAX_BATCH_ROWS rows), and each batch is
+ * copied to the Java array under a single pin. When progress is reported,
+ * it is reported at most PROGRESS_STEPS times per image rather than once
+ * per scanline, since every report has to unpin and re-pin the input
+ * arrays around the Java upcall.
+ */
+#define ROW_BATCH_BYTES (64 * 1024)
+#define MAX_BATCH_ROWS  64
+#define PROGRESS_STEPS  100
+
 JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressIndirect
 (JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jbyteArray barray) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
@@ -1618,7 +1630,12 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
     sun_jpeg_error_ptr jerr;
     int bytes_per_row = cinfo->output_width * cinfo->output_components;
     int offset = 0;
+    int batch_rows;
+    int i;
+    JDIMENSION progress_step;
+    JDIMENSION next_progress = 0;
     JSAMPROW scanline_ptr = NULL;
+    JSAMPROW rows[MAX_BATCH_ROWS];
 
     if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
         !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
@@ -1631,6 +1648,25 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
+    progress_step = cinfo->output_height / PROGRESS_STEPS;
+    if (progress_step == 0) {
+        progress_step = 1;
+    }
+
+    batch_rows = ROW_BATCH_BYTES / bytes_per_row;
+    if (batch_rows > MAX_BATCH_ROWS) {
+        batch_rows = MAX_BATCH_ROWS;
+    }
+    if (report_progress == JNI_TRUE && batch_rows > (int) progress_step) {
+        batch_rows = progress_step;
+    }
+    if (batch_rows > (int) cinfo->output_height) {
+        batch_rows = cinfo->output_height;
+    }
+    if (batch_rows < 1) {
+        batch_rows = 1;
+    }
+
     if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
         ThrowByName(env,
                 "java/io/IOException",
@@ -1655,7 +1691,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
-    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * sizeof(JSAMPLE));
+    scanline_ptr = (JSAMPROW) malloc(batch_rows * bytes_per_row * sizeof(JSAMPLE));
     if (scanline_ptr == NULL) {
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
         ThrowByName(env,
@@ -1663,10 +1699,18 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                 "Reading JPEG Stream");
         return JNI_FALSE;
     }
+    for (i = 0; i < batch_rows; i++) {
+        rows[i] = scanline_ptr + i * bytes_per_row;
+    }
 
     while (cinfo->output_scanline < cinfo->output_height) {
-        int num_scanlines;
-        if (report_progress == JNI_TRUE) {
+        int num_scanlines = 0;
+        int max_scanlines = cinfo->output_height - cinfo->output_scanline;
+        if (max_scanlines > batch_rows) {
+            max_scanlines = batch_rows;
+        }
+
+        if (report_progress == JNI_TRUE && cinfo->output_scanline >= next_progress) {
             RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
             (*env)->CallVoidMethod(env, this,
                     JPEGImageLoader_updateImageProgressID,
@@ -1682,10 +1726,20 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                           "Array pin failed");
                 return JNI_FALSE;
             }
+            next_progress = cinfo->output_scanline + progress_step;
+        }
+
+        /* jpeg_read_scanlines returns at most one row group per call */
+        while (num_scanlines < max_scanlines) {
+            int n = jpeg_read_scanlines(cinfo, rows + num_scanlines,
+                                        max_scanlines - num_scanlines);
+            if (n == 0) {
+                break;
+            }
+            num_scanlines += n;
         }
 
-        num_scanlines = jpeg_read_scanlines(cinfo, &scanline_ptr, 1);
-        if (num_scanlines == 1) {
+        if (num_scanlines > 0) {
             jbyte *body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
             if (body == NULL) {
                 RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
@@ -1693,9 +1747,9 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                 SAFE_FREE(scanline_ptr);
                 return JNI_FALSE;
             }
-            memcpy(body+offset,scanline_ptr, bytes_per_row);
+            memcpy(body+offset, scanline_ptr, num_scanlines * bytes_per_row);
             (*env)->ReleasePrimitiveArrayCritical(env, barray, body, JNI_ABORT);
-            offset += bytes_per_row;
+            offset += num_scanlines * bytes_per_row;
         }
     }
     SAFE_FREE(scanline_ptr);
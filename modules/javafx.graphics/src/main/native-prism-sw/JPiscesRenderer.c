@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 
 #include <PiscesBlit.h>
 #include <PiscesSysutils.h>
+#include <PiscesTiles.h>
 
 #include <PiscesRenderer.inl>
 
@@ -141,6 +142,19 @@ Java_com_sun_pisces_PiscesRenderer_setCompositeRuleImpl(JNIEnv* env,
     }
 }
 
+JNIEXPORT void JNICALL
+Java_com_sun_pisces_PiscesRenderer_setThreadCountImpl(JNIEnv* env,
+    jobject objectHandle,
+    jint threadCount)
+{
+    Renderer* rdr;
+    rdr = (Renderer*)JLongToPointer(
+              (*env)->GetLongField(env, objectHandle,
+                                   fieldIds[RENDERER_NATIVE_PTR]));
+
+    tiles_setThreadCount(rdr, threadCount);
+}
+
 JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_clearRectImpl(JNIEnv* env, jobject objectHandle,
         jint x, jint y, jint w, jint h) {
     Renderer* rdr;
@@ -368,6 +382,60 @@ toPiscesCoords(unsigned int ff) {
     return (int)gg;
 }
 
+/*
+ * Rows of a rectangle being filled by fillRect(). The first and the last
+ * row are partially covered when tfrac and bfrac are not zero.
+ */
+typedef struct _RectRows {
+    jint x_from;
+    jint y_from, y_to;
+    jint tfrac, bfrac;
+    jint surfaceWidth;
+} RectRows;
+
+/*
+ * Emits rows minY..maxY of the rectangle, in runs of up to NUM_ALPHA_ROWS
+ * fully covered rows.
+ */
+static void
+emitRectRows(Renderer* rdr, jint minY, jint maxY, void* data)
+{
+    RectRows* rect = (RectRows*)data;
+    jint lastFullRow = (rect->bfrac) ? rect->y_to - 1 : rect->y_to;
+    jint y = minY;
+
+    while (y <= maxY) {
+        jint rows, frac;
+
+        if (y == rect->y_from && rect->tfrac) {
+            // fractional top line
+            rows = 1;
+            frac = rect->tfrac;
+        } else if (y == rect->y_to && rect->bfrac) {
+            // fractional bottom line
+            rows = 1;
+            frac = rect->bfrac;
+        } else {
+            rows = MIN(MIN(maxY, lastFullRow) - y + 1, NUM_ALPHA_ROWS);
+            frac = 0x10000;
+        }
+
+        rdr->_currX = rect->x_from;
+        rdr->_currY = y;
+        rdr->_currImageOffset = y * rect->surfaceWidth;
+        rdr->_rowNum = y - rect->y_from;
+
+        if (rdr->_genPaint) {
+            size_t l = rdr->_alphaWidth * rows;
+            ALLOC3(rdr->_paint, jint, l);
+            rdr->_genPaint(rdr, rows);
+        }
+        rdr->_emitLine(rdr, rows, frac);
+
+        y += rows;
+    }
+}
+
 static void
 fillRect(JNIEnv *env, jobject this, Renderer* rdr,
     jint x, jint y, jint w, jint h,
@@ -377,7 +445,7 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
     jobject surfaceHandle;
     jint x_from, x_to, y_from, y_to;
     jint lfrac, rfrac, tfrac, bfrac;
-    jint rows_to_render_by_loop, rows_being_rendered;
+    RectRows rect;
 
     lfrac = (0x10000 - (x & 0xFFFF)) & 0xFFFF;
     rfrac = (x + w) & 0xFFFF;
@@ -453,8 +521,6 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
     }
 
     if ((x_from <= x_to) && (y_from <= y_to)) {
-        rows_to_render_by_loop = y_to - y_from + 1;
-
         SURFACE_FROM_RENDERER(surface, env, surfaceHandle, this);
         ACQUIRE_SURFACE(surface, env, surfaceHandle);
         INVALIDATE_RENDERER_SURFACE(rdr);
@@ -470,7 +536,6 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
         rdr->_currImageOffset = y_from * surface->width;
         rdr->_imageScanlineStride = surface->width;
         rdr->_imagePixelStride = 1;
-        rdr->_rowNum = 0;
 
         if (y_from == y_to && (tfrac | bfrac)) {
             // rendering single horizontal fractional line bfrac > (y & 0xFFFF)
@@ -486,52 +551,17 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
         rdr->_el_lfrac = lfrac;
         rdr->_el_rfrac = rfrac;
 
-        if (bfrac) {
-            // one "full" line less -> will be rendered at the end
-            rows_to_render_by_loop--;
-        }
-
-        // emit fractional top line
-        if (tfrac) {
-            if (rdr->_genPaint) {
-                size_t l = (x_to - x_from + 1);
-                ALLOC3(rdr->_paint, jint, l);
-                rdr->_genPaint(rdr, 1);
-            }
-            rdr->_emitLine(rdr, 1, tfrac);
-            rows_to_render_by_loop--;
-            rdr->_currX = x_from;
-            rdr->_currY++;
-            rdr->_currImageOffset = rdr->_currY * surface->width;
-            rdr->_rowNum++;
-        }
-
-        // emit "full" lines that are in the middle
-        while (rows_to_render_by_loop > 0) {
-            rows_being_rendered = MIN(rows_to_render_by_loop, NUM_ALPHA_ROWS);
-
-            if (rdr->_genPaint) {
-                size_t l = (x_to - x_from + 1) * rows_being_rendered;
-                ALLOC3(rdr->_paint, jint, l);
-                rdr->_genPaint(rdr, rows_being_rendered);
-            }
-            rdr->_emitLine(rdr, rows_being_rendered, 0x10000);
-
-            rows_to_render_by_loop -= rows_being_rendered;
-            rdr->_currX = x_from;
-            rdr->_currY += rows_being_rendered;
-            rdr->_currImageOffset = rdr->_currY * surface->width;
-            rdr->_rowNum += rows_being_rendered;
-        }
+        rect.x_from = x_from;
+        rect.y_from = y_from;
+        rect.y_to = y_to;
+        rect.tfrac = tfrac;
+        rect.bfrac = bfrac;
+        rect.surfaceWidth = surface->width;
 
-        // emit fractional bottom line
-        if (bfrac) {
-            if (rdr->_genPaint) {
-                size_t l = (x_to - x_from + 1);
-                ALLOC3(rdr->_paint, jint, l);
-                rdr->_genPaint(rdr, 1);
-            }
-            rdr->_emitLine(rdr, 1, bfrac);
+        if (!tiles_render(rdr, y_from, y_to, rdr->_alphaWidth,
+                          emitRectRows, &rect))
+        {
+            emitRectRows(rdr, y_from, y_to, &rect);
         }
         RELEASE_SURFACE(surface, env, surfaceHandle);
 
@@ -785,11 +815,53 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_fillLCDAlphaMaskImpl
         x, y, maskWidth, maskHeight, maskOffset, stride);
 }
 
+/*
+ * Rows of a mask being filled by fillAlphaMask().
+ */
+typedef struct _MaskRows {
+    jint minX, minY;
+    // x position of the mask
+    jint x;
+    // mask offset of the first row, and the mask scanline stride
+    jint maskOffset;
+    jint maskWidth;
+    jint surfaceWidth;
+} MaskRows;
+
+/*
+ * Emits rows minY..maxY of the mask, one row at a time.
+ */
+static void
+emitMaskRows(Renderer* rdr, jint minY, jint maxY, void* data)
+{
+    MaskRows* rows = (MaskRows*)data;
+    jint y;
+
+    for (y = minY; y <= maxY; y++) {
+        jint rowNum = y - rows->minY;
+
+        // only the first row starts at the clipped x position, the following
+        // rows have always started at the mask position
+        rdr->_currX = (rowNum == 0) ? rows->minX : rows->x;
+        rdr->_currY = y;
+        rdr->_currImageOffset = y * rows->surfaceWidth;
+        rdr->_maskOffset = rows->maskOffset + rowNum * rows->maskWidth;
+        rdr->_rowNum = rowNum;
+
+        if (rdr->_genPaint) {
+            size_t l = rdr->_alphaWidth;
+            ALLOC3(rdr->_paint, jint, l);
+            rdr->_genPaint(rdr, 1);
+        }
+        rdr->_emitRows(rdr, 1);
+    }
+}
+
 static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint maxY,
     JNIEnv *env, jobject this, jint maskType, jbyteArray jmask,
     jint x, jint y, jint maskWidth, jint maskHeight, jint offset, jint stride)
 {
-    jint rowsToBeRendered, rowsBeingRendered;
+    MaskRows rows;
 
     Surface* surface;
     jobject surfaceHandle;
@@ -804,7 +876,6 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
         mask = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, jmask, NULL);
         if (mask != NULL) {
             jint width = maxX - minX + 1;
-            jint height = maxY - minY + 1;
 
             renderer_setMask(rdr, maskType, mask, maskWidth, maskHeight, JNI_FALSE);
 
@@ -820,27 +891,18 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
 
             rdr->_imageScanlineStride = surface->width;
             rdr->_imagePixelStride = 1;
-            rdr->_rowNum = 0;
-            rdr->_maskOffset = offset;
-
-            rowsToBeRendered = height;
 
-            while (rowsToBeRendered > 0) {
-                rowsBeingRendered = 1; //MIN(rowsToBeRendered, NUM_ALPHA_ROWS);
+            rows.minX = minX;
+            rows.minY = minY;
+            rows.x = x;
+            rows.maskOffset = offset;
+            rows.maskWidth = maskWidth;
+            rows.surfaceWidth = surface->width;
 
-                rdr->_currImageOffset = rdr->_currY * surface->width;
-                if (rdr->_genPaint) {
-                    size_t l = (width * rowsBeingRendered);
-                    ALLOC3(rdr->_paint, jint, l);
-                    rdr->_genPaint(rdr, rowsBeingRendered);
-                }
-                rdr->_emitRows(rdr, rowsBeingRendered);
-
-                rdr->_maskOffset += maskWidth;
-                rdr->_rowNum += rowsBeingRendered;
-                rowsToBeRendered -= rowsBeingRendered;
-                rdr->_currX = x;
-                rdr->_currY += rowsBeingRendered;
+            if (!tiles_render(rdr, minY, maxY, width,
+                              emitMaskRows, &rows))
+            {
+                emitMaskRows(rdr, minY, maxY, &rows);
             }
 
             renderer_removeMask(rdr);
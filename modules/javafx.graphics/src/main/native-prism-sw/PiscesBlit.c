@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,7 @@
  */
 
 #include <PiscesBlit.h>
+#include <PiscesSIMD.h>
 
 #include <PiscesUtil.h>
 #include <PiscesRenderer.h>
@@ -575,6 +576,10 @@ blitSrcOver8888_pre(Renderer *rdr, jint height) {
     jint cblue = rdr->_cblue;
     jbyte *alphaMap = rdr->alphaMap;
 
+    jint avals[SIMD_SPAN_LENGTH];
+    jint k, n;
+    jint level = rdr->_simdLevel;
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -585,6 +590,19 @@ blitSrcOver8888_pre(Renderer *rdr, jint height) {
         aval_relative = 0;
         a = alpha;
         am = a + w;
+        if (level > SIMD_LEVEL_SCALAR && imagePixelStride == 1) {
+            while (a < am) {
+                n = MIN((jint)(am - a), SIMD_SPAN_LENGTH);
+                for (k = 0; k < n; k++) {
+                    aval_relative += *a;
+                    *a++ = 0;
+                    avals[k] = (aval_relative) ?
+                        (((alphaMap[aval_relative] & 0xff) + 1) * calpha) >> 8 : 0;
+                }
+                simd_blendSrcOver(level, &intData[iidx], avals, n, cred, cgreen, cblue);
+                iidx += n;
+            }
+        }
         while (a < am) {
             aval_relative += *a;
             *a++ = 0;
@@ -626,6 +644,10 @@ blitSrcOverMask8888_pre(Renderer *rdr, jint height) {
     jint cgreen = rdr->_cgreen;
     jint cblue = rdr->_cblue;
 
+    jint avals[SIMD_SPAN_LENGTH];
+    jint k, n;
+    jint level = rdr->_simdLevel;
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -635,6 +657,16 @@ blitSrcOverMask8888_pre(Renderer *rdr, jint height) {
 
         a = alpha + alphaOffset;
         am = a + w;
+        if (level > SIMD_LEVEL_SCALAR && imagePixelStride == 1) {
+            while (a < am) {
+                n = MIN((jint)(am - a), SIMD_SPAN_LENGTH);
+                for (k = 0; k < n; k++, a++) {
+                    avals[k] = (*a) ? (((*a & 0xff) + 1) * calpha) >> 8 : 0;
+                }
+                simd_blendSrcOver(level, &intData[iidx], avals, n, cred, cgreen, cblue);
+                iidx += n;
+            }
+        }
         while (a < am) {
             if (*a) {
                 aval = *a & 0xff;
@@ -729,6 +761,10 @@ blitPTSrcOver8888_pre(Renderer *rdr, jint height) {
     jint* paint = rdr->_paint;
     jint palpha, malpha;
 
+    jint fracs[SIMD_SPAN_LENGTH];
+    jint k, n;
+    jint level = rdr->_simdLevel;
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -740,6 +776,20 @@ blitPTSrcOver8888_pre(Renderer *rdr, jint height) {
         aval_relative = 0;
         a = alpha;
         am = a + w;
+        if (level > SIMD_LEVEL_SCALAR && imagePixelStride == 1) {
+            while (a < am) {
+                n = MIN((jint)(am - a), SIMD_SPAN_LENGTH);
+                for (k = 0; k < n; k++) {
+                    aval_relative += *a;
+                    *a++ = 0;
+                    fracs[k] = (aval_relative) ?
+                        (alphaMap[aval_relative] & 0xff) + 1 : 0;
+                }
+                simd_blendSrcOverPre(level, &intData[iidx], &paint[aidx], fracs, n);
+                iidx += n;
+                aidx += n;
+            }
+        }
         while (a < am) {
             assert(aidx >= 0);
             assert(aidx < rdr->_paint_length);
@@ -785,6 +835,10 @@ blitPTSrcOverMask8888_pre(Renderer *rdr, jint height) {
     jint* paint = rdr->_paint;
     jint palpha, malpha;
 
+    jint fracs[SIMD_SPAN_LENGTH];
+    jint k, n;
+    jint level = rdr->_simdLevel;
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
     w = (maxX >= minX) ? (maxX - minX + 1) : 0;
@@ -795,6 +849,17 @@ blitPTSrcOverMask8888_pre(Renderer *rdr, jint height) {
 
         a = alpha + alphaOffset;
         am = a + w;
+        if (level > SIMD_LEVEL_SCALAR && imagePixelStride == 1) {
+            while (a < am) {
+                n = MIN((jint)(am - a), SIMD_SPAN_LENGTH);
+                for (k = 0; k < n; k++, a++) {
+                    fracs[k] = (*a) ? (*a & 0xff) + 1 : 0;
+                }
+                simd_blendSrcOverPre(level, &intData[iidx], &paint[aidx], fracs, n);
+                iidx += n;
+                aidx += n;
+            }
+        }
         while (a < am) {
             if (*a) {
                 cval = paint[aidx];
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 #include <PiscesUtil.h>
 #include <PiscesRenderer.h>
+#include <PiscesSIMD.h>
 
 #include <PiscesSysutils.h>
 #include <PiscesMath.h>
@@ -111,11 +112,26 @@ genLinearGradientPaint(Renderer *rdr, jint height) {
     jint* paint = rdr->_paint;
     jint* colors = rdr->_gradient_colors;
 
+    jfloat rowFrac[NUM_ALPHA_ROWS];
+    jint simdRows = 0;
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
 
-    y = rdr->_currY;
-    for (j = 0; j < height; j++, y++) {
+    // the vectorized version generates several rows at once
+    if (rdr->_simdLevel > SIMD_LEVEL_SCALAR && height <= NUM_ALPHA_ROWS) {
+        x = rdr->_currX;
+        y = rdr->_currY;
+        for (j = 0; j < height; j++, y++) {
+            rowFrac[j] = x * mx + y * my + b;
+        }
+        simdRows = simd_genLinearGradientRows(rdr->_simdLevel, paint, width,
+            width, height, rowFrac, mx, cycleMethod, colors);
+        paintOffset = simdRows * width;
+    }
+
+    y = rdr->_currY + simdRows;
+    for (j = simdRows; j < height; j++, y++) {
         x = rdr->_currX;
         pidx = paintOffset;
 
@@ -132,14 +148,38 @@ genLinearGradientPaint(Renderer *rdr, jint height) {
     }
 }
 
+static void
+genRadialGradientRow(jint* paint, jint width, const RadialGradientRow* grow,
+                     jint cycleMethod, const jint* colors) {
+    float U = grow->U, dU = grow->dU;
+    float V = grow->V, dV = grow->dV, ddV = grow->ddV;
+    jint ifrac;
+    jint i;
+
+    for (i = 0; i < width; i++) {
+        if (V < 0) {
+            V = 0;
+        }
+
+        ifrac = (jint)(U + PISCESsqrt(V));
+
+        U += dU;
+        V += dV ;
+        dV += ddV;
+
+        ifrac = pad(ifrac, cycleMethod);
+        ifrac >>= (16 - LG_GRADIENT_MAP_SIZE);
+        paint[i] = colors[ifrac];
+    }
+}
+
 void
 genRadialGradientPaint(Renderer *rdr, jint height) {
     jint cycleMethod = rdr->_gradient_cycleMethod;
     jint width = rdr->_alphaWidth;
     jint minX, maxX;
     jint paintOffset = 0;
-    jint pidx;
-    jint i, j;
+    jint j, rows, simdRows;
     jint x, y;
 
     jfloat a00, a01, a02, a10, a11, a12;
@@ -150,11 +190,13 @@ genRadialGradientPaint(Renderer *rdr, jint height) {
     float txx, tyy, fxx, fyy, cfx, cfy;
     float A, B, B2, C, C2, U, dU, V, dV, ddV, tmp;
     float _Csq, _C;
-    jint ifrac;
 
     jint* paint = rdr->_paint;
     jint* colors = rdr->_gradient_colors;
 
+    // initial state of the rows, generated NUM_ALPHA_ROWS rows at a time
+    RadialGradientRow grows[NUM_ALPHA_ROWS];
+
     minX = rdr->_minTouched;
     maxX = rdr->_maxTouched;
 
@@ -177,59 +219,54 @@ genRadialGradientPaint(Renderer *rdr, jint height) {
     rsq = rdr->_rg_rsq;
 
     y = rdr->_currY;
-    for (j = 0; j < height; j++, y++) {
-        pidx = paintOffset;
-        x = rdr->_currX;
-
-        txx = x * a00 + y * a01 + a02;
-        tyy = x * a10 + y * a11 + a12;
-
-        fxx = fx - txx;
-        fyy = fy - tyy;
-        A = fxx * fxx + fyy * fyy;
-        cfx = cx - fx;
-        cfy = cy - fy;
-        cfxcfx = (jfloat)(cfx * cfx);
-        cfycfy = (jfloat)(cfy * cfy);
-        cfxcfy = (jfloat)(cfx * cfy);
-        B = (cfx * fxx + cfy * fyy);
-        B2 = -B * 2.0f;
-        C = cfxcfx + cfycfy - rsq;
-        C2 = 2.0f * C;
-        _C = 1.0f / C;
-        _Csq = _C * _C;
-        U = (-B * _C);
-        dU = (a00 * cfx + a10 * cfy) * _C;
-        V =  ((B * B - A * C) * _Csq);
-        sube = 2.0f * a00a10 *cfxcfy;
-        dV =  (sube +
-              (a00a00 * (cfxcfx - C) + a00 * (B2 * cfx + C2 * fxx)) +
-              (a10a10 * (cfycfy - C) + a10 * (B2 * cfy + C2 * fyy))) * _Csq;
-        tmp = a00a00*cfycfy - sube + a10a10*cfxcfx;
-        ddV = 2.0f * ((a00a00 + a10a10) * rsq - tmp) * _Csq;
-
-        U   = (65536.0f * U); // 65536.0f to be in fixed-point level needed by "frac"
-        V   = (65536.0f * 65536.0f * V); // 65536.0f * 65536.0f to stay in fixed point level after sqrt
-        dU  = (65536.0f * dU);
-        dV  = (65536.0f * 65536.0f * dV);
-        ddV = (65536.0f * 65536.0f * ddV);
-        for (i = 0; i < width; i++, pidx++) {
-            if (V < 0) {
-                V = 0;
-            }
-
-            ifrac = (jint)(U + PISCESsqrt(V));
-
-            U += dU;
-            V += dV ;
-            dV += ddV;
+    while (height > 0) {
+        rows = MIN(height, NUM_ALPHA_ROWS);
+        for (j = 0; j < rows; j++, y++) {
+            x = rdr->_currX;
 
-            ifrac = pad(ifrac, cycleMethod);
-            ifrac >>= (16 - LG_GRADIENT_MAP_SIZE);
-            paint[pidx] = colors[ifrac];
+            txx = x * a00 + y * a01 + a02;
+            tyy = x * a10 + y * a11 + a12;
+
+            fxx = fx - txx;
+            fyy = fy - tyy;
+            A = fxx * fxx + fyy * fyy;
+            cfx = cx - fx;
+            cfy = cy - fy;
+            cfxcfx = (jfloat)(cfx * cfx);
+            cfycfy = (jfloat)(cfy * cfy);
+            cfxcfy = (jfloat)(cfx * cfy);
+            B = (cfx * fxx + cfy * fyy);
+            B2 = -B * 2.0f;
+            C = cfxcfx + cfycfy - rsq;
+            C2 = 2.0f * C;
+            _C = 1.0f / C;
+            _Csq = _C * _C;
+            U = (-B * _C);
+            dU = (a00 * cfx + a10 * cfy) * _C;
+            V =  ((B * B - A * C) * _Csq);
+            sube = 2.0f * a00a10 *cfxcfy;
+            dV =  (sube +
+                  (a00a00 * (cfxcfx - C) + a00 * (B2 * cfx + C2 * fxx)) +
+                  (a10a10 * (cfycfy - C) + a10 * (B2 * cfy + C2 * fyy))) * _Csq;
+            tmp = a00a00*cfycfy - sube + a10a10*cfxcfx;
+            ddV = 2.0f * ((a00a00 + a10a10) * rsq - tmp) * _Csq;
+
+            grows[j].U   = (65536.0f * U); // 65536.0f to be in fixed-point level needed by "frac"
+            grows[j].V   = (65536.0f * 65536.0f * V); // 65536.0f * 65536.0f to stay in fixed point level after sqrt
+            grows[j].dU  = (65536.0f * dU);
+            grows[j].dV  = (65536.0f * 65536.0f * dV);
+            grows[j].ddV = (65536.0f * 65536.0f * ddV);
         }
 
-        paintOffset += width;
+        simdRows = simd_genRadialGradientRows(rdr->_simdLevel,
+            paint + paintOffset, width, width, rows, grows, cycleMethod, colors);
+        paintOffset += simdRows * width;
+        for (j = simdRows; j < rows; j++) {
+            genRadialGradientRow(paint + paintOffset, width, &grows[j],
+                                 cycleMethod, colors);
+            paintOffset += width;
+        }
+        height -= rows;
     }
 }
 
@@ -263,6 +300,9 @@ static INLINE jint interpolate2points(jint p0, jint p1, jint frac) {
 
 static INLINE jint interpolate4points(jint p00, jint p01, jint p10, jint p11,
                                jint hfrac, jint vfrac) {
+#ifdef PISCES_USE_SSE2
+    return simd_interpolate4points(p00, p01, p10, p11, hfrac, vfrac);
+#else
     jint a00 = (p00 >> 24) & 0xff;
     jint r00 = (p00 >> 16) & 0xff;
     jint g00 = (p00 >> 8)  & 0xff;
@@ -299,6 +339,7 @@ static INLINE jint interpolate4points(jint p00, jint p01, jint p10, jint p11,
     jint bb = interp(b0, b1, vfrac);
 
     return (aa << 24) | (rr << 16) | (gg << 8) | bb;
+#endif
 }
 
 static INLINE jint interpolate2pointsNoAlpha(jint p0, jint p1, jint frac) {
@@ -319,6 +360,9 @@ static INLINE jint interpolate2pointsNoAlpha(jint p0, jint p1, jint frac) {
 
 static INLINE jint interpolate4pointsNoAlpha(jint p00, jint p01, jint p10, jint p11,
                                       jint hfrac, jint vfrac) {
+#ifdef PISCES_USE_SSE2
+    return 0xff000000 | simd_interpolate4points(p00, p01, p10, p11, hfrac, vfrac);
+#else
     jint r00 = (p00 >> 16) & 0xff;
     jint g00 = (p00 >> 8)  & 0xff;
     jint b00 =  p00        & 0xff;
@@ -348,6 +392,7 @@ static INLINE jint interpolate4pointsNoAlpha(jint p00, jint p01, jint p10, jint
     jint bb = interp(b0, b1, vfrac);
 
     return (0xff000000) | (rr << 16) | (gg << 8) | bb;
+#endif
 }
 
 static INLINE jboolean isInBoundsNoRepeat(jint *a, jlong *la, jint min, jint max) {
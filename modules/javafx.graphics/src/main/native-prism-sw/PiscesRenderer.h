@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -380,6 +380,14 @@ typedef struct _Renderer {
 
     jint _rendererState;
 
+    // Number of threads rendering the tiles of large primitives
+    // (1 means serial rendering, see PiscesTiles.h)
+    jint _tileThreadCount;
+
+    // Instruction set level of the compositing and paint generation
+    // loops (see PiscesSIMD.h)
+    jint _simdLevel;
+
 }
 Renderer;
 
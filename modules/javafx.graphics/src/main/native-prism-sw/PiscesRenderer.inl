@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,7 @@
 #include <PiscesUtil.h>
 #include <PiscesBlit.h>
 #include <PiscesPaint.h>
+#include <PiscesSIMD.h>
 #include <PiscesTransform.h>
 
 #include <PiscesSysutils.h>
@@ -469,6 +470,9 @@ createCommon(Surface* surface) {
     // initialize renderer state
     rdr->_rendererState = INVALID_ALL;
 
+    rdr->_tileThreadCount = 1;
+    rdr->_simdLevel = simd_getLevel();
+
     return rdr;
 }
 
@@ -0,0 +1,519 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include <PiscesSIMD.h>
+
+#include <PiscesRenderer.h>
+
+#ifdef PISCES_USE_SSE2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif /* PISCES_USE_SSE2 */
+
+static INLINE jint div255(jint x) {
+    return (x*257 + 257) >> 16;
+}
+
+/*
+ * Scalar versions of the kernels, used for the ends of the spans and when
+ * no SIMD level is available.
+ */
+
+static void
+blendSrcOverScalar(jint* dst, const jint* aval, jint len,
+                   jint sred, jint sgreen, jint sblue) {
+    jint i;
+    for (i = 0; i < len; i++) {
+        jint a = aval[i];
+        if (a == 0) {
+            continue;
+        } else {
+            jint ival = dst[i];
+            jint oneminusaval = 255 - a;
+            jint oalpha = div255(255 * a    + oneminusaval * ((ival >> 24) & 0xff));
+            jint ored   = div255(sred * a   + oneminusaval * ((ival >> 16) & 0xff));
+            jint ogreen = div255(sgreen * a + oneminusaval * ((ival >> 8) & 0xff));
+            jint oblue  = div255(sblue * a  + oneminusaval * (ival & 0xff));
+            dst[i] = (oalpha << 24) | (ored << 16) | (ogreen << 8) | oblue;
+        }
+    }
+}
+
+static void
+blendSrcOverPreScalar(jint* dst, const jint* src, const jint* frac, jint len) {
+    jint i;
+    for (i = 0; i < len; i++) {
+        jint cval = src[i];
+        jint f = frac[i];
+        jint aval2 = (((cval >> 24) & 0xff) * f) >> 8;
+        if (aval2 == 0) {
+            continue;
+        } else {
+            jint ival = dst[i];
+            jint oneminusaval = 255 - aval2;
+            jint oalpha = aval2 + div255(oneminusaval * ((ival >> 24) & 0xff));
+            jint ored   = ((((cval >> 16) & 0xff) * f) >> 8) +
+                          div255(oneminusaval * ((ival >> 16) & 0xff));
+            jint ogreen = ((((cval >> 8) & 0xff) * f) >> 8) +
+                          div255(oneminusaval * ((ival >> 8) & 0xff));
+            jint oblue  = (((cval & 0xff) * f) >> 8) +
+                          div255(oneminusaval * (ival & 0xff));
+            dst[i] = (oalpha << 24) | (ored << 16) | (ogreen << 8) | oblue;
+        }
+    }
+}
+
+#ifdef PISCES_USE_SSE2
+
+/*
+ * SSE2 kernels. Pixels are processed with one 16-bit lane per channel,
+ * two pixels per register; all intermediate values fit in 16 bits.
+ */
+
+// div255() of 16-bit lanes, x <= 65534
+static INLINE __m128i
+div255SSE2(__m128i x) {
+    return _mm_mulhi_epu16(_mm_add_epi16(x, _mm_set1_epi16(1)),
+                           _mm_set1_epi16(257));
+}
+
+static INLINE __m128i
+blendSrcOverPixelsSSE2(__m128i d, __m128i a, __m128i s) {
+    __m128i c255 = _mm_set1_epi16(255);
+    return div255SSE2(_mm_add_epi16(_mm_mullo_epi16(s, a),
+                      _mm_mullo_epi16(_mm_sub_epi16(c255, a), d)));
+}
+
+static INLINE __m128i
+blendSrcOverPrePixelsSSE2(__m128i d, __m128i s, __m128i f) {
+    __m128i c255 = _mm_set1_epi16(255);
+    __m128i sf = _mm_srli_epi16(_mm_mullo_epi16(s, f), 8);
+    // alpha of the scaled source, broadcast to the lanes of each pixel
+    __m128i a2 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sf, 0xff), 0xff);
+    __m128i skip = _mm_cmpeq_epi16(a2, _mm_setzero_si128());
+    __m128i o = _mm_add_epi16(sf,
+                    div255SSE2(_mm_mullo_epi16(_mm_sub_epi16(c255, a2), d)));
+    return _mm_or_si128(_mm_and_si128(skip, d), _mm_andnot_si128(skip, o));
+}
+
+static jint
+blendSrcOverSSE2(jint* dst, const jint* aval, jint len,
+                 jint sred, jint sgreen, jint sblue) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i s = _mm_setr_epi16((short)sblue, (short)sgreen, (short)sred, 255,
+                               (short)sblue, (short)sgreen, (short)sred, 255);
+    jint i;
+    for (i = 0; i + 4 <= len; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i a = _mm_loadu_si128((const __m128i*)(aval + i));
+        __m128i lo, hi;
+        a = _mm_packs_epi32(a, a);
+        a = _mm_unpacklo_epi16(a, a);
+        lo = blendSrcOverPixelsSSE2(_mm_unpacklo_epi8(d, zero),
+                                    _mm_unpacklo_epi32(a, a), s);
+        hi = blendSrcOverPixelsSSE2(_mm_unpackhi_epi8(d, zero),
+                                    _mm_unpackhi_epi32(a, a), s);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+static jint
+blendSrcOverPreSSE2(jint* dst, const jint* src, const jint* frac, jint len) {
+    __m128i zero = _mm_setzero_si128();
+    jint i;
+    for (i = 0; i + 4 <= len; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i f = _mm_loadu_si128((const __m128i*)(frac + i));
+        __m128i lo, hi;
+        f = _mm_packs_epi32(f, f);
+        f = _mm_unpacklo_epi16(f, f);
+        lo = blendSrcOverPrePixelsSSE2(_mm_unpacklo_epi8(d, zero),
+                                       _mm_unpacklo_epi8(s, zero),
+                                       _mm_unpacklo_epi32(f, f));
+        hi = blendSrcOverPrePixelsSSE2(_mm_unpackhi_epi8(d, zero),
+                                       _mm_unpackhi_epi8(s, zero),
+                                       _mm_unpackhi_epi32(f, f));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+// pad() of PiscesPaint.c followed by the shift to a gradient map index
+static INLINE __m128i
+gradientIndexSSE2(__m128i ifrac, jint cycleMethod) {
+    __m128i max = _mm_set1_epi32(0xffff);
+    __m128i gt;
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        ifrac = _mm_andnot_si128(_mm_srai_epi32(ifrac, 31), ifrac);
+        gt = _mm_cmpgt_epi32(ifrac, max);
+        ifrac = _mm_or_si128(_mm_andnot_si128(gt, ifrac), _mm_and_si128(gt, max));
+        break;
+    case CYCLE_REPEAT:
+        ifrac = _mm_and_si128(ifrac, max);
+        break;
+    case CYCLE_REFLECT:
+        gt = _mm_srai_epi32(ifrac, 31);
+        ifrac = _mm_sub_epi32(_mm_xor_si128(ifrac, gt), gt);
+        ifrac = _mm_and_si128(ifrac, _mm_set1_epi32(0x1ffff));
+        gt = _mm_cmpgt_epi32(ifrac, max);
+        ifrac = _mm_or_si128(_mm_andnot_si128(gt, ifrac), _mm_and_si128(gt,
+                    _mm_sub_epi32(_mm_set1_epi32(0x1ffff), ifrac)));
+        break;
+    }
+    return _mm_srai_epi32(ifrac, 16 - LG_GRADIENT_MAP_SIZE);
+}
+
+static INLINE void
+storeGradientColumnSSE2(jint* paint, jint paintStride, __m128i idx,
+                        const jint* colors) {
+    jint index[4];
+    _mm_storeu_si128((__m128i*)index, idx);
+    paint[0] = colors[index[0]];
+    paint[paintStride] = colors[index[1]];
+    paint[2 * paintStride] = colors[index[2]];
+    paint[3 * paintStride] = colors[index[3]];
+}
+
+static void
+genLinearGradientRowsSSE2(jint* paint, jint paintStride, jint width,
+                          const jfloat* frac, jfloat mx, jint cycleMethod,
+                          const jint* colors) {
+    __m128 f = _mm_loadu_ps(frac);
+    __m128 vmx = _mm_set1_ps(mx);
+    jint i;
+    for (i = 0; i < width; i++) {
+        storeGradientColumnSSE2(paint + i, paintStride,
+            gradientIndexSSE2(_mm_cvttps_epi32(f), cycleMethod), colors);
+        f = _mm_add_ps(f, vmx);
+    }
+}
+
+static void
+genRadialGradientRowsSSE2(jint* paint, jint paintStride, jint width,
+                          const RadialGradientRow* grows, jint cycleMethod,
+                          const jint* colors) {
+    __m128 zero = _mm_setzero_ps();
+    __m128 U = _mm_setr_ps(grows[0].U, grows[1].U, grows[2].U, grows[3].U);
+    __m128 dU = _mm_setr_ps(grows[0].dU, grows[1].dU, grows[2].dU, grows[3].dU);
+    __m128 V = _mm_setr_ps(grows[0].V, grows[1].V, grows[2].V, grows[3].V);
+    __m128 dV = _mm_setr_ps(grows[0].dV, grows[1].dV, grows[2].dV, grows[3].dV);
+    __m128 ddV = _mm_setr_ps(grows[0].ddV, grows[1].ddV, grows[2].ddV, grows[3].ddV);
+    jint i;
+    for (i = 0; i < width; i++) {
+        __m128d lo, hi;
+        // max(0, V) keeps a NaN, like the scalar (V < 0) test
+        V = _mm_max_ps(zero, V);
+        lo = _mm_add_pd(_mm_cvtps_pd(U), _mm_sqrt_pd(_mm_cvtps_pd(V)));
+        hi = _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(U, U)),
+                        _mm_sqrt_pd(_mm_cvtps_pd(_mm_movehl_ps(V, V))));
+        storeGradientColumnSSE2(paint + i, paintStride,
+            gradientIndexSSE2(_mm_unpacklo_epi64(_mm_cvttpd_epi32(lo),
+                                                 _mm_cvttpd_epi32(hi)),
+                              cycleMethod), colors);
+        U = _mm_add_ps(U, dU);
+        V = _mm_add_ps(V, dV);
+        dV = _mm_add_ps(dV, ddV);
+    }
+}
+
+/*
+ * AVX2 kernels, same as the SSE2 ones with twice the number of lanes.
+ */
+
+TARGET_AVX2 static INLINE __m256i
+div255AVX2(__m256i x) {
+    return _mm256_mulhi_epu16(_mm256_add_epi16(x, _mm256_set1_epi16(1)),
+                              _mm256_set1_epi16(257));
+}
+
+TARGET_AVX2 static INLINE __m256i
+blendSrcOverPixelsAVX2(__m256i d, __m256i a, __m256i s) {
+    __m256i c255 = _mm256_set1_epi16(255);
+    return div255AVX2(_mm256_add_epi16(_mm256_mullo_epi16(s, a),
+                      _mm256_mullo_epi16(_mm256_sub_epi16(c255, a), d)));
+}
+
+TARGET_AVX2 static INLINE __m256i
+blendSrcOverPrePixelsAVX2(__m256i d, __m256i s, __m256i f) {
+    __m256i c255 = _mm256_set1_epi16(255);
+    __m256i sf = _mm256_srli_epi16(_mm256_mullo_epi16(s, f), 8);
+    __m256i a2 = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(sf, 0xff), 0xff);
+    __m256i skip = _mm256_cmpeq_epi16(a2, _mm256_setzero_si256());
+    __m256i o = _mm256_add_epi16(sf,
+                    div255AVX2(_mm256_mullo_epi16(_mm256_sub_epi16(c255, a2), d)));
+    return _mm256_blendv_epi8(o, d, skip);
+}
+
+TARGET_AVX2 static jint
+blendSrcOverAVX2(jint* dst, const jint* aval, jint len,
+                 jint sred, jint sgreen, jint sblue) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i s = _mm256_setr_epi16((short)sblue, (short)sgreen, (short)sred, 255,
+                                  (short)sblue, (short)sgreen, (short)sred, 255,
+                                  (short)sblue, (short)sgreen, (short)sred, 255,
+                                  (short)sblue, (short)sgreen, (short)sred, 255);
+    jint i;
+    // the unpacks work within 128-bit halves, so do the packs below
+    for (i = 0; i + 8 <= len; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+        __m256i a = _mm256_loadu_si256((const __m256i*)(aval + i));
+        __m256i lo, hi;
+        a = _mm256_packs_epi32(a, a);
+        a = _mm256_unpacklo_epi16(a, a);
+        lo = blendSrcOverPixelsAVX2(_mm256_unpacklo_epi8(d, zero),
+                                    _mm256_unpacklo_epi32(a, a), s);
+        hi = blendSrcOverPixelsAVX2(_mm256_unpackhi_epi8(d, zero),
+                                    _mm256_unpackhi_epi32(a, a), s);
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+TARGET_AVX2 static jint
+blendSrcOverPreAVX2(jint* dst, const jint* src, const jint* frac, jint len) {
+    __m256i zero = _mm256_setzero_si256();
+    jint i;
+    for (i = 0; i + 8 <= len; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+        __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i f = _mm256_loadu_si256((const __m256i*)(frac + i));
+        __m256i lo, hi;
+        f = _mm256_packs_epi32(f, f);
+        f = _mm256_unpacklo_epi16(f, f);
+        lo = blendSrcOverPrePixelsAVX2(_mm256_unpacklo_epi8(d, zero),
+                                       _mm256_unpacklo_epi8(s, zero),
+                                       _mm256_unpacklo_epi32(f, f));
+        hi = blendSrcOverPrePixelsAVX2(_mm256_unpackhi_epi8(d, zero),
+                                       _mm256_unpackhi_epi8(s, zero),
+                                       _mm256_unpackhi_epi32(f, f));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+TARGET_AVX2 static INLINE __m256i
+gradientIndexAVX2(__m256i ifrac, jint cycleMethod) {
+    __m256i max = _mm256_set1_epi32(0xffff);
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        ifrac = _mm256_min_epi32(_mm256_max_epi32(ifrac, _mm256_setzero_si256()), max);
+        break;
+    case CYCLE_REPEAT:
+        ifrac = _mm256_and_si256(ifrac, max);
+        break;
+    case CYCLE_REFLECT:
+        // abs() wraps like the scalar negation, then fold the upper half
+        ifrac = _mm256_and_si256(_mm256_abs_epi32(ifrac), _mm256_set1_epi32(0x1ffff));
+        ifrac = _mm256_min_epi32(ifrac,
+                    _mm256_sub_epi32(_mm256_set1_epi32(0x1ffff), ifrac));
+        break;
+    }
+    return _mm256_srai_epi32(ifrac, 16 - LG_GRADIENT_MAP_SIZE);
+}
+
+TARGET_AVX2 static INLINE void
+storeGradientColumnAVX2(jint* paint, jint paintStride, __m256i idx,
+                        const jint* colors) {
+    jint cval[8];
+    jint k;
+    _mm256_storeu_si256((__m256i*)cval, _mm256_i32gather_epi32((const int*)colors, idx, 4));
+    for (k = 0; k < 8; k++) {
+        paint[k * paintStride] = cval[k];
+    }
+}
+
+TARGET_AVX2 static void
+genLinearGradientRowsAVX2(jint* paint, jint paintStride, jint width,
+                          const jfloat* frac, jfloat mx, jint cycleMethod,
+                          const jint* colors) {
+    __m256 f = _mm256_loadu_ps(frac);
+    __m256 vmx = _mm256_set1_ps(mx);
+    jint i;
+    for (i = 0; i < width; i++) {
+        storeGradientColumnAVX2(paint + i, paintStride,
+            gradientIndexAVX2(_mm256_cvttps_epi32(f), cycleMethod), colors);
+        f = _mm256_add_ps(f, vmx);
+    }
+}
+
+TARGET_AVX2 static void
+genRadialGradientRowsAVX2(jint* paint, jint paintStride, jint width,
+                          const RadialGradientRow* grows, jint cycleMethod,
+                          const jint* colors) {
+    jfloat state[5][8];
+    __m256 zero = _mm256_setzero_ps();
+    __m256 U, dU, V, dV, ddV;
+    jint i, k;
+    for (k = 0; k < 8; k++) {
+        state[0][k] = grows[k].U;
+        state[1][k] = grows[k].dU;
+        state[2][k] = grows[k].V;
+        state[3][k] = grows[k].dV;
+        state[4][k] = grows[k].ddV;
+    }
+    U = _mm256_loadu_ps(state[0]);
+    dU = _mm256_loadu_ps(state[1]);
+    V = _mm256_loadu_ps(state[2]);
+    dV = _mm256_loadu_ps(state[3]);
+    ddV = _mm256_loadu_ps(state[4]);
+    for (i = 0; i < width; i++) {
+        __m256d lo, hi;
+        V = _mm256_max_ps(zero, V);
+        lo = _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(U)),
+                 _mm256_sqrt_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(V))));
+        hi = _mm256_add_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(U, 1)),
+                 _mm256_sqrt_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(V, 1))));
+        storeGradientColumnAVX2(paint + i, paintStride,
+            gradientIndexAVX2(_mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm256_cvttpd_epi32(lo)),
+                _mm256_cvttpd_epi32(hi), 1), cycleMethod), colors);
+        U = _mm256_add_ps(U, dU);
+        V = _mm256_add_ps(V, dV);
+        dV = _mm256_add_ps(dV, ddV);
+    }
+}
+
+static jboolean
+cpuSupportsAVX2() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return XNI_FALSE;
+    }
+    __cpuid(info, 1);
+    // The OS must save the AVX state (OSXSAVE and XCR0 bits 1 and 2).
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+        (_xgetbv(0) & 0x6) != 0x6) {
+        return XNI_FALSE;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif /* PISCES_USE_SSE2 */
+
+jint
+simd_getLevel() {
+#ifdef PISCES_USE_SSE2
+    static jint level = -1;
+    if (level < 0) {
+        level = cpuSupportsAVX2() ? SIMD_LEVEL_AVX2 : SIMD_LEVEL_SSE2;
+    }
+    return level;
+#else
+    return SIMD_LEVEL_SCALAR;
+#endif
+}
+
+void
+simd_blendSrcOver(jint level, jint* dst, const jint* aval, jint len,
+                  jint sred, jint sgreen, jint sblue) {
+    jint done = 0;
+#ifdef PISCES_USE_SSE2
+    if (level >= SIMD_LEVEL_AVX2) {
+        done = blendSrcOverAVX2(dst, aval, len, sred, sgreen, sblue);
+    }
+    if (level >= SIMD_LEVEL_SSE2) {
+        done += blendSrcOverSSE2(dst + done, aval + done, len - done,
+                                 sred, sgreen, sblue);
+    }
+#endif
+    blendSrcOverScalar(dst + done, aval + done, len - done, sred, sgreen, sblue);
+}
+
+void
+simd_blendSrcOverPre(jint level, jint* dst, const jint* src,
+                     const jint* frac, jint len) {
+    jint done = 0;
+#ifdef PISCES_USE_SSE2
+    if (level >= SIMD_LEVEL_AVX2) {
+        done = blendSrcOverPreAVX2(dst, src, frac, len);
+    }
+    if (level >= SIMD_LEVEL_SSE2) {
+        done += blendSrcOverPreSSE2(dst + done, src + done, frac + done,
+                                    len - done);
+    }
+#endif
+    blendSrcOverPreScalar(dst + done, src + done, frac + done, len - done);
+}
+
+jint
+simd_genLinearGradientRows(jint level, jint* paint, jint paintStride,
+                           jint width, jint rows, const jfloat* frac,
+                           jfloat mx, jint cycleMethod, const jint* colors) {
+    jint done = 0;
+#ifdef PISCES_USE_SSE2
+    if (level >= SIMD_LEVEL_AVX2) {
+        for (; done + 8 <= rows; done += 8) {
+            genLinearGradientRowsAVX2(paint + done * paintStride, paintStride,
+                width, frac + done, mx, cycleMethod, colors);
+        }
+    }
+    if (level >= SIMD_LEVEL_SSE2) {
+        for (; done + 4 <= rows; done += 4) {
+            genLinearGradientRowsSSE2(paint + done * paintStride, paintStride,
+                width, frac + done, mx, cycleMethod, colors);
+        }
+    }
+#endif
+    return done;
+}
+
+jint
+simd_genRadialGradientRows(jint level, jint* paint, jint paintStride,
+                           jint width, jint rows,
+                           const RadialGradientRow* grows,
+                           jint cycleMethod, const jint* colors) {
+    jint done = 0;
+#ifdef PISCES_USE_SSE2
+    if (level >= SIMD_LEVEL_AVX2) {
+        for (; done + 8 <= rows; done += 8) {
+            genRadialGradientRowsAVX2(paint + done * paintStride, paintStride,
+                width, grows + done, cycleMethod, colors);
+        }
+    }
+    if (level >= SIMD_LEVEL_SSE2) {
+        for (; done + 4 <= rows; done += 4) {
+            genRadialGradientRowsSSE2(paint + done * paintStride, paintStride,
+                width, grows + done, cycleMethod, colors);
+        }
+    }
+#endif
+    return done;
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/**
+ * @file PiscesSIMD.h
+ * Vectorized compositing and paint generation loops. The kernels produce
+ * exactly the same pixels as the scalar code in PiscesBlit.c and
+ * PiscesPaint.c; the level to use is selected at run time, see
+ * simd_getLevel().
+ */
+
+#ifndef PISCES_SIMD_H
+#define PISCES_SIMD_H
+
+#include <PiscesDefs.h>
+
+/*
+ * The SSE2 kernels are compiled in on x86-64, where SSE2 is guaranteed and
+ * scalar float arithmetic is done in SSE registers as well (the gradient
+ * kernels must round exactly like the scalar code). The AVX2 kernels are
+ * only used when the processor supports them.
+ */
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#define PISCES_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * @defgroup SIMDLevels Instruction set levels of the kernels
+ * Levels in increasing order. SIMD_LEVEL_SCALAR selects the original
+ * one-pixel-at-a-time loops.
+ * @def SIMD_LEVEL_SCALAR
+ * @def SIMD_LEVEL_SSE2
+ * @def SIMD_LEVEL_AVX2
+ */
+#define SIMD_LEVEL_SCALAR 0
+#define SIMD_LEVEL_SSE2   1
+#define SIMD_LEVEL_AVX2   2
+
+/**
+ * @def SIMD_SPAN_LENGTH
+ * Maximum number of pixels passed to the blending kernels at once; callers
+ * compute the per-pixel alpha of a row in spans of this length.
+ */
+#define SIMD_SPAN_LENGTH 256
+
+/**
+ * Returns the highest level supported by both this build and the
+ * processor. The result is computed once and cached.
+ */
+jint simd_getLevel();
+
+/**
+ * Composites the non-premultiplied color (sred, sgreen, sblue) over the
+ * len premultiplied pixels at dst using SRC_OVER, with alpha aval[i]
+ * (0..255) for pixel i. Matches blendSrcOver8888_pre() in PiscesBlit.c,
+ * pixels with zero alpha are left unchanged.
+ */
+void simd_blendSrcOver(jint level, jint* dst, const jint* aval, jint len,
+                       jint sred, jint sgreen, jint sblue);
+
+/**
+ * Composites the len premultiplied pixels at src over the premultiplied
+ * pixels at dst using SRC_OVER, with src[i] scaled by frac[i] / 256
+ * (0..256). Matches blendSrcOver8888_pre_pre() in PiscesBlit.c, pixels
+ * with zero resulting alpha are left unchanged.
+ */
+void simd_blendSrcOverPre(jint level, jint* dst, const jint* src,
+                          const jint* frac, jint len);
+
+/**
+ * Generates rows of a linear gradient into paint. The gradient position
+ * of the first pixel of row j is frac[j] and increases by mx per pixel.
+ * The float accumulation is done exactly as in genLinearGradientPaint(),
+ * one row per vector lane, so only groups of 4 (SSE2) or 8 (AVX2) rows
+ * are generated. Returns the number of rows generated, the remaining rows
+ * are left to the caller.
+ */
+jint simd_genLinearGradientRows(jint level, jint* paint, jint paintStride,
+                                jint width, jint rows, const jfloat* frac,
+                                jfloat mx, jint cycleMethod,
+                                const jint* colors);
+
+/**
+ * Initial state of one row of a radial gradient, in the fixed-point scale
+ * used by genRadialGradientPaint().
+ */
+typedef struct _RadialGradientRow {
+    jfloat U, dU;
+    jfloat V, dV, ddV;
+} RadialGradientRow;
+
+/**
+ * Generates rows of a radial gradient into paint, row j starting with the
+ * state in grows[j]. Like simd_genLinearGradientRows() only whole groups
+ * of rows are generated; returns their number.
+ */
+jint simd_genRadialGradientRows(jint level, jint* paint, jint paintStride,
+                                jint width, jint rows,
+                                const RadialGradientRow* grows,
+                                jint cycleMethod, const jint* colors);
+
+#ifdef PISCES_USE_SSE2
+
+/*
+ * Multiplies the signed 16-bit lanes of d by frac (0..0xffff) and adds
+ * x0 << 16, giving 32-bit lanes; the SSE2 equivalent of the interp()
+ * numerator in PiscesPaint.c, before the rounding shift.
+ */
+static INLINE __m128i
+simd_interpLo(__m128i x0, __m128i d, __m128i frac, __m128i fracSign) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_mullo_epi16(d, frac);
+    // mulhi_epi16 takes frac as signed, fix up fractions above 0x7fff
+    __m128i hi = _mm_add_epi16(_mm_mulhi_epi16(d, frac),
+                               _mm_and_si128(d, fracSign));
+    return _mm_add_epi32(_mm_unpacklo_epi16(zero, x0),
+                         _mm_unpacklo_epi16(lo, hi));
+}
+
+static INLINE __m128i
+simd_interpHi(__m128i x0, __m128i d, __m128i frac, __m128i fracSign) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_mullo_epi16(d, frac);
+    __m128i hi = _mm_add_epi16(_mm_mulhi_epi16(d, frac),
+                               _mm_and_si128(d, fracSign));
+    return _mm_add_epi32(_mm_unpackhi_epi16(zero, x0),
+                         _mm_unpackhi_epi16(lo, hi));
+}
+
+/**
+ * Bilinear interpolation of four ARGB pixels, all four channels at once.
+ * Gives the same result as interpolate4points() in PiscesPaint.c for
+ * hfrac and vfrac in 0..0xffff.
+ */
+static INLINE jint
+simd_interpolate4points(jint p00, jint p01, jint p10, jint p11,
+                        jint hfrac, jint vfrac) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i round = _mm_set1_epi32(0x8000);
+    // channels of p00 and p10 (resp. p01 and p11) in 16-bit lanes
+    __m128i x0 = _mm_unpacklo_epi8(_mm_unpacklo_epi32(
+                     _mm_cvtsi32_si128(p00), _mm_cvtsi32_si128(p10)), zero);
+    __m128i x1 = _mm_unpacklo_epi8(_mm_unpacklo_epi32(
+                     _mm_cvtsi32_si128(p01), _mm_cvtsi32_si128(p11)), zero);
+    __m128i d = _mm_sub_epi16(x1, x0);
+    __m128i f = _mm_set1_epi16((short)hfrac);
+    __m128i fs = _mm_set1_epi16((hfrac & 0x8000) ? -1 : 0);
+    // horizontal interpolation of the top (r0) and bottom (r1) pixels
+    __m128i r0 = _mm_srai_epi32(_mm_add_epi32(
+                     simd_interpLo(x0, d, f, fs), round), 16);
+    __m128i r1 = _mm_srai_epi32(_mm_add_epi32(
+                     simd_interpHi(x0, d, f, fs), round), 16);
+    __m128i r;
+
+    // vertical interpolation
+    x0 = _mm_packs_epi32(r0, r0);
+    d = _mm_packs_epi32(_mm_sub_epi32(r1, r0), zero);
+    f = _mm_set1_epi16((short)vfrac);
+    fs = _mm_set1_epi16((vfrac & 0x8000) ? -1 : 0);
+    r = _mm_srai_epi32(_mm_add_epi32(simd_interpLo(x0, d, f, fs), round), 16);
+    r = _mm_packs_epi32(r, r);
+    return _mm_cvtsi128_si32(_mm_packus_epi16(r, r));
+}
+
+#endif /* PISCES_USE_SSE2 */
+
+#endif /* PISCES_SIMD_H */
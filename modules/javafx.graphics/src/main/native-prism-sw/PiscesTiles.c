@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <PiscesTiles.h>
+
+#include <PiscesUtil.h>
+#include <PiscesSysutils.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+
+typedef CRITICAL_SECTION tile_mutex_t;
+typedef CONDITION_VARIABLE tile_cond_t;
+
+#define TILE_LOCK(m) EnterCriticalSection(m)
+#define TILE_UNLOCK(m) LeaveCriticalSection(m)
+#define TILE_WAIT(c, m) SleepConditionVariableCS((c), (m), INFINITE)
+#define TILE_SIGNAL(c) WakeConditionVariable(c)
+#define TILE_BROADCAST(c) WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+
+typedef pthread_mutex_t tile_mutex_t;
+typedef pthread_cond_t tile_cond_t;
+
+#define TILE_LOCK(m) pthread_mutex_lock(m)
+#define TILE_UNLOCK(m) pthread_mutex_unlock(m)
+#define TILE_WAIT(c, m) pthread_cond_wait((c), (m))
+#define TILE_SIGNAL(c) pthread_cond_signal(c)
+#define TILE_BROADCAST(c) pthread_cond_broadcast(c)
+#endif
+
+/*
+ * State of a thread taking part in tiled rendering. The thread rendering
+ * a primitive uses workers[0], the pool threads use the other entries.
+ */
+typedef struct _TileWorker {
+    // private copy of the renderer state, refreshed for every primitive
+    Renderer rdr;
+    // paint buffer, kept between primitives
+    jint* _paint;
+    size_t _paint_length;
+} TileWorker;
+
+/*
+ * The primitive being rendered. All fields are set under poolLock before
+ * the workers are woken up; the tile counters are only accessed under it.
+ */
+typedef struct _TileJob {
+    const Renderer* rdr;
+    TileRenderFunc* func;
+    void* data;
+    jint minY, maxY;
+    jint tileCount;
+    jint nextTile;
+    // number of threads allowed to join, joined and still rendering
+    jint maxThreads;
+    jint threads;
+    jint running;
+} TileJob;
+
+#ifdef _WIN32
+static tile_mutex_t poolLock;
+static tile_cond_t workAvailable;
+static tile_cond_t workDone;
+static INIT_ONCE poolInitOnce = INIT_ONCE_STATIC_INIT;
+#else
+static tile_mutex_t poolLock = PTHREAD_MUTEX_INITIALIZER;
+static tile_cond_t workAvailable = PTHREAD_COND_INITIALIZER;
+static tile_cond_t workDone = PTHREAD_COND_INITIALIZER;
+#endif
+
+static TileWorker* workers[MAX_TILE_THREADS];
+static jint workerCount = 0;
+static jint generation = 0;
+static jboolean busy = XNI_FALSE;
+static TileJob job;
+
+static void
+renderTiles(TileWorker* worker) {
+    Renderer* rdr = &worker->rdr;
+    jint tile;
+
+    memcpy(rdr, job.rdr, sizeof(Renderer));
+    rdr->_paint = worker->_paint;
+    rdr->_paint_length = worker->_paint_length;
+
+    for (;;) {
+        jint minY;
+
+        TILE_LOCK(&poolLock);
+        tile = job.nextTile++;
+        TILE_UNLOCK(&poolLock);
+        if (tile >= job.tileCount) {
+            break;
+        }
+
+        minY = job.minY + tile * TILE_HEIGHT;
+        job.func(rdr, minY, MIN(minY + TILE_HEIGHT - 1, job.maxY), job.data);
+    }
+
+    worker->_paint = rdr->_paint;
+    worker->_paint_length = rdr->_paint_length;
+}
+
+static void
+workerLoop(TileWorker* worker) {
+    jint seen = 0;
+
+    TILE_LOCK(&poolLock);
+    for (;;) {
+        while (generation == seen) {
+            TILE_WAIT(&workAvailable, &poolLock);
+        }
+        seen = generation;
+        if (!busy || job.threads >= job.maxThreads) {
+            continue;
+        }
+        job.threads++;
+        job.running++;
+        TILE_UNLOCK(&poolLock);
+
+        renderTiles(worker);
+
+        TILE_LOCK(&poolLock);
+        if (--job.running == 0) {
+            TILE_SIGNAL(&workDone);
+        }
+    }
+}
+
+#ifdef _WIN32
+static unsigned __stdcall
+workerMain(void* arg) {
+    workerLoop((TileWorker*)arg);
+    return 0;
+}
+
+static BOOL CALLBACK
+initPool(PINIT_ONCE initOnce, PVOID param, PVOID* context) {
+    InitializeCriticalSection(&poolLock);
+    InitializeConditionVariable(&workAvailable);
+    InitializeConditionVariable(&workDone);
+    return TRUE;
+}
+
+static jboolean
+startThread(TileWorker* worker) {
+    HANDLE thread = (HANDLE)_beginthreadex(NULL, 0, workerMain, worker, 0, NULL);
+    if (thread == 0) {
+        return XNI_FALSE;
+    }
+    CloseHandle(thread);
+    return XNI_TRUE;
+}
+#else
+static void*
+workerMain(void* arg) {
+    workerLoop((TileWorker*)arg);
+    return NULL;
+}
+
+static jboolean
+startThread(TileWorker* worker) {
+    pthread_t thread;
+    pthread_attr_t attr;
+    int status;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    status = pthread_create(&thread, &attr, workerMain, worker);
+    pthread_attr_destroy(&attr);
+    return (status == 0) ? XNI_TRUE : XNI_FALSE;
+}
+#endif
+
+/*
+ * Starts pool threads until there are count of them, or as many as could
+ * be started. Must be called with poolLock held.
+ */
+static void
+ensureWorkers(jint count) {
+    if (workers[0] == NULL) {
+        workers[0] = my_malloc(TileWorker, 1);
+        if (workers[0] == NULL) {
+            return;
+        }
+    }
+    while (workerCount < count) {
+        TileWorker* worker = my_malloc(TileWorker, 1);
+        if (worker == NULL) {
+            return;
+        }
+        workers[workerCount + 1] = worker;
+        if (!startThread(worker)) {
+            workers[workerCount + 1] = NULL;
+            my_free(worker);
+            return;
+        }
+        workerCount++;
+    }
+}
+
+void
+tiles_setThreadCount(Renderer* rdr, jint threadCount) {
+    rdr->_tileThreadCount = MAX(1, MIN(threadCount, MAX_TILE_THREADS));
+}
+
+jboolean
+tiles_render(Renderer* rdr, jint minY, jint maxY, jint width,
+             TileRenderFunc* func, void* data)
+{
+    jint threads = rdr->_tileThreadCount;
+    jint tileCount = (maxY - minY + TILE_HEIGHT) / TILE_HEIGHT;
+
+    if (threads <= 1 || tileCount < 2 ||
+        (jlong)width * (maxY - minY + 1) < MIN_TILED_PIXELS)
+    {
+        return XNI_FALSE;
+    }
+
+#ifdef _WIN32
+    InitOnceExecuteOnce(&poolInitOnce, initPool, NULL, NULL);
+#endif
+
+    TILE_LOCK(&poolLock);
+    if (busy) {
+        // another renderer is using the pool
+        TILE_UNLOCK(&poolLock);
+        return XNI_FALSE;
+    }
+    ensureWorkers(threads - 1);
+    if (workers[0] == NULL || workerCount == 0) {
+        TILE_UNLOCK(&poolLock);
+        return XNI_FALSE;
+    }
+
+    job.rdr = rdr;
+    job.func = func;
+    job.data = data;
+    job.minY = minY;
+    job.maxY = maxY;
+    job.tileCount = tileCount;
+    job.nextTile = 0;
+    job.maxThreads = MIN(MIN(threads, workerCount + 1), tileCount);
+    job.threads = 1;
+    job.running = 1;
+    busy = XNI_TRUE;
+    generation++;
+    TILE_BROADCAST(&workAvailable);
+    TILE_UNLOCK(&poolLock);
+
+    renderTiles(workers[0]);
+
+    TILE_LOCK(&poolLock);
+    job.running--;
+    while (job.running > 0) {
+        TILE_WAIT(&workDone, &poolLock);
+    }
+    busy = XNI_FALSE;
+    TILE_UNLOCK(&poolLock);
+
+    return XNI_TRUE;
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @file PiscesTiles.h
+ * Tiled rendering of large primitives. The destination rows of a primitive
+ * are split into horizontal tiles which are rendered in parallel by a pool
+ * of worker threads shared by all renderers. Every worker renders its tiles
+ * with a private copy of the renderer state, so the result is identical to
+ * serial rendering.
+ */
+
+#ifndef PISCES_TILES_H
+#define PISCES_TILES_H
+
+#include <PiscesDefs.h>
+#include <PiscesRenderer.h>
+
+/**
+ * @def TILE_HEIGHT
+ * Number of rows in a tile; a multiple of NUM_ALPHA_ROWS.
+ */
+#define TILE_HEIGHT (8 * NUM_ALPHA_ROWS)
+
+/**
+ * @def MIN_TILED_PIXELS
+ * Primitives covering fewer pixels are always rendered serially, as the
+ * cost of waking up the workers would outweigh the gain.
+ */
+#define MIN_TILED_PIXELS (128 * 1024)
+
+/**
+ * @def MAX_TILE_THREADS
+ * Upper bound for the number of threads rendering one primitive.
+ */
+#define MAX_TILE_THREADS 64
+
+/**
+ * Renders rows minY..maxY (inclusive) of a primitive using renderer rdr.
+ * The renderer is a private copy which may be modified freely.
+ */
+typedef void TileRenderFunc(Renderer* rdr, jint minY, jint maxY, void* data);
+
+/**
+ * Sets the number of threads (including the calling thread) which render
+ * the tiles of large primitives drawn by rdr.
+ */
+void tiles_setThreadCount(Renderer* rdr, jint threadCount);
+
+/**
+ * Renders rows minY..maxY of a primitive which is width pixels wide in
+ * tiles of TILE_HEIGHT rows, in parallel. Returns XNI_FALSE without
+ * rendering anything if the primitive should be rendered serially instead:
+ * tiling is disabled for rdr, the primitive is too small, or the worker
+ * threads are unavailable or busy with another renderer.
+ */
+jboolean tiles_render(Renderer* rdr, jint minY, jint maxY, jint width,
+                      TileRenderFunc* func, void* data);
+
+#endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -87,6 +87,26 @@ public abstract class ConnectionHolder {
         return channel.read(buffer);
     }
 
+    /**
+     * Reads a block of data from the current position of the opened stream
+     * directly into the given buffer. The buffer is a direct buffer wrapping
+     * native memory which is only valid for the duration of the call, so it
+     * must not be retained.
+     *
+     * @return The number of bytes read, possibly zero, or -1 if the channel
+     * has reached end-of-stream.
+     *
+     * @throws ClosedChannelException if an attempt is made to read after
+     * closeConnection has been called
+     */
+    int readNextBlock(ByteBuffer destination) throws IOException {
+        // avoid NPE if channel does not exist or has been closed
+        if (null == channel) {
+            throw new ClosedChannelException();
+        }
+        return channel.read(destination);
+    }
+
     public ByteBuffer getBuffer() {
         return buffer;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,9 +26,12 @@
 package com.sun.media.jfxmediaimpl;
 
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
 
 final class NativeAudioSpectrum implements AudioSpectrum {
-    private static final float[] EMPTY_FLOAT_ARRAY  = new float[0];
+    private static final FloatBuffer EMPTY_FLOAT_BUFFER = FloatBuffer.allocate(0);
     public static final int      DEFAULT_THRESHOLD = -60;
     public static final int      DEFAULT_BANDS = 128;
     public static final double   DEFAULT_INTERVAL = 0.1;
@@ -38,8 +41,14 @@ final class NativeAudioSpectrum implements AudioSpectrum {
      */
     private final long nativeRef;
 
-    private float[] magnitudes = EMPTY_FLOAT_ARRAY;
-    private float[] phases = EMPTY_FLOAT_ARRAY;
+    /**
+     * Band values shared with the native spectrum: <code>bandCount</code>
+     * magnitudes followed by <code>bandCount</code> phases. The buffer is
+     * direct so that native code can write new bands in place without
+     * attaching to the VM for every spectrum message.
+     */
+    private FloatBuffer bands = EMPTY_FLOAT_BUFFER;
+    private int bandCount = 0;
 
     //**************************************************************************
     //***** Constructors
@@ -73,23 +82,25 @@ final class NativeAudioSpectrum implements AudioSpectrum {
 
     @Override
     public int getBandCount() {
-        // just return the current size of one of the band arrays
-        return phases.length;
+        return bandCount;
     }
 
     @Override
     public void setBandCount(int bands) {
         if (bands > 1) {
-            magnitudes = new float[bands];
-            for (int i = 0; i < magnitudes.length; i++) {
-                magnitudes[i] = DEFAULT_THRESHOLD;//Float.NEGATIVE_INFINITY;
+            FloatBuffer buffer = ByteBuffer.allocateDirect(2 * bands * Float.BYTES)
+                                           .order(ByteOrder.nativeOrder())
+                                           .asFloatBuffer();
+            for (int i = 0; i < bands; i++) {
+                buffer.put(i, DEFAULT_THRESHOLD);//Float.NEGATIVE_INFINITY;
             }
 
-            phases = new float[bands];
-            nativeSetBands(nativeRef, bands, magnitudes, phases);
+            this.bands = buffer;
+            this.bandCount = bands;
+            nativeSetBands(nativeRef, bands, buffer);
         } else {
-            magnitudes = EMPTY_FLOAT_ARRAY;
-            phases = EMPTY_FLOAT_ARRAY;
+            this.bands = EMPTY_FLOAT_BUFFER;
+            this.bandCount = 0;
 
             throw new IllegalArgumentException("Number of bands must at least be 2");
         }
@@ -125,21 +136,23 @@ final class NativeAudioSpectrum implements AudioSpectrum {
 
     @Override
     public float[] getMagnitudes(float[] mag) {
-        int size = magnitudes.length;
+        FloatBuffer buffer = bands;
+        int size = buffer.capacity() / 2;
         if(mag == null || mag.length < size) {
             mag = new float[size];
         }
-        System.arraycopy(magnitudes, 0, mag, 0, size);
+        buffer.get(0, mag, 0, size);
         return mag;
     }
 
     @Override
     public float[] getPhases(float[] phs) {
-        int size = phases.length;
+        FloatBuffer buffer = bands;
+        int size = buffer.capacity() / 2;
         if(phs == null || phs.length < size) {
             phs = new float[size];
         }
-        System.arraycopy(phases, 0, phs, 0, size);
+        buffer.get(size, phs, 0, size);
         return phs;
     }
 
@@ -148,7 +161,7 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     //**************************************************************************
     private native boolean nativeGetEnabled(long nativeRef);
     private native void    nativeSetEnabled(long nativeRef, boolean enable);
-    private native void    nativeSetBands(long nativeRef, int bands, float[] magnitudes, float[] phases);
+    private native void    nativeSetBands(long nativeRef, int bands, FloatBuffer buffer);
     private native double  nativeGetInterval(long nativeRef);
     private native void    nativeSetInterval(long nativeRef, double interval);
     private native int     nativeGetThreshold(long nativeRef);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -291,6 +291,13 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         }
     }
 
+    /**
+     * Event posted when a video frame is waiting in the native latest-frame
+     * mailbox.
+     */
+    private static class FrameAvailableEvent extends PlayerEvent {
+    }
+
     /**
      * Helper class which managers {@link VideoRendererListener}s. This allows
      * any registered listeners, specifically AWT and Prism, to receive video
@@ -398,7 +405,15 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
                     PlayerEvent evt = eventQueue.take();
 
                     if (!stopped) {
-                        if (evt instanceof NewFrameEvent) {
+                        if (evt instanceof FrameAvailableEvent) {
+                            try {
+                                HandleFrameAvailableEvents();
+                            } catch (Throwable t) {
+                                if (Logger.canLog(Logger.ERROR)) {
+                                    Logger.logMsg(Logger.ERROR, "Caught exception in HandleFrameAvailableEvents: " + t.toString());
+                                }
+                            }
+                        } else if (evt instanceof NewFrameEvent) {
                             try {
                                 HandleRendererEvents((NewFrameEvent) evt);
                             } catch (Throwable t) {
@@ -438,6 +453,27 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
             eventQueue.clear();
         }
 
+        private void HandleFrameAvailableEvents() {
+            // Take whatever frame is newest by now; frames superseded since
+            // the notification was sent have already been dropped natively.
+            // The event loop is not joined on dispose, so hold disposeLock
+            // to keep the native player alive while the frame is taken.
+            long nativeRef = 0;
+            disposeLock.lock();
+            try {
+                if (!isDisposed) {
+                    nativeRef = playerTakeLatestFrame();
+                }
+            } catch (MediaException me) {
+                sendPlayerEvent(new MediaErrorEvent(NativeMediaPlayer.this, me.getMediaError()));
+            } finally {
+                disposeLock.unlock();
+            }
+            if (nativeRef != 0) {
+                HandleRendererEvents(new NewFrameEvent(NativeVideoBuffer.createVideoBuffer(nativeRef)));
+            }
+        }
+
         private void HandleRendererEvents(NewFrameEvent evt) {
             if (isFirstFrame) {
                 // Cache first frame. Frames are delivered time-sequentially
@@ -1308,6 +1344,18 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
 
     protected abstract void playerDispose();
 
+    /**
+     * Takes the newest decoded video frame out of the native latest-frame
+     * mailbox of players that deliver frames through one, see
+     * {@link #sendNewFrameEvent(long)}.
+     *
+     * @return a native frame reference to be wrapped in a
+     * {@link NativeVideoBuffer}, or 0 if no frame is waiting
+     */
+    protected long playerTakeLatestFrame() throws MediaException {
+        return 0;
+    }
+
     /**
      * Retrieves the current {@link PlayerState state} of the player.
      *
@@ -1493,7 +1541,19 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         }
     }
 
+    /**
+     * Delivers a decoded video frame. A {@code nativeRef} of 0 means that the
+     * frame was left in the native latest-frame mailbox, and that it is taken
+     * from there on the event thread with {@link #playerTakeLatestFrame()}.
+     * Native code sends at most one such notification until the mailbox has
+     * been emptied, so frames that arrive in the meantime replace each other
+     * without any Java objects being created for them.
+     */
     protected void sendNewFrameEvent(long nativeRef) {
+        if (nativeRef == 0) {
+            sendPlayerEvent(new FrameAvailableEvent());
+            return;
+        }
         NativeVideoBuffer newFrameData = NativeVideoBuffer.createVideoBuffer(nativeRef);
         // createVideoBuffer puts a hold on the frame
         // we need to keep that hold until the event thread can process this event
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,8 @@ import com.sun.media.jfxmedia.locator.Locator;
 import com.sun.media.jfxmediaimpl.MediaUtils;
 import com.sun.media.jfxmediaimpl.NativeMedia;
 import com.sun.media.jfxmediaimpl.platform.Platform;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
 
 /**
  * GStreamer implementation of Media
@@ -46,6 +48,42 @@ final class GSTMedia extends NativeMedia {
      */
     protected long refNativeMedia;
 
+    /**
+     * Upper limit of the video decoder thread count.
+     */
+    private static final int MAX_VIDEO_DECODER_THREADS = 64;
+
+    /**
+     * Upper limit of the number of blocks the source reads ahead.
+     */
+    private static final int MAX_SOURCE_READ_AHEAD = 256;
+
+    /**
+     * Names of the spectrum window functions, in the order of the native
+     * GstFFTWindow values.
+     */
+    private static final String[] SPECTRUM_WINDOWS = {
+        "rectangular", "hamming", "hann", "bartlett", "blackman"
+    };
+
+    /**
+     * Window used by the spectrum when none or an unknown one is requested.
+     */
+    private static final int DEFAULT_SPECTRUM_WINDOW = 1; // hamming
+
+    /**
+     * Upper limit of the spectrum frame overlap, in percent.
+     */
+    private static final int MAX_SPECTRUM_OVERLAP = 90;
+
+    /**
+     * Names of the buffering policies, in the order of the native
+     * CPipelineOptions values.
+     */
+    private static final String[] BUFFERING_POLICIES = {
+        "balanced", "lowLatency", "highThroughput", "auto"
+    };
+
     GSTMedia(Locator locator) {
         super(locator);
 
@@ -64,13 +102,90 @@ final class GSTMedia extends NativeMedia {
         Locator loc = getLocator();
         ret = MediaError.getFromCode(gstInitNativeMedia(loc,
                 loc.getContentType(), loc.getContentLength(),
-                nativeMediaHandle));
+                getVideoDecoderThreads(), getSourceReadAhead(),
+                getSpectrumWindow(), getSpectrumOverlap(),
+                getBufferingPolicy(), nativeMediaHandle));
         if (ret != MediaError.ERROR_NONE && ret != MediaError.ERROR_PLATFORM_UNSUPPORTED) {
             MediaUtils.nativeError(this, ret);
         }
         this.refNativeMedia = nativeMediaHandle[0];
     }
 
+    /**
+     * Returns the number of threads the video decoder should use, 0 to use
+     * one per core. The property is read for every new media, so it may be
+     * changed between players, e.g., -Djfxmedia.videoDecoderThreads=2
+     */
+    private static int getVideoDecoderThreads() {
+        @SuppressWarnings("removal")
+        int threads = AccessController.doPrivileged((PrivilegedAction<Integer>) () ->
+                Integer.getInteger("jfxmedia.videoDecoderThreads", 0));
+        return Math.max(0, Math.min(threads, MAX_VIDEO_DECODER_THREADS));
+    }
+
+    /**
+     * Returns the number of blocks the source should read ahead of the
+     * pipeline on a separate thread, 0 to read on the streaming thread.
+     * Only streamed sources which are not HLS use it, e.g.,
+     * -Djfxmedia.sourceReadAhead=16
+     */
+    private static int getSourceReadAhead() {
+        @SuppressWarnings("removal")
+        int blocks = AccessController.doPrivileged((PrivilegedAction<Integer>) () ->
+                Integer.getInteger("jfxmedia.sourceReadAhead", 0));
+        return Math.max(0, Math.min(blocks, MAX_SOURCE_READ_AHEAD));
+    }
+
+    /**
+     * Returns the window function the audio spectrum applies to each frame
+     * before the FFT, e.g., -Djfxmedia.spectrumWindow=hann
+     */
+    private static int getSpectrumWindow() {
+        @SuppressWarnings("removal")
+        String window = AccessController.doPrivileged((PrivilegedAction<String>) () ->
+                System.getProperty("jfxmedia.spectrumWindow"));
+        if (window != null) {
+            for (int i = 0; i < SPECTRUM_WINDOWS.length; i++) {
+                if (SPECTRUM_WINDOWS[i].equalsIgnoreCase(window.trim())) {
+                    return i;
+                }
+            }
+        }
+        return DEFAULT_SPECTRUM_WINDOW;
+    }
+
+    /**
+     * Returns how much consecutive audio spectrum frames overlap, in percent
+     * of the frame size. Overlapping frames give a smoother spectrum at the
+     * cost of more FFTs per interval, e.g., -Djfxmedia.spectrumOverlap=50
+     */
+    private static int getSpectrumOverlap() {
+        @SuppressWarnings("removal")
+        int overlap = AccessController.doPrivileged((PrivilegedAction<Integer>) () ->
+                Integer.getInteger("jfxmedia.spectrumOverlap", 0));
+        return Math.max(0, Math.min(overlap, MAX_SPECTRUM_OVERLAP));
+    }
+
+    /**
+     * Returns how the queues in front of the decoders are sized: "balanced"
+     * (the default), "lowLatency" for low bitrate media, "highThroughput" for
+     * high bitrate media, or "auto" to grow them from the observed bitrate
+     * and decode time, e.g., -Djfxmedia.bufferingPolicy=auto
+     */
+    private static int getBufferingPolicy() {
+        @SuppressWarnings("removal")
+        String policy = AccessController.doPrivileged((PrivilegedAction<String>) () ->
+                System.getProperty("jfxmedia.bufferingPolicy"));
+        if (policy != null) {
+            for (int i = 0; i < BUFFERING_POLICIES.length; i++) {
+                if (BUFFERING_POLICIES[i].equalsIgnoreCase(policy.trim())) {
+                    return i;
+                }
+            }
+        }
+        return 0;
+    }
+
     long getNativeMediaRef() {
         return refNativeMedia;
     }
@@ -87,11 +202,18 @@ final class GSTMedia extends NativeMedia {
      * Initialize the native peer of this {@link Media}.
      *
      * @param locator Media location as a Locator object.
+     * @param videoDecoderThreads Number of video decoding threads, 0 for automatic.
+     * @param sourceReadAhead Number of blocks read ahead by the source, 0 to disable.
      * @return A handle to the native peer of the media.
      */
     private native int gstInitNativeMedia(Locator locator,
                                                String contentType,
                                                long sizeHint,
+                                               int videoDecoderThreads,
+                                               int sourceReadAhead,
+                                               int spectrumWindow,
+                                               int spectrumOverlap,
+                                               int bufferingPolicy,
                                                long[] nativeMediaHandle);
     private native void gstDispose(long refNativeMedia);
 }
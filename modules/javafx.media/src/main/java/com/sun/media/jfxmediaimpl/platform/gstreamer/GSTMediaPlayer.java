@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -164,6 +164,15 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
         return presentationTime[0];
     }
 
+    @Override
+    protected long playerTakeLatestFrame() throws MediaException {
+        GSTMedia media = gstMedia;
+        if (media == null) {
+            return 0;
+        }
+        return gstTakeLatestFrame(media.getNativeMediaRef());
+    }
+
     @Override
     protected boolean playerGetMute() throws MediaException {
         return muteEnabled;
@@ -297,4 +306,5 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
     private native int gstSetBalance(long refNativeMedia, float balance);
     private native int gstGetDuration(long refNativeMedia, double[] duration);
     private native int gstSeek(long refNativeMedia, double streamTime);
+    private native long gstTakeLatestFrame(long refNativeMedia);
 }
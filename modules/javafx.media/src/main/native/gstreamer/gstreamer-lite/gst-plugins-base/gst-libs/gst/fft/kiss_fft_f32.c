@@ -12,6 +12,59 @@
  fixed or floating point complex numbers.  It also delares the kf_ internal functions.
  */
 
+#ifdef GSTREAMER_LITE
+/* The radix-2, radix-4 and generic butterflies process two complex values per
+ * vector. Each lane performs the same operations as the scalar code, so the
+ * vector and scalar paths produce the same results. */
+#if !defined (FIXED_POINT) && (defined (__SSE2__) || defined (_M_X64) || defined (_M_AMD64))
+#include <emmintrin.h>
+#define KISS_FFT_F32_SIMD
+typedef __m128 kf_v2cpx;
+#define KF_LOAD(p)            _mm_loadu_ps ((const float *) (p))
+#define KF_STORE(p, v)        _mm_storeu_ps ((float *) (p), (v))
+#define KF_LOAD2(p0, p1)      _mm_loadh_pi (_mm_loadl_pi (_mm_setzero_ps (), (const __m64 *) (p0)), (const __m64 *) (p1))
+#define KF_STORE2(p0, p1, v)  do { _mm_storel_pi ((__m64 *) (p0), (v)); _mm_storeh_pi ((__m64 *) (p1), (v)); } while (0)
+#define KF_DUP(p)             KF_LOAD2 ((p), (p))
+#define KF_ADD(a, b)          _mm_add_ps ((a), (b))
+#define KF_SUB(a, b)          _mm_sub_ps ((a), (b))
+#define KF_MUL(a, b)          _mm_mul_ps ((a), (b))
+#define KF_DUP_RE(a)          _mm_shuffle_ps ((a), (a), _MM_SHUFFLE (2, 2, 0, 0))
+#define KF_DUP_IM(a)          _mm_shuffle_ps ((a), (a), _MM_SHUFFLE (3, 3, 1, 1))
+#define KF_SWAP(a)            _mm_shuffle_ps ((a), (a), _MM_SHUFFLE (2, 3, 0, 1))
+#define KF_NEG_RE(a)          _mm_xor_ps ((a), _mm_castsi128_ps (_mm_set_epi32 (0, (int) 0x80000000, 0, (int) 0x80000000)))
+#define KF_NEG_IM(a)          _mm_xor_ps ((a), _mm_castsi128_ps (_mm_set_epi32 ((int) 0x80000000, 0, (int) 0x80000000, 0)))
+#elif !defined (FIXED_POINT) && defined (__aarch64__)
+#include <arm_neon.h>
+#define KISS_FFT_F32_SIMD
+typedef float32x4_t kf_v2cpx;
+static const uint32_t kf_neg_re_mask[4] = { 0x80000000, 0, 0x80000000, 0 };
+static const uint32_t kf_neg_im_mask[4] = { 0, 0x80000000, 0, 0x80000000 };
+#define KF_LOAD(p)            vld1q_f32 ((const float *) (p))
+#define KF_STORE(p, v)        vst1q_f32 ((float *) (p), (v))
+#define KF_LOAD2(p0, p1)      vcombine_f32 (vld1_f32 ((const float *) (p0)), vld1_f32 ((const float *) (p1)))
+#define KF_STORE2(p0, p1, v)  do { vst1_f32 ((float *) (p0), vget_low_f32 (v)); vst1_f32 ((float *) (p1), vget_high_f32 (v)); } while (0)
+#define KF_DUP(p)             KF_LOAD2 ((p), (p))
+#define KF_ADD(a, b)          vaddq_f32 ((a), (b))
+#define KF_SUB(a, b)          vsubq_f32 ((a), (b))
+#define KF_MUL(a, b)          vmulq_f32 ((a), (b))
+#define KF_DUP_RE(a)          vtrn1q_f32 ((a), (a))
+#define KF_DUP_IM(a)          vtrn2q_f32 ((a), (a))
+#define KF_SWAP(a)            vrev64q_f32 (a)
+#define KF_NEG_RE(a)          vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (a), vld1q_u32 (kf_neg_re_mask)))
+#define KF_NEG_IM(a)          vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (a), vld1q_u32 (kf_neg_im_mask)))
+#endif
+
+#ifdef KISS_FFT_F32_SIMD
+/* C_MUL for two complex values: (a.r*b.r - a.i*b.i, a.r*b.i + a.i*b.r) */
+static inline kf_v2cpx
+kf_cmul (kf_v2cpx a, kf_v2cpx b)
+{
+  return KF_ADD (KF_MUL (KF_DUP_RE (a), b),
+      KF_NEG_RE (KF_MUL (KF_DUP_IM (a), KF_SWAP (b))));
+}
+#endif // KISS_FFT_F32_SIMD
+#endif // GSTREAMER_LITE
+
 static void
 kf_bfly2 (kiss_fft_f32_cpx * Fout,
     const size_t fstride, const kiss_fft_f32_cfg st, int m)
@@ -20,6 +73,19 @@ kf_bfly2 (kiss_fft_f32_cpx * Fout,
   kiss_fft_f32_cpx *tw1 = st->twiddles;
   kiss_fft_f32_cpx t;
   Fout2 = Fout + m;
+#ifdef KISS_FFT_F32_SIMD
+  for (; m >= 2; m -= 2) {
+    kf_v2cpx f = KF_LOAD (Fout);
+    kf_v2cpx tv = kf_cmul (KF_LOAD (Fout2), KF_LOAD2 (tw1, tw1 + fstride));
+    tw1 += 2 * fstride;
+    KF_STORE (Fout2, KF_SUB (f, tv));
+    KF_STORE (Fout, KF_ADD (f, tv));
+    Fout2 += 2;
+    Fout += 2;
+  }
+  if (m == 0)
+    return;
+#endif // KISS_FFT_F32_SIMD
   do {
     C_FIXDIV (*Fout, 2);
     C_FIXDIV (*Fout2, 2);
@@ -46,6 +112,41 @@ kf_bfly4 (kiss_fft_f32_cpx * Fout,
 
   tw3 = tw2 = tw1 = st->twiddles;
 
+#ifdef KISS_FFT_F32_SIMD
+  for (; k >= 2; k -= 2) {
+    kf_v2cpx f = KF_LOAD (Fout);
+    kf_v2cpx s0 = kf_cmul (KF_LOAD (Fout + m), KF_LOAD2 (tw1, tw1 + fstride));
+    kf_v2cpx s1 =
+        kf_cmul (KF_LOAD (Fout + m2), KF_LOAD2 (tw2, tw2 + fstride * 2));
+    kf_v2cpx s2 =
+        kf_cmul (KF_LOAD (Fout + m3), KF_LOAD2 (tw3, tw3 + fstride * 3));
+    kf_v2cpx s3, s4, s5;
+
+    s5 = KF_SUB (f, s1);
+    f = KF_ADD (f, s1);
+    s3 = KF_ADD (s0, s2);
+    s4 = KF_SUB (s0, s2);
+    KF_STORE (Fout + m2, KF_SUB (f, s3));
+    KF_STORE (Fout, KF_ADD (f, s3));
+    tw1 += fstride * 2;
+    tw2 += fstride * 4;
+    tw3 += fstride * 6;
+
+    /* (scratch[4].i, -scratch[4].r) */
+    s4 = KF_NEG_IM (KF_SWAP (s4));
+    if (st->inverse) {
+      KF_STORE (Fout + m, KF_SUB (s5, s4));
+      KF_STORE (Fout + m3, KF_ADD (s5, s4));
+    } else {
+      KF_STORE (Fout + m, KF_ADD (s5, s4));
+      KF_STORE (Fout + m3, KF_SUB (s5, s4));
+    }
+    Fout += 2;
+  }
+  if (k == 0)
+    return;
+#endif // KISS_FFT_F32_SIMD
+
   do {
     C_FIXDIV (*Fout, 4);
     C_FIXDIV (Fout[m], 4);
@@ -217,7 +318,28 @@ kf_bfly_generic (kiss_fft_f32_cpx * Fout,
     }
 
     k = u;
-    for (q1 = 0; q1 < p; ++q1) {
+    q1 = 0;
+#ifdef KISS_FFT_F32_SIMD
+    /* outputs k and k + m at once, they share the scratch values */
+    for (; q1 + 1 < p; q1 += 2) {
+      int twidx0 = 0, twidx1 = 0;
+      int k1 = k + m;
+      kf_v2cpx acc = KF_DUP (&scratch[0]);
+      for (q = 1; q < p; ++q) {
+        twidx0 += fstride * k;
+        if (twidx0 >= Norig)
+          twidx0 -= Norig;
+        twidx1 += fstride * k1;
+        if (twidx1 >= Norig)
+          twidx1 -= Norig;
+        acc = KF_ADD (acc, kf_cmul (KF_DUP (&scratch[q]),
+                KF_LOAD2 (&twiddles[twidx0], &twiddles[twidx1])));
+      }
+      KF_STORE2 (&Fout[k], &Fout[k1], acc);
+      k += 2 * m;
+    }
+#endif // KISS_FFT_F32_SIMD
+    for (; q1 < p; ++q1) {
       int twidx = 0;
       Fout[k] = scratch[0];
       for (q = 1; q < p; ++q) {
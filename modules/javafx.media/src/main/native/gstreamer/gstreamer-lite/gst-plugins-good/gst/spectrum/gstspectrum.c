@@ -73,6 +73,7 @@ GST_DEBUG_CATEGORY_STATIC (gst_spectrum_debug);
 
 #ifdef GSTREAMER_LITE
 #define MAX_BANDS    1024
+#define MAX_OVERLAP  90
 #endif // GSTREAMER_LITE
 
 #define ALLOWED_CAPS \
@@ -87,6 +88,10 @@ GST_DEBUG_CATEGORY_STATIC (gst_spectrum_debug);
 #define DEFAULT_BANDS     128
 #define DEFAULT_THRESHOLD   -60
 #define DEFAULT_MULTI_CHANNEL   FALSE
+#ifdef GSTREAMER_LITE
+#define DEFAULT_WINDOW    GST_FFT_WINDOW_HAMMING
+#define DEFAULT_OVERLAP   0
+#endif // GSTREAMER_LITE
 
 enum
 {
@@ -97,7 +102,11 @@ enum
   PROP_INTERVAL,
   PROP_BANDS,
   PROP_THRESHOLD,
-  PROP_MULTI_CHANNEL
+  PROP_MULTI_CHANNEL,
+#ifdef GSTREAMER_LITE
+  PROP_WINDOW,
+  PROP_OVERLAP,
+#endif // GSTREAMER_LITE
 };
 
 #define gst_spectrum_parent_class parent_class
@@ -200,6 +209,20 @@ gst_spectrum_class_init (GstSpectrumClass * klass)
           "Send separate results for each channel",
           DEFAULT_MULTI_CHANNEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+#ifdef GSTREAMER_LITE
+  g_object_class_install_property (gobject_class, PROP_WINDOW,
+      g_param_spec_uint ("window", "Window",
+          "Window function applied before each FFT (see GstFFTWindow)",
+          GST_FFT_WINDOW_RECTANGULAR, GST_FFT_WINDOW_BLACKMAN, DEFAULT_WINDOW,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, PROP_OVERLAP,
+      g_param_spec_uint ("overlap", "Overlap",
+          "Percentage of samples shared by consecutive FFTs",
+          0, MAX_OVERLAP, DEFAULT_OVERLAP,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+#endif // GSTREAMER_LITE
+
   GST_DEBUG_CATEGORY_INIT (gst_spectrum_debug, "spectrum", 0,
       "audio spectrum analyser element");
 
@@ -224,6 +247,10 @@ gst_spectrum_init (GstSpectrum * spectrum)
   spectrum->interval = DEFAULT_INTERVAL;
   spectrum->bands = DEFAULT_BANDS;
   spectrum->threshold = DEFAULT_THRESHOLD;
+#ifdef GSTREAMER_LITE
+  spectrum->window = DEFAULT_WINDOW;
+  spectrum->overlap = DEFAULT_OVERLAP;
+#endif // GSTREAMER_LITE
 
 #if defined (GSTREAMER_LITE) && defined (OSX)
   spectrum->bps_user = 0;
@@ -369,6 +396,18 @@ gst_spectrum_set_property (GObject * object, guint prop_id,
       g_mutex_unlock (&filter->lock);
       break;
     }
+#ifdef GSTREAMER_LITE
+    case PROP_WINDOW:
+      g_mutex_lock (&filter->lock);
+      filter->window = (GstFFTWindow) g_value_get_uint (value);
+      g_mutex_unlock (&filter->lock);
+      break;
+    case PROP_OVERLAP:
+      g_mutex_lock (&filter->lock);
+      filter->overlap = g_value_get_uint (value);
+      g_mutex_unlock (&filter->lock);
+      break;
+#endif // GSTREAMER_LITE
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -403,6 +442,14 @@ gst_spectrum_get_property (GObject * object, guint prop_id,
     case PROP_MULTI_CHANNEL:
       g_value_set_boolean (value, filter->multi_channel);
       break;
+#ifdef GSTREAMER_LITE
+    case PROP_WINDOW:
+      g_value_set_uint (value, filter->window);
+      break;
+    case PROP_OVERLAP:
+      g_value_set_uint (value, filter->overlap);
+      break;
+#endif // GSTREAMER_LITE
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -780,7 +827,11 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
   for (i = 0; i < nfft; i++)
     input_tmp[i] = input[(input_pos + i) % nfft];
 
+#ifdef GSTREAMER_LITE
+  gst_fft_f32_window (fft_ctx, input_tmp, spectrum->window);
+#else // GSTREAMER_LITE
   gst_fft_f32_window (fft_ctx, input_tmp, GST_FFT_WINDOW_HAMMING);
+#endif // GSTREAMER_LITE
 
   gst_fft_f32_fft (fft_ctx, input_tmp, freqdata);
 
@@ -855,6 +906,7 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
   gfloat max_value;
   guint bands;
   guint nfft;
+  guint hop;
   guint input_pos;
   gfloat *input;
   GstMapInfo map;
@@ -882,6 +934,10 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
   max_value = (1UL << ((bps << 3) - 1)) - 1;
   bands = spectrum->bands;
   nfft = 2 * bands - 2;
+  /* with overlap the FFT runs every hop frames over the last nfft frames */
+  hop = nfft - (nfft * spectrum->overlap) / 100;
+  if (hop == 0)
+    hop = 1;
 #else // GSTREAMER_LITE
 
   guint rate = GST_AUDIO_FILTER_RATE (spectrum);
@@ -953,7 +1009,11 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
 
   while (size >= bpf) {
     /* run input_data for a chunk of data */
+#ifdef GSTREAMER_LITE
+    fft_todo = hop - (spectrum->num_frames % hop);
+#else // GSTREAMER_LITE
     fft_todo = nfft - (spectrum->num_frames % nfft);
+#endif // GSTREAMER_LITE
     msg_todo = spectrum->frames_todo - spectrum->num_frames;
     GST_LOG_OBJECT (spectrum,
         "message frames todo: %u, fft frames todo: %u, input frames %"
@@ -978,6 +1038,16 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
 
     have_full_interval = (spectrum->num_frames == spectrum->frames_todo);
 
+#ifdef GSTREAMER_LITE
+    GST_LOG_OBJECT (spectrum,
+        "size: %" G_GSIZE_FORMAT ", do-fft = %d, do-message = %d", size,
+        (spectrum->num_frames % hop == 0), have_full_interval);
+
+    /* If we have enough frames for an FFT or we have all frames required for
+     * the interval and we haven't run a FFT, then run an FFT */
+    if ((spectrum->num_frames % hop == 0) ||
+        (have_full_interval && !spectrum->num_fft)) {
+#else // GSTREAMER_LITE
     GST_LOG_OBJECT (spectrum,
         "size: %" G_GSIZE_FORMAT ", do-fft = %d, do-message = %d", size,
         (spectrum->num_frames % nfft == 0), have_full_interval);
@@ -986,6 +1056,7 @@ gst_spectrum_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
      * the interval and we haven't run a FFT, then run an FFT */
     if ((spectrum->num_frames % nfft == 0) ||
         (have_full_interval && !spectrum->num_fft)) {
+#endif // GSTREAMER_LITE
       for (c = 0; c < output_channels; c++) {
         cd = &spectrum->channel_data[c];
         gst_spectrum_run_fft (spectrum, cd, input_pos);
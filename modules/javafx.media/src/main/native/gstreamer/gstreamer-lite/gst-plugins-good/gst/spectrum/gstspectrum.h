@@ -73,6 +73,10 @@ struct _GstSpectrum
   guint bands;                  /* number of spectrum bands */
   gint threshold;               /* energy level threshold */
   gboolean multi_channel;       /* send separate channel results */
+#ifdef GSTREAMER_LITE
+  GstFFTWindow window;          /* window function applied before FFT */
+  guint overlap;                /* percentage of frames shared by FFTs */
+#endif // GSTREAMER_LITE
 
   guint64 num_frames;           /* frame count (1 sample per channel)
                                  * since last emit */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -73,6 +73,9 @@ GType basedecoder_get_type (void)
 
 static void basedecoder_init(BaseDecoder *self)
 {
+    // Survives basedecoder_init_state(), so it can be configured before the
+    // decoder is opened.
+    self->thread_count = 1;
 }
 
 static void basedecoder_class_init(BaseDecoderClass *g_class)
@@ -153,6 +156,14 @@ static void basedecoder_init_context_default(BaseDecoder *decoder)
         decoder->context->extradata = decoder->codec_data;
         decoder->context->extradata_size = decoder->codec_data_size;
     }
+
+    if (decoder->thread_count != 1)
+    {
+        // Frame threading is preferred by libavcodec when both are allowed,
+        // slice threading is used for streams it cannot frame-thread.
+        decoder->context->thread_count = decoder->thread_count;
+        decoder->context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+    }
 }
 
 void basedecoder_set_codec_data(BaseDecoder *decoder, GstStructure *s)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -56,6 +56,8 @@ struct _BaseDecoder
 
     gboolean      is_hls;
 
+    gint          thread_count;      // number of decoding threads, 0 lets libavcodec decide
+
     guint8        *codec_data;       // codec-specific data
     gint          codec_data_size;   // number of bytes of codec-specific data
 
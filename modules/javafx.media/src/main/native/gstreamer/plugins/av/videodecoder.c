@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,7 @@
 #include "fxplugins_common.h"
 #include <libavformat/avformat.h>
 #include <libavutil/pixfmt.h>
+#include <libavutil/imgutils.h>
 
 GST_DEBUG_CATEGORY_STATIC(videodecoder_debug);
 #define GST_CAT_DEFAULT videodecoder_debug
@@ -45,8 +46,13 @@ enum
     PROP_0,
     PROP_CODEC_ID,
     PROP_IS_SUPPORTED,
+    PROP_THREAD_COUNT,
 };
 
+// Statistics are posted on the bus every VIDEODECODER_STATS_INTERVAL frames
+// and at the end of stream.
+#define VIDEODECODER_STATS_INTERVAL 300
+
 /*
  * The input capabilities.
  */
@@ -118,10 +124,15 @@ static GstFlowReturn        videodecoder_chain(GstPad *pad, GstObject *parent, G
 
 static void                 videodecoder_init_state(VideoDecoder *decoder);
 static void                 videodecoder_state_reset(VideoDecoder *decoder);
+static GstFlowReturn        videodecoder_drain(VideoDecoder *decoder);
 
 static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps);
 
 static void videodecoder_dispose(GObject* object);
+static void videodecoder_finalize(GObject* object);
+#if ZERO_COPY_FRAMES
+static void videodecoder_init_context(BaseDecoder *base);
+#endif // ZERO_COPY_FRAMES
 static void videodecoder_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
 static void videodecoder_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
 
@@ -144,9 +155,14 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     element_class->change_state = videodecoder_change_state;
 
     gobject_class->dispose = videodecoder_dispose;
+    gobject_class->finalize = videodecoder_finalize;
     gobject_class->set_property = videodecoder_set_property;
     gobject_class->get_property = videodecoder_get_property;
 
+#if ZERO_COPY_FRAMES
+    BASEDECODER_CLASS(klass)->init_context = videodecoder_init_context;
+#endif // ZERO_COPY_FRAMES
+
     g_object_class_install_property (gobject_class, PROP_CODEC_ID,
         g_param_spec_int ("codec-id", "Codec ID", "Codec ID", -1, G_MAXINT, 0,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
@@ -154,6 +170,10 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     g_object_class_install_property (gobject_class, PROP_IS_SUPPORTED,
         g_param_spec_boolean ("is-supported", "Is supported", "Is codec ID supported", FALSE,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_THREAD_COUNT,
+        g_param_spec_int ("thread-count", "Thread count", "Number of decoding threads, 0 for one per core", 0, 64, 0,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
 }
 
 static void videodecoder_init(VideoDecoder *decoder)
@@ -170,10 +190,23 @@ static void videodecoder_init(VideoDecoder *decoder)
     base->srcpad = gst_pad_new_from_static_template(&source_template, "src");
     gst_pad_use_fixed_caps(base->srcpad);
     gst_element_add_pad(GST_ELEMENT(decoder), base->srcpad);
+
+#if ZERO_COPY_FRAMES
+    g_mutex_init(&decoder->frame_pool_lock);
+#endif // ZERO_COPY_FRAMES
 }
 
 void videodecoder_close_decoder(VideoDecoder *decoder)
 {
+#if ZERO_COPY_FRAMES
+    // Buffers still held downstream keep the pool alive until released.
+    g_mutex_lock(&decoder->frame_pool_lock);
+    if (decoder->frame_pool)
+        av_buffer_pool_uninit(&decoder->frame_pool);
+    decoder->frame_pool_size = 0;
+    g_mutex_unlock(&decoder->frame_pool_lock);
+#endif // ZERO_COPY_FRAMES
+
 #if HEVC_SUPPORT
     if (decoder->dest_frame)
     {
@@ -199,11 +232,23 @@ static void videodecoder_dispose(GObject* object)
 {
     VideoDecoder *decoder = VIDEODECODER(object);
 
-    basedecoder_close_decoder(decoder);
+    basedecoder_close_decoder(BASEDECODER(decoder));
+    videodecoder_close_decoder(decoder);
 
     G_OBJECT_CLASS(parent_class)->dispose(object);
 }
 
+static void videodecoder_finalize(GObject* object)
+{
+#if ZERO_COPY_FRAMES
+    VideoDecoder *decoder = VIDEODECODER(object);
+
+    g_mutex_clear(&decoder->frame_pool_lock);
+#endif // ZERO_COPY_FRAMES
+
+    G_OBJECT_CLASS(parent_class)->finalize(object);
+}
+
 static gboolean videodecoder_is_decoder_by_codec_id_supported(gint codec_id)
 {
     switch(codec_id)
@@ -234,6 +279,9 @@ static void videodecoder_set_property(GObject *object, guint property_id, const
     case PROP_CODEC_ID:
         decoder->codec_id = g_value_get_int(value);
         break;
+    case PROP_THREAD_COUNT:
+        BASEDECODER(decoder)->thread_count = g_value_get_int(value);
+        break;
     default:
         break;
     }
@@ -249,6 +297,9 @@ static void videodecoder_get_property(GObject *object, guint property_id, GValue
         is_supported = videodecoder_is_decoder_by_codec_id_supported(decoder->codec_id);
         g_value_set_boolean(value, is_supported);
         break;
+    case PROP_THREAD_COUNT:
+        g_value_set_int(value, BASEDECODER(decoder)->thread_count);
+        break;
     default:
         break;
     }
@@ -284,6 +335,7 @@ videodecoder_change_state(GstElement* element, GstStateChange transition)
     {
         case GST_STATE_CHANGE_PAUSED_TO_READY:
             basedecoder_close_decoder(BASEDECODER(decoder));
+            videodecoder_close_decoder(decoder);
             break;
         default:
             break;
@@ -316,6 +368,11 @@ static gboolean videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent
             BASEDECODER(decoder)->is_flushing = FALSE;
             break;
 
+        case GST_EVENT_EOS:
+            // Push frames still held by the decoder before EOS.
+            videodecoder_drain(decoder);
+            break;
+
         case GST_EVENT_CAPS:
         {
             GstCaps *caps;
@@ -366,8 +423,19 @@ static void videodecoder_init_state(VideoDecoder *decoder)
     decoder->v_offset = 0;
     decoder->uv_blocksize = 0;
     decoder->frame_size = 0;
+    decoder->linesize[0] = decoder->linesize[1] = decoder->linesize[2] = 0;
+    decoder->zero_copy = FALSE;
     decoder->discont = FALSE;
     decoder->codec_id = JFX_CODEC_ID_UNKNOWN;
+    decoder->duration = GST_CLOCK_TIME_NONE;
+    decoder->frames_decoded = 0;
+    decoder->decode_time = 0;
+    decoder->queue_depth = 0;
+    decoder->max_queue_depth = 0;
+#if ZERO_COPY_FRAMES
+    decoder->frame_pool = NULL;
+    decoder->frame_pool_size = 0;
+#endif // ZERO_COPY_FRAMES
 #if HEVC_SUPPORT
     decoder->sws_context = NULL;
     decoder->dest_frame = NULL;
@@ -441,6 +509,7 @@ static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps
 static void videodecoder_state_reset(VideoDecoder *decoder)
 {
     decoder->frame_finished = 1;
+    decoder->queue_depth = 0;
     basedecoder_flush(BASEDECODER(decoder));
 }
 
@@ -520,10 +589,13 @@ static gboolean videodecoder_init_converter(VideoDecoder *decoder)
     if (decoder->dest_frame == NULL)
         return FALSE;
 
+    // Only the layout of dest_frame is used, the converter writes straight
+    // into the output buffer.
     decoder->dest_frame->format = AV_PIX_FMT_YUV420P;
     decoder->dest_frame->width  = decoder->width;
     decoder->dest_frame->height = decoder->height;
-    int ret = av_frame_get_buffer(decoder->dest_frame, 32);
+    int ret = av_image_fill_linesizes(decoder->dest_frame->linesize, AV_PIX_FMT_YUV420P,
+                                      FFALIGN(decoder->width, 32));
     if (ret < 0)
     {
         av_frame_free(&decoder->dest_frame);
@@ -536,41 +608,64 @@ static gboolean videodecoder_init_converter(VideoDecoder *decoder)
     return TRUE;
 }
 
-static gboolean videodecoder_convert_frame(VideoDecoder *decoder)
+// Converts base->frame to YUV420P into dst, laid out as announced in the caps.
+static gboolean videodecoder_convert_frame(VideoDecoder *decoder, guint8 *dst)
 {
     BaseDecoder *base = BASEDECODER(decoder);
+    uint8_t *dst_data[4] = { dst, dst + decoder->u_offset, dst + decoder->v_offset, NULL };
 
     if (decoder->sws_context == NULL || decoder->dest_frame == NULL ||
             decoder->sws_scale_func == NULL)
         return FALSE;
 
     int ret = decoder->sws_scale_func(decoder->sws_context,
-                                      base->frame->data,
+                                      (const uint8_t * const*)base->frame->data,
                                       base->frame->linesize,
                                       0,
                                       base->frame->height,
-                                      decoder->dest_frame->data,
+                                      dst_data,
                                       decoder->dest_frame->linesize);
     if (ret < 0)
         return FALSE;
 
-#if NO_REORDERED_OPAQUE
-    decoder->dest_frame->pts = base->frame->pts;
-#else // NO_REORDERED_OPAQUE
-    decoder->dest_frame->reordered_opaque = base->frame->reordered_opaque;
-#endif // NO_REORDERED_OPAQUE
-
     return TRUE;
 }
 #endif // HEVC_SUPPORT
 
+// Returns TRUE if all planes of base->frame live in one buffer, laid out Y, U, V
+// with equal chroma strides, so the buffer can be pushed downstream as is.
+static gboolean videodecoder_can_export_frame(VideoDecoder *decoder)
+{
+#if ZERO_COPY_FRAMES
+    AVFrame     *frame = BASEDECODER(decoder)->frame;
+    AVBufferRef *buf = frame->buf[0];
+    int          chroma_height = (decoder->height + 1) / 2;
+
+    if (frame->format != AV_PIX_FMT_YUV420P || buf == NULL || frame->buf[1] != NULL)
+        return FALSE;
+
+    if (frame->linesize[0] <= 0 || frame->linesize[1] <= 0 || frame->linesize[1] != frame->linesize[2])
+        return FALSE;
+
+    return frame->data[0] >= buf->data &&
+           frame->data[1] >= frame->data[0] + (ptrdiff_t)frame->linesize[0] * decoder->height &&
+           frame->data[2] >= frame->data[1] + (ptrdiff_t)frame->linesize[1] * chroma_height &&
+           frame->data[2] + (ptrdiff_t)frame->linesize[2] * chroma_height <= buf->data + buf->size;
+#else // ZERO_COPY_FRAMES
+    return FALSE;
+#endif // ZERO_COPY_FRAMES
+}
+
 static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
 {
     BaseDecoder *base = BASEDECODER(decoder);
-    gboolean set_linesize = TRUE;
-    int linesize0 = 0;
-    int linesize1 = 0;
-    int linesize2 = 0;
+    int linesize0 = base->frame->linesize[0];
+    int linesize1 = base->frame->linesize[1];
+    int linesize2 = base->frame->linesize[2];
+    unsigned int u_offset = 0;
+    unsigned int v_offset = 0;
+    unsigned int uv_blocksize = 0;
+    gboolean size_changed = FALSE;
 
     GstCaps *caps = gst_pad_get_current_caps(base->srcpad);
 
@@ -587,6 +682,8 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
     {
         decoder->width = width;
         decoder->height = height;
+        size_changed = TRUE;
+    }
 
 #if HEVC_SUPPORT
     // Setup scaler and color converter if pixel format is not AV_PIX_FMT_YUV420P.
@@ -594,47 +691,53 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
     // AV_PIX_FMT_YUV422P10LE. Scaling should not happen if resolution is same.
     if (base->frame->format != AV_PIX_FMT_YUV420P)
     {
-        if (!videodecoder_init_converter(decoder))
+        if ((size_changed || decoder->dest_frame == NULL) && !videodecoder_init_converter(decoder))
         {
             gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
                                              GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
                                              g_strdup("videodecoder_init_convert() failed"), NULL,
                                              ("videodecoder.c"), ("videodecoder_configure_sourcepad"), 0);
-            return FALSE;
-        }
-
-        if (!videodecoder_convert_frame(decoder))
-        {
-            gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("videodecoder_convert_frame() failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_configure_sourcepad"), 0);
-
+            if (caps)
+                gst_caps_unref(caps);
             return FALSE;
         }
 
         linesize0 = decoder->dest_frame->linesize[0];
         linesize1 = decoder->dest_frame->linesize[1];
         linesize2 = decoder->dest_frame->linesize[2];
-
-        set_linesize = FALSE;
     }
 #endif // HEVC_SUPPORT
 
-        decoder->discont = (caps != NULL);
+    uv_blocksize = linesize1 * decoder->height / 2;
+    decoder->zero_copy = videodecoder_can_export_frame(decoder);
+    if (decoder->zero_copy)
+    {
+        // Planes may be padded for the decoder, take the offsets from the frame.
+        u_offset = (unsigned int)(base->frame->data[1] - base->frame->data[0]);
+        v_offset = (unsigned int)(base->frame->data[2] - base->frame->data[0]);
+    }
+    else
+    {
+        u_offset = linesize0 * decoder->height;
+        v_offset = u_offset + uv_blocksize;
+    }
+
+    if (size_changed ||
+        decoder->linesize[0] != linesize0 || decoder->linesize[1] != linesize1 || decoder->linesize[2] != linesize2 ||
+        decoder->u_offset != u_offset || decoder->v_offset != v_offset)
+    {
+        if (caps != NULL)
+            decoder->discont = TRUE;
 
-        if (set_linesize)
-        {
-            linesize0 = base->frame->linesize[0];
-            linesize1 = base->frame->linesize[1];
-            linesize2 = base->frame->linesize[2];
-        }
+        decoder->linesize[0] = linesize0;
+        decoder->linesize[1] = linesize1;
+        decoder->linesize[2] = linesize2;
 
-        decoder->u_offset = linesize0 * decoder->height;
-        decoder->uv_blocksize = linesize1 * decoder->height / 2;
+        decoder->u_offset = u_offset;
+        decoder->uv_blocksize = uv_blocksize;
 
-        decoder->v_offset = decoder->u_offset + decoder->uv_blocksize;
-        decoder->frame_size = (linesize0 + linesize1) * decoder->height;
+        decoder->v_offset = v_offset;
+        decoder->frame_size = v_offset + uv_blocksize;
 
         GstCaps *src_caps = gst_caps_new_simple("video/x-raw-yuv",
                                                 "format", G_TYPE_STRING, "YV12",
@@ -670,284 +773,483 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
 
     return TRUE;
 }
+/***********************************************************************************
+ * Statistics
+ ***********************************************************************************/
+static void videodecoder_post_stats(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+
+    if (decoder->frames_decoded == 0 || base->context == NULL)
+        return;
+
+    GstStructure *s = gst_structure_new(VIDEO_DECODER_STATS_MESSAGE,
+        "threads", G_TYPE_INT, base->context->thread_count,
+        "frames", G_TYPE_UINT64, decoder->frames_decoded,
+        "decode-time", G_TYPE_UINT64, (guint64)(decoder->decode_time * GST_USECOND),
+        "queue-depth", G_TYPE_UINT, decoder->queue_depth,
+        "max-queue-depth", G_TYPE_UINT, decoder->max_queue_depth,
+        NULL);
+    if (s == NULL)
+        return;
+
+    GST_DEBUG_OBJECT(decoder, "%" G_GUINT64_FORMAT " frames on %d threads, %.3f ms per frame, queue depth %u (max %u)",
+                     decoder->frames_decoded, base->context->thread_count,
+                     (double)decoder->decode_time / decoder->frames_decoded / 1000.0,
+                     decoder->queue_depth, decoder->max_queue_depth);
+
+    gst_element_post_message(GST_ELEMENT(decoder), gst_message_new_element(GST_OBJECT(decoder), s));
+}
+
 /***********************************************************************************
  * chain
  ***********************************************************************************/
-static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+#if ZERO_COPY_FRAMES
+static void videodecoder_release_frame_buffer(gpointer data)
+{
+    AVBufferRef *ref = (AVBufferRef*)data;
+    av_buffer_unref(&ref);
+}
+
+// Allocates all planes of a YUV420P frame from one pooled buffer, so that
+// videodecoder_wrap_frame() can hand the frame downstream without copying.
+// Other formats use the libavcodec allocator.
+static int videodecoder_get_buffer2(AVCodecContext *context, AVFrame *frame, int flags)
+{
+    VideoDecoder *decoder = VIDEODECODER(context->opaque);
+    int           linesize_align[AV_NUM_DATA_POINTERS];
+    int           linesize[4];
+    int           width = frame->width;
+    int           height = frame->height;
+    int           i;
+
+    if (frame->format != AV_PIX_FMT_YUV420P || !(context->codec->capabilities & AV_CODEC_CAP_DR1))
+        return avcodec_default_get_buffer2(context, frame, flags);
+
+    avcodec_align_dimensions2(context, &width, &height, linesize_align);
+    if (av_image_fill_linesizes(linesize, AV_PIX_FMT_YUV420P, FFALIGN(width, 128)) < 0)
+        return avcodec_default_get_buffer2(context, frame, flags);
+
+    for (i = 0; i < 3; i++)
+    {
+        if (linesize_align[i] > 0 && linesize[i] % linesize_align[i] != 0)
+            return avcodec_default_get_buffer2(context, frame, flags);
+    }
+
+    gint64 y_size = (gint64)linesize[0] * height;
+    gint64 uv_size = (gint64)linesize[1] * ((height + 1) / 2);
+    if (height <= 0 || y_size + 2 * uv_size > G_MAXINT - AV_INPUT_BUFFER_PADDING_SIZE)
+        return AVERROR(EINVAL);
+    int size = (int)(y_size + 2 * uv_size) + AV_INPUT_BUFFER_PADDING_SIZE;
+
+    g_mutex_lock(&decoder->frame_pool_lock);
+    if (decoder->frame_pool == NULL || decoder->frame_pool_size != size)
+    {
+        if (decoder->frame_pool)
+            av_buffer_pool_uninit(&decoder->frame_pool);
+        decoder->frame_pool = av_buffer_pool_init(size, NULL);
+        decoder->frame_pool_size = (decoder->frame_pool != NULL) ? size : 0;
+    }
+    frame->buf[0] = (decoder->frame_pool != NULL) ? av_buffer_pool_get(decoder->frame_pool) : NULL;
+    g_mutex_unlock(&decoder->frame_pool_lock);
+
+    if (frame->buf[0] == NULL)
+        return AVERROR(ENOMEM);
+
+    frame->data[0] = frame->buf[0]->data;
+    frame->data[1] = frame->data[0] + y_size;
+    frame->data[2] = frame->data[1] + uv_size;
+    for (i = 0; i < 3; i++)
+        frame->linesize[i] = linesize[i];
+    frame->extended_data = frame->data;
+
+    return 0;
+}
+
+static void videodecoder_init_context(BaseDecoder *base)
+{
+    BASEDECODER_CLASS(parent_class)->init_context(base);
+
+    base->context->opaque = base;
+    base->context->get_buffer2 = videodecoder_get_buffer2;
+#if LIBAVCODEC_VERSION_MAJOR < 60
+    // The pool is lock-protected, so let frame threads allocate directly
+    // instead of having libavcodec serialize the calls on the decoding thread.
+    base->context->thread_safe_callbacks = 1;
+#endif
+}
+
+// Wraps the buffer holding base->frame into a GstBuffer. The buffer stays
+// referenced until downstream releases the GstBuffer.
+static GstBuffer* videodecoder_wrap_frame(VideoDecoder *decoder)
+{
+    AVFrame     *frame = BASEDECODER(decoder)->frame;
+    AVBufferRef *ref = av_buffer_ref(frame->buf[0]);
+
+    if (ref == NULL)
+        return NULL;
+
+    return gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, ref->data, ref->size,
+                                       frame->data[0] - ref->data, decoder->frame_size,
+                                       ref, videodecoder_release_frame_buffer);
+}
+#endif // ZERO_COPY_FRAMES
+
+// Copies (or converts) base->frame into a newly allocated buffer.
+static GstBuffer* videodecoder_copy_frame(VideoDecoder *decoder)
 {
-    VideoDecoder  *decoder = VIDEODECODER(parent);
     BaseDecoder   *base = BASEDECODER(decoder);
-    GstFlowReturn  result = GST_FLOW_OK;
-    int            num_dec = NO_DATA_USED;
-    GstMapInfo     info;
     GstMapInfo     info2;
-    gboolean       unmap_buf = FALSE;
-    gboolean       set_frame_values = TRUE;
-    int64_t        pts = AV_NOPTS_VALUE;
     unsigned int   out_buf_size = 0;
     gboolean       copy_error = FALSE;
-    uint8_t*       data0 = NULL;
-    uint8_t*       data1 = NULL;
-    uint8_t*       data2 = NULL;
 
-    if (base->is_flushing)  // Reject buffers in flushing state.
+    GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
+    if (outbuf == NULL)
     {
-        result = GST_FLOW_FLUSHING;
-        goto _exit;
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                 GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                 g_strdup("Decoded video buffer allocation failed"), NULL,
+                                 ("videodecoder.c"), ("videodecoder_copy_frame"), 0);
+        return NULL;
     }
 
-    if (!base->is_initialized)
+    if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
     {
-        result = GST_FLOW_ERROR;
-        goto _exit;
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_copy_frame"), 0);
+        return NULL;
     }
 
-    if (!gst_buffer_map(buf, &info, GST_MAP_READ))
+    // Copy image by parts from different arrays.
+    if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
     {
-        result = GST_FLOW_ERROR;
-        goto _exit;
+        gst_buffer_unmap(outbuf, &info2);
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_copy_frame"), 0);
+        return NULL;
     }
 
-    unmap_buf = TRUE;
+#if HEVC_SUPPORT
+    // Check to see if we need to convert frame to YUV420p
+    if (base->frame->format != AV_PIX_FMT_YUV420P)
+    {
+        gboolean converted = videodecoder_convert_frame(decoder, info2.data);
+        gst_buffer_unmap(outbuf, &info2);
 
-    if (!base->is_hls)
+        if (!converted)
+        {
+            // INLINE - gst_buffer_unref()
+            gst_buffer_unref(outbuf);
+            gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                     GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                     g_strdup("Video frame conversion failed"), NULL,
+                                     ("videodecoder.c"), ("videodecoder_copy_frame"), 0);
+            return NULL;
+        }
+
+        return outbuf;
+    }
+#endif // HEVC_SUPPORT
+
+    out_buf_size = decoder->frame_size;
+    if (out_buf_size >= decoder->u_offset)
     {
-        if (av_new_packet(&decoder->packet, info.size) == 0)
+        memcpy(info2.data, base->frame->data[0], decoder->u_offset);
+        out_buf_size -= decoder->u_offset;
+        if (out_buf_size >= decoder->uv_blocksize &&
+            decoder->uv_blocksize <= decoder->frame_size &&
+            decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
         {
-            memcpy(decoder->packet.data, info.data, info.size);
-#if NO_REORDERED_OPAQUE
-            if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
-                decoder->packet.pts = (int64_t)GST_BUFFER_TIMESTAMP(buf);
-            else
-                decoder->packet.pts = AV_NOPTS_VALUE;
-#else // NO_REORDERED_OPAQUE
-            if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
-                base->context->reordered_opaque = GST_BUFFER_TIMESTAMP(buf);
+            memcpy(info2.data + decoder->u_offset, base->frame->data[1], decoder->uv_blocksize);
+            out_buf_size -= decoder->uv_blocksize;
+            if (out_buf_size >= decoder->uv_blocksize &&
+                decoder->uv_blocksize <= decoder->frame_size &&
+                decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
+            {
+                memcpy(info2.data + decoder->v_offset, base->frame->data[2], decoder->uv_blocksize);
+            }
             else
-                base->context->reordered_opaque = AV_NOPTS_VALUE;
-#endif // NO_REORDERED_OPAQUE
-#if USE_SEND_RECEIVE
-            num_dec = avcodec_send_packet(base->context, &decoder->packet);
-            if (num_dec == 0)
             {
-                num_dec = avcodec_receive_frame(base->context, base->frame);
-                if (num_dec == 0)
-                    decoder->frame_finished = 1;
-                else
-                    decoder->frame_finished = 0;
+                copy_error = TRUE;
             }
-#else
-            num_dec = avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet);
-#endif
-
-#if PACKET_UNREF
-            av_packet_unref(&decoder->packet);
-#else
-            av_free_packet(&decoder->packet);
-#endif
         }
         else
         {
-            result = GST_FLOW_ERROR;
-            goto _exit;
+            copy_error = TRUE;
         }
     }
     else
     {
-        av_init_packet(&decoder->packet);
-        decoder->packet.data = info.data;
-        decoder->packet.size = info.size;
-#if NO_REORDERED_OPAQUE
-        if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
-            decoder->packet.pts = (int64_t)GST_BUFFER_TIMESTAMP(buf);
-        else
-            decoder->packet.pts = AV_NOPTS_VALUE;
-#else // NO_REORDERED_OPAQUE
-        if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
-            base->context->reordered_opaque = GST_BUFFER_TIMESTAMP(buf);
-        else
-            base->context->reordered_opaque = AV_NOPTS_VALUE;
-#endif // NO_REORDERED_OPAQUE
-
-#if USE_SEND_RECEIVE
-        num_dec = avcodec_send_packet(base->context, &decoder->packet);
-        if (num_dec == 0)
-        {
-            num_dec = avcodec_receive_frame(base->context, base->frame);
-            if (num_dec == 0)
-                decoder->frame_finished = 1;
-            else
-                decoder->frame_finished = 0;
-        }
-#else
-        num_dec = avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet);
-#endif
+        copy_error = TRUE;
     }
 
-    if (num_dec < 0)
+    gst_buffer_unmap(outbuf, &info2);
+
+    if (copy_error)
     {
-        //        basedecoder_flush(base);
-#ifdef DEBUG_OUTPUT
-        g_print ("videodecoder_chain error: %s\n", avelement_error_to_string(AVELEMENT(decoder), num_dec));
-#endif
-        goto _exit;
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_copy_frame"), 0);
+        return NULL;
     }
 
-    if (decoder->frame_finished > 0)
+    return outbuf;
+}
+
+// Pushes the frame held by base->frame downstream.
+static GstFlowReturn videodecoder_push_frame(VideoDecoder *decoder)
+{
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+    GstBuffer     *outbuf = NULL;
+    int64_t        pts = AV_NOPTS_VALUE;
+
+    if (!videodecoder_configure_sourcepad(decoder))
+        return GST_FLOW_ERROR;
+
+#if ZERO_COPY_FRAMES
+    if (decoder->zero_copy)
+        outbuf = videodecoder_wrap_frame(decoder);
+#endif // ZERO_COPY_FRAMES
+
+    if (outbuf == NULL)
     {
-        if (!videodecoder_configure_sourcepad(decoder))
-            result = GST_FLOW_ERROR;
-        else
+        outbuf = videodecoder_copy_frame(decoder);
+        if (outbuf == NULL)
         {
 #if HEVC_SUPPORT
-            // Check to see if we need to convert frame to YUV420p
             if (base->frame->format != AV_PIX_FMT_YUV420P)
-            {
-                if (!videodecoder_convert_frame(decoder))
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Video frame conversion failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-
-                    result = GST_FLOW_ERROR;
-                    goto _exit;
-                }
-
-#if NO_REORDERED_OPAQUE
-                pts = decoder->dest_frame->pts;
-#else // NO_REORDERED_OPAQUE
-                pts = decoder->dest_frame->reordered_opaque;
-#endif // NO_REORDERED_OPAQUE
-                data0 = decoder->dest_frame->data[0];
-                data1 = decoder->dest_frame->data[1];
-                data2 = decoder->dest_frame->data[2];
-                set_frame_values = FALSE;
-            }
-#endif // HEVC_SUPPORTf
+                return GST_FLOW_ERROR;
+#endif // HEVC_SUPPORT
+            return result;
+        }
+    }
 
-            if (set_frame_values)
-            {
 #if NO_REORDERED_OPAQUE
-                pts = base->frame->pts;
+    pts = base->frame->pts;
 #else // NO_REORDERED_OPAQUE
-                pts = base->frame->reordered_opaque;
+    pts = base->frame->reordered_opaque;
 #endif // NO_REORDERED_OPAQUE
-                data0 = base->frame->data[0];
-                data1 = base->frame->data[1];
-                data2 = base->frame->data[2];
-            }
 
-            GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
-            if (outbuf == NULL)
-            {
-                if (result != GST_FLOW_FLUSHING)
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Decoded video buffer allocation failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-                }
-            }
-            else
-            {
 #if USE_FRAME_NUM
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_num;
+    GST_BUFFER_OFFSET(outbuf) = base->context->frame_num;
 #else // USE_FRAME_NUM
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
+    GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
 #endif // USE_FRAME_NUM
-                if (pts != AV_NOPTS_VALUE)
-                {
-                    GST_BUFFER_TIMESTAMP(outbuf) = pts;
-                    GST_BUFFER_DURATION(outbuf) = GST_BUFFER_DURATION(buf); // Duration for video usually same
-                }
-
-                if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                // Copy image by parts from different arrays.
-                if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
-                {
-                    gst_buffer_unmap(outbuf, &info2);
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                out_buf_size = decoder->frame_size;
-                if (out_buf_size >= decoder->u_offset)
-                {
-                    memcpy(info2.data, data0, decoder->u_offset);
-                    out_buf_size -= decoder->u_offset;
-                    if (out_buf_size >= decoder->uv_blocksize &&
-                        decoder->uv_blocksize <= decoder->frame_size &&
-                        decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                    {
-                        memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
-                        out_buf_size -= decoder->uv_blocksize;
-                        if (out_buf_size >= decoder->uv_blocksize &&
-                            decoder->uv_blocksize <= decoder->frame_size &&
-                            decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                        {
-                            memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
-                        }
-                        else
-                        {
-                            copy_error = TRUE;
-                        }
-                    }
-                    else
-                    {
-                        copy_error = TRUE;
-                    }
-                }
-                else
-                {
-                    copy_error = TRUE;
-                }
-
-                gst_buffer_unmap(outbuf, &info2);
-
-                if (copy_error)
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
-
-                if (decoder->discont || GST_BUFFER_IS_DISCONT(buf))
-                {
+    if (pts != AV_NOPTS_VALUE)
+    {
+        GST_BUFFER_TIMESTAMP(outbuf) = pts;
+        GST_BUFFER_DURATION(outbuf) = decoder->duration; // Duration for video usually same
+    }
+
+    GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
+
+    if (decoder->discont)
+    {
 #ifdef DEBUG_OUTPUT
-                    g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
+        g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
 #endif
-                    GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
-                    decoder->discont = FALSE;
-                }
-
+        GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
+        decoder->discont = FALSE;
+    }
 
 #ifdef VERBOSE_DEBUG
-                g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
-                    GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
-                    GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
+    g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
+        GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
+        GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
 #endif
-                result = gst_pad_push(base->srcpad, outbuf);
+    result = gst_pad_push(base->srcpad, outbuf);
 #ifdef VERBOSE_DEBUG
-                g_print(" done, res=%s\n", gst_flow_get_name(result));
+    g_print(" done, res=%s\n", gst_flow_get_name(result));
 #endif
-            }
+
+    return result;
+}
+
+// Feeds one packet to libavcodec and pushes every frame it returns. With
+// frame threading the decoder holds up to thread_count packets before the
+// first frame comes out, so a packet may produce no frame or several.
+// A NULL packet (or an empty one with the old API) drains the decoder.
+static GstFlowReturn videodecoder_decode_packet(VideoDecoder *decoder, AVPacket *packet)
+{
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+    gint64         start = g_get_monotonic_time();
+    int            ret = 0;
+
+#if USE_SEND_RECEIVE
+    ret = avcodec_send_packet(base->context, packet);
+    decoder->decode_time += g_get_monotonic_time() - start;
+    if (packet != NULL && ret == 0)
+    {
+        decoder->queue_depth++;
+        if (decoder->queue_depth > decoder->max_queue_depth)
+            decoder->max_queue_depth = decoder->queue_depth;
+    }
+
+    // Even if the packet was rejected, frames queued earlier are still valid.
+    while (result == GST_FLOW_OK)
+    {
+        start = g_get_monotonic_time();
+        ret = avcodec_receive_frame(base->context, base->frame);
+        decoder->decode_time += g_get_monotonic_time() - start;
+        if (ret < 0) // AVERROR(EAGAIN) needs more input, AVERROR_EOF is drained
+            break;
+
+        decoder->frame_finished = 1;
+        decoder->frames_decoded++;
+        if (decoder->queue_depth > 0)
+            decoder->queue_depth--;
+
+        result = videodecoder_push_frame(decoder);
+
+        if (decoder->frames_decoded % VIDEODECODER_STATS_INTERVAL == 0)
+            videodecoder_post_stats(decoder);
+    }
+#else // USE_SEND_RECEIVE
+    gboolean draining = (packet->size == 0);
+    do
+    {
+        start = g_get_monotonic_time();
+        ret = avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, packet);
+        decoder->decode_time += g_get_monotonic_time() - start;
+        if (ret < 0)
+            break;
+
+        if (!draining)
+        {
+            decoder->queue_depth++;
+            if (decoder->queue_depth > decoder->max_queue_depth)
+                decoder->max_queue_depth = decoder->queue_depth;
+        }
+
+        if (decoder->frame_finished > 0)
+        {
+            decoder->frames_decoded++;
+            if (decoder->queue_depth > 0)
+                decoder->queue_depth--;
+
+            result = videodecoder_push_frame(decoder);
+
+            if (decoder->frames_decoded % VIDEODECODER_STATS_INTERVAL == 0)
+                videodecoder_post_stats(decoder);
         }
+    } while (draining && decoder->frame_finished > 0 && result == GST_FLOW_OK);
+#endif // USE_SEND_RECEIVE
+
+#ifdef DEBUG_OUTPUT
+    if (ret < 0 && ret != AVERROR(EAGAIN) && ret != AVERROR_EOF)
+        g_print ("videodecoder_decode_packet error: %s\n", avelement_error_to_string(AVELEMENT(decoder), ret));
+#endif
+
+    return result;
+}
+
+// Pushes the frames still held by the decoder at the end of stream.
+static GstFlowReturn videodecoder_drain(VideoDecoder *decoder)
+{
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+
+    if (!base->is_initialized || base->is_flushing)
+        return GST_FLOW_OK;
+
+#if USE_SEND_RECEIVE
+    result = videodecoder_decode_packet(decoder, NULL);
+#else // USE_SEND_RECEIVE
+    av_init_packet(&decoder->packet);
+    decoder->packet.data = NULL;
+    decoder->packet.size = 0;
+    result = videodecoder_decode_packet(decoder, &decoder->packet);
+#endif // USE_SEND_RECEIVE
+
+    videodecoder_post_stats(decoder);
+
+    // A drained decoder refuses new packets until it is flushed.
+    videodecoder_state_reset(decoder);
+
+    return result;
+}
+
+static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+{
+    VideoDecoder  *decoder = VIDEODECODER(parent);
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+    GstMapInfo     info;
+    gboolean       unmap_buf = FALSE;
+
+    if (base->is_flushing)  // Reject buffers in flushing state.
+    {
+        result = GST_FLOW_FLUSHING;
+        goto _exit;
+    }
+
+    if (!base->is_initialized)
+    {
+        result = GST_FLOW_ERROR;
+        goto _exit;
+    }
+
+    if (!gst_buffer_map(buf, &info, GST_MAP_READ))
+    {
+        result = GST_FLOW_ERROR;
+        goto _exit;
+    }
+
+    unmap_buf = TRUE;
+
+    // The frame decoded from this buffer may come out of a later call, so
+    // the discontinuity is kept until the next pushed frame.
+    if (GST_BUFFER_IS_DISCONT(buf))
+        decoder->discont = TRUE;
+    decoder->duration = GST_BUFFER_DURATION(buf);
+
+    if (!base->is_hls)
+    {
+        if (av_new_packet(&decoder->packet, info.size) == 0)
+        {
+            memcpy(decoder->packet.data, info.data, info.size);
+        }
+        else
+        {
+            result = GST_FLOW_ERROR;
+            goto _exit;
+        }
+    }
+    else
+    {
+        av_init_packet(&decoder->packet);
+        decoder->packet.data = info.data;
+        decoder->packet.size = info.size;
+    }
+
+#if NO_REORDERED_OPAQUE
+    if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
+        decoder->packet.pts = (int64_t)GST_BUFFER_TIMESTAMP(buf);
+    else
+        decoder->packet.pts = AV_NOPTS_VALUE;
+#else // NO_REORDERED_OPAQUE
+    if (GST_BUFFER_TIMESTAMP_IS_VALID(buf))
+        base->context->reordered_opaque = GST_BUFFER_TIMESTAMP(buf);
+    else
+        base->context->reordered_opaque = AV_NOPTS_VALUE;
+#endif // NO_REORDERED_OPAQUE
+
+    result = videodecoder_decode_packet(decoder, &decoder->packet);
+
+    if (!base->is_hls)
+    {
+#if PACKET_UNREF
+        av_packet_unref(&decoder->packet);
+#else
+        av_free_packet(&decoder->packet);
+#endif
     }
 
 _exit:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -76,11 +76,28 @@ struct _VideoDecoder {
     unsigned int u_offset;
     unsigned int v_offset;
     unsigned int uv_blocksize;
+    int          linesize[3];    // strides announced in the caps
+    gboolean     zero_copy;      // the current frame is pushed without copying
 
     AVPacket     packet;
 
     gint         codec_id;
 
+    GstClockTime duration;       // duration of the last input buffer
+
+    // Statistics
+    guint64      frames_decoded;
+    guint64      decode_time;    // in microseconds, spent in libavcodec
+    guint        queue_depth;    // packets sent but not yet returned as frames
+    guint        max_queue_depth;
+
+#if ZERO_COPY_FRAMES
+    // Frames are allocated from this pool by videodecoder_get_buffer2()
+    AVBufferPool *frame_pool;
+    int           frame_pool_size;
+    GMutex        frame_pool_lock;
+#endif // ZERO_COPY_FRAMES
+
 #if HEVC_SUPPORT
     struct SwsContext *sws_context;
     AVFrame           *dest_frame;
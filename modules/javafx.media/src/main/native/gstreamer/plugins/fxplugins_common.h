@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,9 @@ enum
 #define GETRANGE_QUERY_SUPPORTS_FIELDNANE "supports"
 #define GETRANGE_QUERY_SUPPORTS_FIELDTYPE G_TYPE_BOOLEAN
 
+// Element message posted by the video decoder with decoding statistics
+#define VIDEO_DECODER_STATS_MESSAGE       "video-decoder-stats"
+
 // Do not use CODEC_ID_*, since it will conflict with libavcodec
 enum JFX_CODEC_ID
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@ GST_DEBUG_CATEGORY (java_source_debug);
 #define _BS(val) (val ? "TRUE" : "FALSE")
 
 #define MAX_READ_SIZE 65536
+#define MAX_READ_AHEAD 256
 
 /***********************************************************************************
 * HLS Properties and Values
@@ -54,6 +55,7 @@ enum
     SIGNAL_COPY_BLOCK,
     SIGNAL_CLOSE_CONNECTION,
     SIGNAL_PROPERTY,
+    SIGNAL_READ_NEXT_BLOCK_INTO,
     LAST_SIGNAL
 };
 
@@ -66,7 +68,9 @@ enum
     PROP_STOP_ON_PAUSE,
     PROP_LOCATION,
     PROP_MIMETYPE,
-    PROP_HLS_MODE
+    PROP_HLS_MODE,
+    PROP_ZERO_COPY,
+    PROP_READ_AHEAD
 };
 
 /***********************************************************************************
@@ -106,6 +110,16 @@ struct _JavaSource
     gchar*        location; // property controlled
     gchar*        mimetype; // property controlled
     gdouble       rate;
+
+    gboolean      zero_copy; // property controlled
+    guint         read_ahead; // property controlled
+
+    // Read-ahead ring, protected by lock
+    GThread       *read_ahead_thread;
+    gboolean      read_ahead_running;
+    GQueue        ring;
+    gint          ring_status; // EOS_CODE or OTHER_ERROR_CODE once the reader stopped
+    GCond         ring_cond;
 };
 
 struct _JavaSourceClass
@@ -170,6 +184,7 @@ static gboolean         java_source_event(GstPad *pad, GstObject *parent, GstEve
 static GstFlowReturn    java_source_getrange(GstPad *pad, GstObject *parent, guint64 offset,
     guint length, GstBuffer **data);
 static void             java_source_loop(void *data);
+static void             java_source_stop_read_ahead(JavaSource *element);
 
 static gboolean            java_source_query (GstPad *pad, GstObject *parent, GstQuery *query);
 
@@ -221,6 +236,14 @@ static void java_source_class_init (JavaSourceClass *klass)
         g_param_spec_string ("mimetype", "Source Mimetype", "Mimetype of the source", NULL,
         G_PARAM_WRITABLE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
 
+    g_object_class_install_property (gobject_klass, PROP_ZERO_COPY,
+        g_param_spec_boolean ("zero-copy", "Zero copy", "Read blocks directly into buffer memory with read-next-block-into", FALSE,
+        G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
+    g_object_class_install_property (gobject_klass, PROP_READ_AHEAD,
+        g_param_spec_uint ("read-ahead", "Read ahead", "Number of blocks read ahead on a separate thread, 0 to disable", 0, MAX_READ_AHEAD, 0,
+        G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
     klass->signals[SIGNAL_SEEK_DATA] = g_signal_new ("seek-data",
         G_TYPE_FROM_CLASS (klass),
         G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
@@ -284,6 +307,17 @@ static void java_source_class_init (JavaSourceClass *klass)
         G_TYPE_INT, /* return_type */
         2,    /* n_params */
         G_TYPE_INT, G_TYPE_INT);
+
+    klass->signals[SIGNAL_READ_NEXT_BLOCK_INTO] = g_signal_new ("read-next-block-into",
+        G_TYPE_FROM_CLASS (klass),
+        G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
+        0,
+        NULL, /* accumulator */
+        NULL, /* accu_data */
+        source_marshal_INT__POINTER_INT,
+        G_TYPE_INT, /* return_type */
+        2,     /* n_params */
+        G_TYPE_POINTER, G_TYPE_INT);
 }
 
 static void java_source_init(JavaSource *element)
@@ -300,6 +334,8 @@ static void java_source_init(JavaSource *element)
     gst_element_add_pad (GST_ELEMENT (element), element->srcpad);
 
     g_mutex_init(&element->lock);
+    g_cond_init(&element->ring_cond);
+    g_queue_init(&element->ring);
 
     element->mode = MODE_DEFAULT;
 
@@ -341,6 +377,12 @@ static void java_source_set_property (GObject *object, guint prop_id,
     case PROP_MIMETYPE:
         element->mimetype = g_strdup(g_value_get_string (value));
         break;
+    case PROP_ZERO_COPY:
+        element->zero_copy = g_value_get_boolean (value);
+        break;
+    case PROP_READ_AHEAD:
+        element->read_ahead = g_value_get_uint (value);
+        break;
     default:
         break;
     }
@@ -362,6 +404,8 @@ static void java_source_get_property (GObject *object, guint prop_id,
 static void java_source_finalize (GObject *object)
 {
     JavaSource *element = JAVA_SOURCE(object);
+    java_source_stop_read_ahead(element);
+    g_cond_clear(&element->ring_cond);
     g_mutex_clear(&element->lock);
     g_free(element->location);
     if (element->mimetype)
@@ -394,9 +438,12 @@ static gboolean java_source_activatemode(GstPad *pad, GstObject *parent, GstPadM
             } else {
                 g_mutex_lock(&element->lock);
                 element->srcresult = GST_FLOW_FLUSHING;
+                g_cond_broadcast(&element->ring_cond);
                 g_mutex_unlock(&element->lock);
 
-                return gst_pad_stop_task(pad);
+                res = gst_pad_stop_task(pad);
+                java_source_stop_read_ahead(element);
+                return res;
             }
 
             break;
@@ -448,11 +495,16 @@ static gboolean java_source_perform_seek(JavaSource *element, GstPad *pad, GstEv
 
     g_mutex_lock(&element->lock);
     element->srcresult = GST_FLOW_FLUSHING;
+    g_cond_broadcast(&element->ring_cond);
     g_mutex_unlock(&element->lock);
 
     if ((element->mode & MODE_HLS_LIVE) != MODE_HLS_LIVE)
         GST_PAD_STREAM_LOCK(pad);
 
+    // Blocks read ahead belong to the old position and the reader must not
+    // use the connection while it seeks.
+    java_source_stop_read_ahead(element);
+
     if ((element->mode & MODE_HLS) == MODE_HLS)
         position = start/GST_SECOND;
     else
@@ -526,6 +578,180 @@ static gboolean java_source_event(GstPad *pad, GstObject *parent, GstEvent *even
     return gst_pad_event_default(pad, parent, event);
 }
 
+/***********************************************************************************
+* Block reading. In zero-copy mode Java reads straight into the memory of the
+* buffer, otherwise the block read into the Java buffer is copied.
+***********************************************************************************/
+static gint java_source_read_next_block(JavaSource *element, GstBuffer **buffer)
+{
+    GstBuffer  *buf = NULL;
+    GstMapInfo info;
+    gint       size = 0;
+
+    *buffer = NULL;
+
+    // HLS connections prepend segment headers in readNextBlock(), so they are always copied
+    if (element->zero_copy && (element->mode & MODE_DEFAULT) == MODE_DEFAULT)
+    {
+        buf = gst_buffer_new_allocate(NULL, MAX_READ_SIZE, NULL);
+        if (buf == NULL)
+            return OTHER_ERROR_CODE;
+
+        if (!gst_buffer_map(buf, &info, GST_MAP_WRITE))
+        {
+            gst_buffer_unref(buf);
+            return OTHER_ERROR_CODE;
+        }
+
+        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK_INTO], 0, info.data, (gint)info.size, &size);
+
+        gst_buffer_unmap(buf, &info);
+
+        if (size > MAX_READ_SIZE)
+            size = OTHER_ERROR_CODE;
+
+        if (size > 0)
+        {
+            gst_buffer_set_size(buf, size);
+            *buffer = buf;
+        }
+        else
+            gst_buffer_unref(buf);
+    }
+    else
+    {
+        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK], 0, &size);
+        if (size > 0)
+        {
+            buf = gst_buffer_new_allocate(NULL, size, NULL);
+            if (buf == NULL)
+                return OTHER_ERROR_CODE;
+
+            if (!gst_buffer_map(buf, &info, GST_MAP_WRITE))
+            {
+                gst_buffer_unref(buf);
+                return OTHER_ERROR_CODE;
+            }
+
+            g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data, size);
+
+            gst_buffer_unmap(buf, &info);
+            *buffer = buf;
+        }
+    }
+
+    return size;
+}
+
+/***********************************************************************************
+* Read-ahead. A reader thread keeps up to read_ahead blocks in the ring, so the
+* streaming thread does not wait on Java for every block. Only used in the push
+* mode of non-HLS streams.
+***********************************************************************************/
+static gpointer java_source_read_ahead_func(gpointer data)
+{
+    JavaSource *element = JAVA_SOURCE(data);
+    GstBuffer  *buffer = NULL;
+    gint       size = 0;
+
+    g_mutex_lock(&element->lock);
+    while (element->read_ahead_running)
+    {
+        if (element->ring_status != 0 || g_queue_get_length(&element->ring) >= element->read_ahead)
+        {
+            g_cond_wait(&element->ring_cond, &element->lock);
+            continue;
+        }
+        g_mutex_unlock(&element->lock);
+
+        size = java_source_read_next_block(element, &buffer);
+
+        g_mutex_lock(&element->lock);
+        if (buffer != NULL)
+            g_queue_push_tail(&element->ring, buffer);
+        else if (size == EOS_CODE || size == OTHER_ERROR_CODE)
+            element->ring_status = size;
+        g_cond_broadcast(&element->ring_cond);
+    }
+    g_mutex_unlock(&element->lock);
+
+    return NULL;
+}
+
+// Must be called with lock held.
+static gboolean java_source_start_read_ahead(JavaSource *element)
+{
+    element->ring_status = 0;
+    element->read_ahead_running = TRUE;
+    element->read_ahead_thread = g_thread_try_new("JavaSourceReadAhead", java_source_read_ahead_func, element, NULL);
+    if (element->read_ahead_thread == NULL)
+    {
+        GST_WARNING_OBJECT(element, "Failed to start read-ahead thread, reading on streaming thread");
+        element->read_ahead_running = FALSE;
+        element->read_ahead = 0;
+        return FALSE;
+    }
+
+    GST_DEBUG_OBJECT(element, "Reading up to %u blocks ahead", element->read_ahead);
+    return TRUE;
+}
+
+// Must be called without lock held and with the streaming thread stopped,
+// since it waits for the block being read and drops all blocks read ahead.
+static void java_source_stop_read_ahead(JavaSource *element)
+{
+    GThread   *thread = NULL;
+    GstBuffer *buffer = NULL;
+
+    g_mutex_lock(&element->lock);
+    thread = element->read_ahead_thread;
+    element->read_ahead_thread = NULL;
+    element->read_ahead_running = FALSE;
+    g_cond_broadcast(&element->ring_cond);
+    g_mutex_unlock(&element->lock);
+
+    if (thread)
+        g_thread_join(thread);
+
+    g_mutex_lock(&element->lock);
+    while ((buffer = (GstBuffer*)g_queue_pop_head(&element->ring)) != NULL)
+        gst_buffer_unref(buffer);
+    element->ring_status = 0;
+    g_mutex_unlock(&element->lock);
+}
+
+static gint java_source_pop_block(JavaSource *element, GstBuffer **buffer)
+{
+    gint size = 0;
+
+    g_mutex_lock(&element->lock);
+    if (element->read_ahead_thread == NULL && element->srcresult == GST_FLOW_OK &&
+        !java_source_start_read_ahead(element))
+    {
+        g_mutex_unlock(&element->lock);
+        return java_source_read_next_block(element, buffer);
+    }
+
+    while (g_queue_is_empty(&element->ring) && element->ring_status == 0 &&
+           element->read_ahead_running && element->srcresult == GST_FLOW_OK)
+        g_cond_wait(&element->ring_cond, &element->lock);
+
+    *buffer = (GstBuffer*)g_queue_pop_head(&element->ring);
+    if (*buffer != NULL)
+    {
+        size = (gint)gst_buffer_get_size(*buffer);
+        g_cond_broadcast(&element->ring_cond);
+    }
+    else
+    {
+        // EOS or error is reported once all blocks read before it are pushed
+        size = element->ring_status;
+    }
+    g_mutex_unlock(&element->lock);
+
+    return size;
+}
+
 /***********************************************************************************
 * source pad loop
 ***********************************************************************************/
@@ -626,25 +852,19 @@ next_event:
         case GST_EVENT_UNKNOWN: // Pushing buffers
             {
                 gint     size;
-                GstMapInfo info;
-                g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK], 0, &size);
+                GstBuffer *buffer = NULL;
+
+                if (element->read_ahead > 0 && (element->mode & MODE_DEFAULT) == MODE_DEFAULT)
+                    size = java_source_pop_block(element, &buffer);
+                else
+                    size = java_source_read_next_block(element, &buffer);
+
                 if (size > 0)
                 {
-                    GstBuffer *buffer = gst_buffer_new_allocate(NULL, size, NULL);
                     if (buffer)
                     {
                         GST_BUFFER_OFFSET(buffer) = element->position;
 
-                        if (!gst_buffer_map(buffer, &info, GST_MAP_WRITE))
-                        {
-                            result = GST_FLOW_ERROR;
-                            break;
-                        }
-
-                        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data, size);
-
-                        gst_buffer_unmap(buffer, &info);
-
                         if (element->discont)
                         {
                             buffer = gst_buffer_make_writable (buffer);
@@ -920,10 +1140,14 @@ static GstStateChangeReturn java_source_change_state (GstElement *e,
         g_mutex_lock(&element->lock);
         if (element->stop_on_pause)
             element->srcresult = GST_FLOW_FLUSHING;
+        g_cond_broadcast(&element->ring_cond);
         g_mutex_unlock(&element->lock);
         break;
 
     case GST_STATE_CHANGE_READY_TO_NULL:
+        // Reader must be done with the connection before it is closed
+        java_source_stop_read_ahead(element);
+
         g_mutex_lock(&element->lock);
         if (!element->stop_on_pause)
             element->srcresult = GST_FLOW_FLUSHING;
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <cache.h>
+#include "filecache.h"
+#include <string.h>
+
+#define DEFAULT_BUFFER_SIZE 4096
+#define ZERO_COPY_BUFFER_SIZE (64 * 1024)
+#define MEMORY_CHUNK_SIZE (256 * 1024)
+
+/* A fixed size block of a memory cache. Buffers returned by cache reads hold
+ * a reference, a chunk they use is copied before it is written again.
+ */
+typedef struct _CacheChunk
+{
+    gint    refcount;
+    guint8* data;
+} CacheChunk;
+
+struct _Cache
+{
+    CacheMode   mode;           // CACHE_MODE_FILE, CACHE_MODE_MAPPED or CACHE_MODE_MEMORY
+    guint64     memory_limit;
+
+    FileCache*  file;
+    GPtrArray*  chunks;         // CacheChunk*, memory mode only
+
+    gint64      read_position;
+    gint64      write_position;
+    gint64      size;           // end of the written data
+};
+
+static CacheChunk* cache_chunk_new(gboolean clear)
+{
+    CacheChunk* chunk = (CacheChunk*)g_try_malloc(sizeof(CacheChunk) + MEMORY_CHUNK_SIZE);
+    if (chunk)
+    {
+        chunk->refcount = 1;
+        chunk->data = (guint8*)(chunk + 1);
+        if (clear)
+            memset(chunk->data, 0, MEMORY_CHUNK_SIZE);
+    }
+    return chunk;
+}
+
+static void cache_chunk_unref(gpointer data)
+{
+    CacheChunk* chunk = (CacheChunk*)data;
+    if (chunk != NULL && g_atomic_int_dec_and_test(&chunk->refcount))
+        g_free(chunk);
+}
+
+static void memory_cache_free(Cache* cache)
+{
+    guint i;
+    for (i = 0; i < cache->chunks->len; i++)
+        cache_chunk_unref(g_ptr_array_index(cache->chunks, i));
+    g_ptr_array_free(cache->chunks, TRUE);
+    cache->chunks = NULL;
+}
+
+// Returns the chunk with the given index ready for writing, NULL if out of memory.
+static CacheChunk* memory_cache_writable_chunk(Cache* cache, guint index)
+{
+    CacheChunk* chunk;
+
+    while (cache->chunks->len <= index)
+    {
+        // Chunks skipped by a write position beyond the end read as zeros.
+        chunk = cache_chunk_new(cache->chunks->len < index);
+        if (chunk == NULL)
+            return NULL;
+        g_ptr_array_add(cache->chunks, chunk);
+    }
+
+    chunk = (CacheChunk*)g_ptr_array_index(cache->chunks, index);
+    if (g_atomic_int_get(&chunk->refcount) > 1)
+    {
+        // Buffers still use this chunk, leave it to them.
+        CacheChunk* copy = cache_chunk_new(FALSE);
+        if (copy == NULL)
+            return NULL;
+        memcpy(copy->data, chunk->data, MEMORY_CHUNK_SIZE);
+        cache_chunk_unref(chunk);
+        g_ptr_array_index(cache->chunks, index) = copy;
+        chunk = copy;
+    }
+    return chunk;
+}
+
+static gsize memory_cache_write(Cache* cache, gint64 position, const guint8* data, gsize size)
+{
+    gsize written = 0;
+
+    while (written < size)
+    {
+        guint64 offset = (guint64)position + written;
+        guint index = (guint)(offset / MEMORY_CHUNK_SIZE);
+        gsize chunk_offset = (gsize)(offset % MEMORY_CHUNK_SIZE);
+        gsize count = MIN(size - written, MEMORY_CHUNK_SIZE - chunk_offset);
+        CacheChunk* chunk = memory_cache_writable_chunk(cache, index);
+
+        if (chunk == NULL)
+            break;
+        if (offset > (guint64)cache->size)
+        {
+            // Like skipped chunks, the gap between the end and a write past it reads as zeros.
+            guint64 chunk_start = offset - chunk_offset;
+            gsize gap_start = (guint64)cache->size > chunk_start ? (gsize)((guint64)cache->size - chunk_start) : 0;
+            memset(chunk->data + gap_start, 0, chunk_offset - gap_start);
+        }
+        memcpy(chunk->data + chunk_offset, data + written, count);
+        written += count;
+    }
+    return written;
+}
+
+// Wraps the chunks holding the range, which must have been written before.
+static GstBuffer* memory_cache_read(Cache* cache, gint64 position, gsize size)
+{
+    GstBuffer* buffer = gst_buffer_new();
+    gsize done = 0;
+
+    while (done < size)
+    {
+        guint64 offset = (guint64)position + done;
+        CacheChunk* chunk = (CacheChunk*)g_ptr_array_index(cache->chunks, (guint)(offset / MEMORY_CHUNK_SIZE));
+        gsize chunk_offset = (gsize)(offset % MEMORY_CHUNK_SIZE);
+        gsize count = MIN(size - done, MEMORY_CHUNK_SIZE - chunk_offset);
+
+        g_atomic_int_inc(&chunk->refcount);
+        gst_buffer_append_memory(buffer,
+                                 gst_memory_new_wrapped(GST_MEMORY_FLAG_READONLY, chunk->data, MEMORY_CHUNK_SIZE,
+                                                        chunk_offset, count, chunk, cache_chunk_unref));
+        done += count;
+    }
+    return buffer;
+}
+
+/* Moves the content of a memory cache that outgrew its limit to a file.
+ * Buffers already read keep their chunks.
+ */
+static gboolean memory_cache_spill(Cache* cache)
+{
+    FileCache* file = file_cache_create(TRUE, 2 * cache->size);
+    guint i;
+
+    if (file == NULL)
+        return FALSE;
+
+    for (i = 0; i < cache->chunks->len; i++)
+    {
+        gint64 offset = (gint64)i * MEMORY_CHUNK_SIZE;
+        gsize count = (gsize)MIN(cache->size - offset, MEMORY_CHUNK_SIZE);
+        CacheChunk* chunk = (CacheChunk*)g_ptr_array_index(cache->chunks, i);
+
+        if (offset >= cache->size)
+            break;
+        if (file_cache_write(file, offset, chunk->data, count) != count)
+        {
+            file_cache_destroy(file);
+            return FALSE;
+        }
+    }
+
+    memory_cache_free(cache);
+    cache->file = file;
+    cache->mode = file_cache_is_mapped(file) ? CACHE_MODE_MAPPED : CACHE_MODE_FILE;
+    return TRUE;
+}
+
+void cache_static_init(void)
+{
+    file_cache_static_init();
+}
+
+Cache* create_cache()
+{
+    return create_cache_full(CACHE_MODE_FILE, 0, 0);
+}
+
+Cache* create_cache_full(CacheMode mode, gint64 expected_size, guint64 memory_limit)
+{
+    Cache* result = (Cache*)g_try_malloc0(sizeof(Cache));
+    if (result)
+    {
+        if (mode == CACHE_MODE_AUTO)
+        {
+            if (expected_size > 0 && (guint64)expected_size <= memory_limit)
+                mode = CACHE_MODE_MEMORY;
+            else
+                mode = CACHE_MODE_MAPPED;
+        }
+
+        result->memory_limit = memory_limit;
+        if (mode == CACHE_MODE_MEMORY)
+        {
+            result->chunks = g_ptr_array_new();
+        }
+        else
+        {
+            result->file = file_cache_create(mode == CACHE_MODE_MAPPED, expected_size);
+            if (result->file == NULL)
+            {
+                g_free(result);
+                return NULL;
+            }
+            if (mode == CACHE_MODE_MAPPED && !file_cache_is_mapped(result->file))
+                mode = CACHE_MODE_FILE;
+        }
+        result->mode = mode;
+        result->read_position = result->write_position = result->size = 0;
+    }
+    return result;
+}
+
+void destroy_cache(Cache* instance)
+{
+    if (instance->chunks)
+        memory_cache_free(instance);
+    if (instance->file)
+        file_cache_destroy(instance->file);
+
+    g_free(instance);
+}
+
+void cache_write_buffer(Cache* cache, GstBuffer* buffer)
+{
+    GstMapInfo info;
+    if (gst_buffer_map(buffer, &info, GST_MAP_READ))
+    {
+        gsize written = 0;
+
+        if (cache->mode == CACHE_MODE_MEMORY &&
+            (guint64)cache->write_position + info.size > cache->memory_limit)
+            memory_cache_spill(cache);
+
+        if (cache->mode == CACHE_MODE_MEMORY)
+            written = memory_cache_write(cache, cache->write_position, info.data, info.size);
+        else
+            written = file_cache_write(cache->file, cache->write_position, info.data, info.size);
+
+        cache->write_position += written;
+        if (cache->size < cache->write_position)
+            cache->size = cache->write_position;
+        gst_buffer_unmap(buffer, &info);
+    }
+}
+
+// Reads size bytes at position, which must lie within the written data.
+static GstBuffer* cache_read(Cache* cache, gint64 position, gsize size)
+{
+    if (cache->mode == CACHE_MODE_MEMORY)
+        return memory_cache_read(cache, position, size);
+    else
+        return file_cache_read(cache->file, position, size);
+}
+
+gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+{
+    gint64 available = cache->write_position - cache->read_position;
+    gint64 size = (cache->mode == CACHE_MODE_FILE) ? DEFAULT_BUFFER_SIZE : ZERO_COPY_BUFFER_SIZE;
+    *buffer = NULL;
+
+    if (available > 0 && available < size)
+        size = available;
+    if (size > cache->size - cache->read_position)
+        size = cache->size - cache->read_position;
+
+    if (size > 0)
+    {
+        *buffer = cache_read(cache, cache->read_position, (gsize)size);
+        if (*buffer != NULL)
+        {
+            GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+
+            cache->read_position += size;
+            return cache->read_position;
+        }
+    }
+
+    return 0;
+}
+
+GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+{
+    GstFlowReturn result = GST_FLOW_ERROR;
+    *buffer = NULL;
+
+    if (cache_set_read_position(cache, start_position) && start_position + size <= cache->size)
+    {
+        *buffer = cache_read(cache, start_position, size);
+        if (*buffer != NULL)
+        {
+            GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+            cache->read_position += size;
+            result = GST_FLOW_OK;
+        }
+    }
+    return result;
+}
+
+gboolean cache_set_write_position(Cache* cache, gint64 position)
+{
+    if (position < 0)
+        return FALSE;
+
+    if (position < cache->size)
+    {
+        if (cache->mode == CACHE_MODE_MEMORY)
+        {
+            // Drop whole chunks after the position, partial ones are copied on write if in use.
+            guint keep = (guint)((position + MEMORY_CHUNK_SIZE - 1) / MEMORY_CHUNK_SIZE);
+            while (cache->chunks->len > keep)
+            {
+                cache_chunk_unref(g_ptr_array_index(cache->chunks, cache->chunks->len - 1));
+                g_ptr_array_remove_index(cache->chunks, cache->chunks->len - 1);
+            }
+        }
+        else if (!file_cache_discard(cache->file, position))
+            return FALSE;
+        cache->size = position;
+    }
+    cache->write_position = position;
+    return TRUE;
+}
+
+gboolean cache_set_read_position(Cache* cache, gint64 position)
+{
+    if (position < 0)
+        return FALSE;
+
+    cache->read_position = position;
+    return TRUE;
+}
+
+gboolean cache_has_enough_data(Cache* cache)
+{
+    return cache->read_position < cache->write_position;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,9 +30,26 @@
 
 typedef struct _Cache Cache;
 
+typedef enum
+{
+    CACHE_MODE_AUTO = 0,    // Memory for media up to the memory limit, mapped file otherwise.
+    CACHE_MODE_FILE,        // Temporary file read and written with system calls.
+    CACHE_MODE_MAPPED,      // Temporary file mapped into memory, reads do not copy. Falls back to
+                            // CACHE_MODE_FILE where mapping is not available.
+    CACHE_MODE_MEMORY       // Memory chunks, reads do not copy. Moves to a mapped file when the
+                            // written data exceeds the memory limit.
+} CacheMode;
+
 void      cache_static_init(void); // Must be called only once from the ProgressBuffer class initializer
 
+// Creates a CACHE_MODE_FILE cache.
 Cache*    create_cache();
+
+/* Creates a cache of the given mode. expected_size is the size of the media
+ * if known, 0 otherwise. memory_limit caps the memory used by CACHE_MODE_AUTO
+ * and CACHE_MODE_MEMORY.
+ */
+Cache*    create_cache_full(CacheMode mode, gint64 expected_size, guint64 memory_limit);
 void      destroy_cache(Cache* instance);
 
 // Writes a buffer.
@@ -51,7 +68,7 @@ gint64         cache_read_buffer(Cache* cache, GstBuffer** buffer);
  */
 GstFlowReturn  cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer);
 
-// Sets a new write position
+// Sets a new write position. Moving it backwards discards the data after it.
 gboolean       cache_set_write_position(Cache* cache, gint64 position);
 
 // Sets a new read position
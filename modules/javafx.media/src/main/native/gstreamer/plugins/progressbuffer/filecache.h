@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef __FILE_CACHE_H__
+#define __FILE_CACHE_H__
+
+#include <gst/gst.h>
+
+/* Temporary file backing a Cache, implemented per platform. All positions are
+ * absolute; the read and write positions are kept by the Cache.
+ */
+typedef struct _FileCache FileCache;
+
+void           file_cache_static_init(void);
+
+/* Creates an empty file. If mapped is TRUE the file is mapped into memory when
+ * possible, expected_size is then used as the initial size of the mapping.
+ */
+FileCache*     file_cache_create(gboolean mapped, gint64 expected_size);
+void           file_cache_destroy(FileCache* cache);
+
+// Returns TRUE if the file is mapped into memory.
+gboolean       file_cache_is_mapped(FileCache* cache);
+
+// Writes size bytes at position. Returns the number of bytes written.
+gsize          file_cache_write(FileCache* cache, gint64 position, const guint8* data, gsize size);
+
+/* Reads size bytes at position, which must have been written before. Buffers
+ * of a mapped file wrap the mapping instead of copying. Returns NULL on error.
+ */
+GstBuffer*     file_cache_read(FileCache* cache, gint64 position, gsize size);
+
+/* Called when data after position is discarded before being written again.
+ * A mapped file still referenced by buffers is replaced by a new one holding
+ * the first position bytes, so that those buffers keep their content.
+ */
+gboolean       file_cache_discard(FileCache* cache, gint64 position);
+
+#endif // __FILE_CACHE_H__
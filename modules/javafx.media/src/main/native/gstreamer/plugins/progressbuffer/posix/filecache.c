@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,174 +23,269 @@
  * questions.
  */
 
-#include <cache.h>
+#include "../filecache.h"
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+#define MIN_MAPPING_SIZE (16 * 1024 * 1024)
 
-#define DEFAULT_BUFFER_SIZE 4096
 static const char *tempDir = NULL;
 
-struct _Cache
+/* A mapping of the whole file. Buffers returned by file_cache_read() hold a
+ * reference, so a mapping outlives a grown or replaced file until they are
+ * released.
+ */
+typedef struct _CacheMapping
 {
-    char*   filename;
-    int     readHandle;
-    int     writeHandle;
+    gint    refcount;
+    guint8* data;
+    gsize   size;
+} CacheMapping;
 
-    gint64  read_position;
-    gint64  write_position;
+struct _FileCache
+{
+    int           handle;
+    gboolean      mapped;
+    CacheMapping* mapping;
 };
 
-void cache_static_init(void)
+static void cache_mapping_unref(gpointer data)
 {
-    tempDir = g_get_tmp_dir();
+    CacheMapping* mapping = (CacheMapping*)data;
+    if (g_atomic_int_dec_and_test(&mapping->refcount))
+    {
+        munmap(mapping->data, mapping->size);
+        g_free(mapping);
+    }
 }
 
-Cache* create_cache()
+// Grows the file to size bytes with all of its blocks allocated.
+static gboolean reserve_blocks(int handle, gsize size)
 {
-    Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
-    if (result)
+#if defined(__APPLE__)
+    struct stat st;
+    if (fstat(handle, &st) < 0)
+        return FALSE;
+    if ((off_t)size > st.st_size)
     {
-        result->filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
-        if (result->filename == NULL)
-            goto _error_exit;
-        else
-        {
-        result->writeHandle = g_mkstemp_full(result->filename, O_RDWR, S_IRUSR|S_IWUSR);
-            result->readHandle = open(result->filename, O_RDONLY, 0);
-
-            if(result->writeHandle < 0 || result->readHandle < 0)
-                goto _error_exit;
-
-        if (unlink(result->filename) < 0)
-        {
-            close (result->writeHandle);
-            close (result->readHandle);
-        goto _error_exit;
-        }
-
-            result->read_position = result->write_position = 0;
-        }
+        fstore_t store = { F_ALLOCATEALL, F_PEOFPOSMODE, 0, (off_t)size - st.st_size, 0 };
+        if (fcntl(handle, F_PREALLOCATE, &store) < 0)
+            return FALSE;
     }
-    return result;
-
-_error_exit:
-    g_free(result);
-    return NULL;
+    return ftruncate(handle, (off_t)size) == 0;
+#else
+    int result;
+    do
+    {
+        result = posix_fallocate(handle, 0, (off_t)size);
+    } while (result == EINTR);
+    return result == 0;
+#endif
 }
 
-void destroy_cache(Cache* instance)
+static CacheMapping* cache_mapping_new(int handle, gsize size)
 {
-    close(instance->writeHandle);
-    close(instance->readHandle);
-    g_free(instance->filename);
+    CacheMapping* mapping = NULL;
+    void* data;
+
+    // Writes to a mapping raise SIGBUS when the disk is full, so the blocks
+    // are allocated up front and a full disk fails here instead.
+    if (!reserve_blocks(handle, size))
+        return NULL;
+
+    data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0);
+    if (data == MAP_FAILED)
+        return NULL;
 
-    g_free(instance);
+    mapping = (CacheMapping*)g_try_malloc(sizeof(CacheMapping));
+    if (mapping == NULL)
+    {
+        munmap(data, size);
+        return NULL;
+    }
+    mapping->refcount = 1;
+    mapping->data = (guint8*)data;
+    mapping->size = size;
+    return mapping;
 }
 
-void cache_write_buffer(Cache* cache, GstBuffer* buffer)
+static int create_temp_file()
 {
-    GstMapInfo info;
-    if (gst_buffer_map(buffer, &info, GST_MAP_READ))
+    int handle = -1;
+    char* filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
+
+    if (filename != NULL)
     {
-        ssize_t written = write(cache->writeHandle, info.data, info.size);
-        if (written > 0)
-            cache->write_position += written;
-        gst_buffer_unmap(buffer, &info);
+        handle = g_mkstemp_full(filename, O_RDWR, S_IRUSR|S_IWUSR);
+        if (handle >= 0 && unlink(filename) < 0)
+        {
+            close(handle);
+            handle = -1;
+        }
+        g_free(filename);
     }
+    return handle;
 }
 
-gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+/* Makes the mapping cover at least size bytes. If that is not possible the
+ * file stays as it is and is accessed with system calls from now on.
+ */
+static gboolean file_cache_reserve(FileCache* cache, gsize size)
 {
-    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
-    *buffer = NULL;
+    CacheMapping* mapping;
+    gsize new_size;
+
+    if (cache->mapping != NULL && cache->mapping->size >= size)
+        return TRUE;
 
-    if (data)
+    new_size = cache->mapping != NULL ? cache->mapping->size : MIN_MAPPING_SIZE;
+    while (new_size < size && new_size <= G_MAXSIZE / 2)
+        new_size *= 2;
+    if (new_size < size)
+        new_size = size;
+
+    mapping = cache_mapping_new(cache->handle, new_size);
+    if (mapping == NULL)
     {
-        ssize_t size = 0;
-        if ((cache->write_position - cache->read_position) > 0 &&
-            (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
-            size = cache->write_position - cache->read_position;
-        else
-            size = DEFAULT_BUFFER_SIZE;
-
-        ssize_t read_bytes = read(cache->readHandle, data, size);
-        if (read_bytes > 0)
+        if (cache->mapping != NULL)
         {
-            *buffer = gst_buffer_new_wrapped_full(0, data, DEFAULT_BUFFER_SIZE, 0, read_bytes, data, g_free);
-            if (*buffer != NULL)
-                GST_BUFFER_OFFSET(*buffer) = cache->read_position;
-
-            cache->read_position += read_bytes;
-            return cache->read_position;
+            cache_mapping_unref(cache->mapping);
+            cache->mapping = NULL;
         }
-        else // read error, deleting buffer to avoid leaking.
-            g_free(data);
+        cache->mapped = FALSE;
+        return FALSE;
     }
 
-    return 0;
+    if (cache->mapping != NULL)
+        cache_mapping_unref(cache->mapping);
+    cache->mapping = mapping;
+    return TRUE;
 }
 
-GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+void file_cache_static_init(void)
 {
-    GstFlowReturn result = GST_FLOW_ERROR;
-    *buffer = NULL;
+    tempDir = g_get_tmp_dir();
+}
 
-    if (cache_set_read_position(cache, start_position))
-    {
-        guint8 *data = (guint8*)g_try_malloc(size);
-        if (data)
+FileCache* file_cache_create(gboolean mapped, gint64 expected_size)
+{
+    FileCache* result = (FileCache*)g_try_malloc(sizeof(FileCache));
+    if (result)
     {
-        ssize_t read_bytes = read(cache->readHandle, data, size);
-            if (read_bytes == size)
-            {
-                *buffer = gst_buffer_new_wrapped_full(0, data, size, 0, read_bytes, data, g_free);
-                if (*buffer != NULL)
-                {
-                    GST_BUFFER_OFFSET(*buffer) = cache->read_position;
-                    result = GST_FLOW_OK;
-                }
-            }
-            else
-            g_free(data); // Wrong size, deleting buffer to avoid leaking.
-
-            cache->read_position += read_bytes;
-    }
+        result->handle = create_temp_file();
+        if (result->handle < 0)
+        {
+            g_free(result);
+            return NULL;
+        }
+
+        result->mapped = mapped;
+        result->mapping = NULL;
+        if (mapped && expected_size > 0 && (guint64)expected_size <= G_MAXSIZE)
+            file_cache_reserve(result, (gsize)expected_size);
     }
     return result;
 }
 
-static inline gboolean cache_set_handler_position(int handle, guint64 position)
+void file_cache_destroy(FileCache* cache)
+{
+    if (cache->mapping != NULL)
+        cache_mapping_unref(cache->mapping);
+    close(cache->handle);
+    g_free(cache);
+}
+
+gboolean file_cache_is_mapped(FileCache* cache)
 {
-    return lseek(handle, position, SEEK_SET) >= 0;
+    return cache->mapped;
 }
 
-gboolean cache_set_write_position(Cache* cache, gint64 position)
+gsize file_cache_write(FileCache* cache, gint64 position, const guint8* data, gsize size)
 {
-    gboolean result = (position == cache->write_position);
-    if (!result)
+    gsize written = 0;
+
+    if (cache->mapped && (guint64)position <= G_MAXSIZE - size &&
+        file_cache_reserve(cache, (gsize)position + size))
     {
-        result = cache_set_handler_position(cache->writeHandle, position);
-        if (result)
-            cache->write_position = position;
+        memcpy(cache->mapping->data + position, data, size);
+        return size;
     }
-    return result;
+
+    while (written < size)
+    {
+        ssize_t result = pwrite(cache->handle, data + written, size - written, (off_t)(position + written));
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            break;
+        written += result;
+    }
+    return written;
 }
 
-gboolean cache_set_read_position(Cache* cache, gint64 position)
+GstBuffer* file_cache_read(FileCache* cache, gint64 position, gsize size)
 {
-    gboolean result = (position == cache->read_position);
-    if (!result)
+    GstBuffer* buffer = NULL;
+    guint8* data;
+    gsize read_bytes = 0;
+
+    if (cache->mapped && cache->mapping != NULL && (guint64)position + size <= cache->mapping->size)
     {
-        result = cache_set_handler_position(cache->readHandle, position);
-        if (result)
-            cache->read_position = position;
+        CacheMapping* mapping = cache->mapping;
+        g_atomic_int_inc(&mapping->refcount);
+        buffer = gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, mapping->data, mapping->size,
+                                             (gsize)position, size, mapping, cache_mapping_unref);
+        if (buffer == NULL)
+            cache_mapping_unref(mapping);
+        return buffer;
     }
-    return result;
+
+    data = (guint8*)g_try_malloc(size);
+    if (data == NULL)
+        return NULL;
+
+    while (read_bytes < size)
+    {
+        ssize_t result = pread(cache->handle, data + read_bytes, size - read_bytes, (off_t)(position + read_bytes));
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            break;
+        read_bytes += result;
+    }
+
+    if (read_bytes == size)
+        buffer = gst_buffer_new_wrapped_full(0, data, size, 0, size, data, g_free);
+    else
+        g_free(data); // Wrong size, deleting buffer to avoid leaking.
+    return buffer;
 }
 
-gboolean cache_has_enough_data(Cache* cache)
+gboolean file_cache_discard(FileCache* cache, gint64 position)
 {
-    return cache->read_position < cache->write_position;
+    CacheMapping* old_mapping = cache->mapping;
+    int old_handle = cache->handle;
+
+    if (!cache->mapped || old_mapping == NULL || g_atomic_int_get(&old_mapping->refcount) == 1)
+        return TRUE;
+
+    // Buffers still use the mapping, leave it to them together with the file.
+    cache->handle = create_temp_file();
+    if (cache->handle < 0)
+    {
+        cache->handle = old_handle;
+        return FALSE;
+    }
+    cache->mapping = NULL;
+    if (position > 0)
+        file_cache_write(cache, 0, old_mapping->data, (gsize)MIN((guint64)position, old_mapping->size));
+
+    cache_mapping_unref(old_mapping);
+    close(old_handle);
+    return TRUE;
 }
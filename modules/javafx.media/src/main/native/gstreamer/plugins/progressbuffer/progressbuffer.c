@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,9 +48,13 @@ enum
     PROP_THRESHOLD,
     PROP_BANDWIDTH,
     PROP_PREBUFFER_TIME,
-    PROP_WAIT_TOLERANCE
+    PROP_WAIT_TOLERANCE,
+    PROP_CACHE_MODE,
+    PROP_MEMORY_CACHE_LIMIT
 };
 
+#define DEFAULT_MEMORY_CACHE_LIMIT (16 * 1024 * 1024)
+
 /***********************************************************************************
  * Element structures are hidden from outside
  ***********************************************************************************/
@@ -85,6 +89,8 @@ struct _ProgressBuffer
     gdouble       bandwidth; // property accessible.
     gdouble       prebuffer_time; // property controlled.
     gdouble       wait_tolerance; // property controlled.
+    gint          cache_mode; // property controlled.
+    guint64       memory_cache_limit; // property controlled.
     GTimer        *bandwidth_timer;
 
     gboolean      unexpected;
@@ -238,6 +244,24 @@ static void progress_buffer_class_init (ProgressBufferClass *klass)
                                                           2.0  /* default value */,
                                                           G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
 
+    g_object_class_install_property (gobject_class, PROP_CACHE_MODE,
+                                     g_param_spec_int ("cache-mode",
+                                                       "Cache mode",
+                                                       "Cache storage: 0 - auto, 1 - file, 2 - mapped file, 3 - memory.",
+                                                       CACHE_MODE_AUTO  /* minimum value */,
+                                                       CACHE_MODE_MEMORY /* maximum value */,
+                                                       CACHE_MODE_AUTO  /* default value */,
+                                                       G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+
+    g_object_class_install_property (gobject_class, PROP_MEMORY_CACHE_LIMIT,
+                                     g_param_spec_uint64 ("memory-cache-limit",
+                                                          "Memory cache limit",
+                                                          "Maximum size in bytes of a memory cache before it moves to a file.",
+                                                          0  /* minimum value */,
+                                                          G_MAXUINT64 /* maximum value */,
+                                                          DEFAULT_MEMORY_CACHE_LIMIT  /* default value */,
+                                                          G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+
     cache_static_init();
 }
 
@@ -289,6 +313,12 @@ static void progress_buffer_set_property (GObject *object, guint property_id,
         case PROP_WAIT_TOLERANCE:
             element->wait_tolerance = g_value_get_double(value);
             break;
+        case PROP_CACHE_MODE:
+            element->cache_mode = g_value_get_int(value);
+            break;
+        case PROP_MEMORY_CACHE_LIMIT:
+            element->memory_cache_limit = g_value_get_uint64(value);
+            break;
 
         default:
             break;
@@ -322,6 +352,14 @@ static void progress_buffer_get_property (GObject *object, guint property_id,
             g_value_set_double(value, element->wait_tolerance);
             break;
 
+        case PROP_CACHE_MODE:
+            g_value_set_int(value, element->cache_mode);
+            break;
+
+        case PROP_MEMORY_CACHE_LIMIT:
+            g_value_set_uint64(value, element->memory_cache_limit);
+            break;
+
         default:
             break;
     }
@@ -640,7 +678,9 @@ static GstFlowReturn progress_buffer_enqueue_item(ProgressBuffer *element, GstMi
                     if (element->cache)
                         destroy_cache(element->cache);
 
-                    element->cache = create_cache();
+                    element->cache = create_cache_full((CacheMode)element->cache_mode,
+                                                       segment.stop - segment.start,
+                                                       element->memory_cache_limit);
                     if (!element->cache)
                     {
                         gst_element_message_full(GST_ELEMENT(element), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_OPEN_READ_WRITE,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,23 +23,20 @@
  * questions.
  */
 
-#include <cache.h>
+#include "../filecache.h"
 #include <windows.h>
 
-#define DEFAULT_BUFFER_SIZE 4096
 static char tempDir[MAX_PATH];
 
-struct _Cache
+/* The file is always accessed with ReadFile() and WriteFile(); mapped caches
+ * fall back to that.
+ */
+struct _FileCache
 {
-    char    filename[MAX_PATH];
-    HANDLE  readHandle;
-    HANDLE  writeHandle;
-
-    gint64  read_position;
-    gint64  write_position;
+    HANDLE  handle;
 };
 
-void cache_static_init(void)
+void file_cache_static_init(void)
 {
     DWORD   dwRetVal = GetTempPath(MAX_PATH, tempDir);
     if ((dwRetVal >= MAX_PATH) || (dwRetVal == 0))
@@ -49,25 +46,20 @@ void cache_static_init(void)
     }
 }
 
-Cache* create_cache()
+FileCache* file_cache_create(gboolean mapped, gint64 expected_size)
 {
-    Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
+    char filename[MAX_PATH];
+    FileCache* result = (FileCache*)g_try_malloc(sizeof(FileCache));
     if (result)
     {
-        UINT uRetVal = GetTempFileName(tempDir, "jfx", 0, result->filename);
+        UINT uRetVal = GetTempFileName(tempDir, "jfx", 0, filename);
         if (uRetVal == 0)
             goto _error_exit;
-        else
-        {
-            result->writeHandle = CreateFile(result->filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ|FILE_SHARE_DELETE, NULL,
-                                             CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY|FILE_FLAG_DELETE_ON_CLOSE, NULL);
-            result->readHandle = CreateFile(result->filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE |FILE_SHARE_DELETE, NULL,
-                                            OPEN_EXISTING, FILE_ATTRIBUTE_TEMPORARY|FILE_FLAG_DELETE_ON_CLOSE, NULL);
-            if(result->writeHandle == INVALID_HANDLE_VALUE || result->readHandle == INVALID_HANDLE_VALUE)
-                goto _error_exit;
-
-            result->read_position = result->write_position = 0;
-        }
+
+        result->handle = CreateFile(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ|FILE_SHARE_DELETE, NULL,
+                                    CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY|FILE_FLAG_DELETE_ON_CLOSE, NULL);
+        if (result->handle == INVALID_HANDLE_VALUE)
+            goto _error_exit;
     }
     return result;
 
@@ -76,118 +68,72 @@ _error_exit:
     return NULL;
 }
 
-void destroy_cache(Cache* instance)
+void file_cache_destroy(FileCache* cache)
 {
-    CloseHandle(instance->writeHandle);
-    CloseHandle(instance->readHandle);
+    CloseHandle(cache->handle);
 
-    g_free(instance);
+    g_free(cache);
 }
 
-void cache_write_buffer(Cache* cache, GstBuffer* buffer)
+gboolean file_cache_is_mapped(FileCache* cache)
 {
-    DWORD written = 0;
-    GstMapInfo info;
-    if (gst_buffer_map(buffer, &info, GST_MAP_READ))
-    {
-        if (WriteFile(cache->writeHandle, info.data, info.size, &written, NULL))
-            cache->write_position += written;
-        gst_buffer_unmap(buffer, &info);
-    }
+    return FALSE;
 }
 
-gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+static void set_overlapped_offset(OVERLAPPED* overlapped, guint64 position)
 {
-    DWORD read = 0;
-    DWORD size = 0;
-    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
-    *buffer = NULL;
-
-    if ((cache->write_position - cache->read_position) > 0 && (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
-        size = cache->write_position - cache->read_position;
-    else
-        size = DEFAULT_BUFFER_SIZE;
-
-    if (data && ReadFile(cache->readHandle, data, size, &read, NULL))
-    {
-        *buffer = gst_buffer_new_wrapped_full(0, data, DEFAULT_BUFFER_SIZE, 0, read, data, g_free);
-        if (*buffer != NULL)
-            GST_BUFFER_OFFSET(*buffer) = cache->read_position;
-
-        cache->read_position += read;
-        return cache->read_position;
-    }
-    else if (data) // ReadError, deleting buffer to avoid leaking.
-        g_free(data);
-
-    return 0;
+    ZeroMemory(overlapped, sizeof(OVERLAPPED));
+    overlapped->Offset = (DWORD)(position & 0xFFFFFFFF);
+    overlapped->OffsetHigh = (DWORD)(position >> 32);
 }
 
-GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+gsize file_cache_write(FileCache* cache, gint64 position, const guint8* data, gsize size)
 {
-    GstFlowReturn result = GST_FLOW_ERROR;
-    *buffer = NULL;
+    gsize written = 0;
 
-    if (cache_set_read_position(cache, start_position))
+    while (written < size)
     {
-        DWORD  read = 0;
-        guint8 *data = (guint8*)g_try_malloc(size);
-        if (data && ReadFile(cache->readHandle, data, size, &read, NULL))
-        {
-            if (read == size)
-            {
-                *buffer = gst_buffer_new_wrapped_full(0, data, size, 0, read, data, g_free);
-                if (*buffer != NULL)
-                {
-                    GST_BUFFER_OFFSET(*buffer) = cache->read_position;
-                    result = GST_FLOW_OK;
-                }
-            }
-            else
-                g_free(data); // Wrong size, deleting buffer to avoid leaking.
-
-            cache->read_position += read;
-        }
-        else if (data) // ReadError, deleting buffer to avoid leaking.
-            g_free(data);
+        OVERLAPPED overlapped;
+        DWORD chunk = (DWORD)MIN(size - written, G_MAXUINT32);
+        DWORD result = 0;
+
+        set_overlapped_offset(&overlapped, position + written);
+        if (!WriteFile(cache->handle, data + written, chunk, &result, &overlapped) || result == 0)
+            break;
+        written += result;
     }
-    return result;
+    return written;
 }
 
-static gboolean cache_set_handler_position(HANDLE handle, guint64 position)
+GstBuffer* file_cache_read(FileCache* cache, gint64 position, gsize size)
 {
-    LARGE_INTEGER li;
-    li.QuadPart = position;
-    li.LowPart = SetFilePointer (handle, li.LowPart, &li.HighPart, FILE_BEGIN);
+    GstBuffer* buffer = NULL;
+    gsize read_bytes = 0;
+    guint8 *data = (guint8*)g_try_malloc(size);
 
-    return (li.LowPart != INVALID_SET_FILE_POINTER || GetLastError() == NO_ERROR);
-}
+    if (data == NULL)
+        return NULL;
 
-gboolean cache_set_write_position(Cache* cache, gint64 position)
-{
-    gboolean result = (position == cache->write_position);
-    if (!result)
+    while (read_bytes < size)
     {
-        result = cache_set_handler_position(cache->writeHandle, position);
-        if (result)
-            cache->write_position = position;
+        OVERLAPPED overlapped;
+        DWORD chunk = (DWORD)MIN(size - read_bytes, G_MAXUINT32);
+        DWORD result = 0;
+
+        set_overlapped_offset(&overlapped, position + read_bytes);
+        if (!ReadFile(cache->handle, data + read_bytes, chunk, &result, &overlapped) || result == 0)
+            break;
+        read_bytes += result;
     }
-    return result;
-}
 
-gboolean cache_set_read_position(Cache* cache, gint64 position)
-{
-    gboolean result = (position == cache->read_position);
-    if (!result)
-    {
-        result = cache_set_handler_position(cache->readHandle, position);
-        if (result)
-            cache->read_position = position;
-    }
-    return result;
+    if (read_bytes == size)
+        buffer = gst_buffer_new_wrapped_full(0, data, size, 0, size, data, g_free);
+    else
+        g_free(data); // Wrong size, deleting buffer to avoid leaking.
+    return buffer;
 }
 
-gboolean cache_has_enough_data(Cache* cache)
+gboolean file_cache_discard(FileCache* cache, gint64 position)
 {
-    return cache->read_position < cache->write_position;
+    return TRUE;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,12 @@ public:
      */
     virtual int  ReadNextBlock() = 0;
 
+    /* ReadNextBlockInto reads next available block of data directly into the
+     * destination, which must be able to hold size bytes, and returns the number
+     * of bytes actually have been read, or -1/-2 just like ReadNextBlock().
+     */
+    virtual int  ReadNextBlockInto(void* destination, int size) = 0;
+
     /* ReadBlock reads arbitrary block of data and
      * returns the number of bytes actually have been read. The number may differ
      * from the size passed in.
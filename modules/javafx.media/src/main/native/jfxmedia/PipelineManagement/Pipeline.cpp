@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -193,3 +193,8 @@ CAudioSpectrum* CPipeline::GetAudioSpectrum()
 {
     return NULL;
 }
+
+CVideoFrame* CPipeline::TakeLatestVideoFrame()
+{
+    return NULL;
+}
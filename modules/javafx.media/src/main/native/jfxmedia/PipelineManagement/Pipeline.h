@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -92,6 +92,11 @@ public:
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
+    // Returns the newest undelivered video frame, which the caller then owns,
+    // or NULL. Pipelines that keep frames in a latest-frame mailbox announce
+    // them with CPlayerEventDispatcher::SendNewFrameEvent(NULL).
+    virtual CVideoFrame*        TakeLatestVideoFrame();
+
     CPlayerEventDispatcher* m_pEventDispatcher;
 
 protected:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,13 @@ public:
         kSingleSourcePipeline  = 0, // Indicates that pipeline is single source. It can be audio or video.
         kAudioSourcePipeline   = 1, // Indicates that pipeline is multi source and audio is secondary stream.
     };
+    enum
+    {
+        kBufferingBalanced       = 0, // Moderate queues in front of the decoders.
+        kBufferingLowLatency     = 1, // Small queues, for low bitrate streams.
+        kBufferingHighThroughput = 2, // Large queues, for high bitrate streams.
+        kBufferingAuto           = 3, // Starts balanced, grows from observed bitrate and decode time.
+    };
 public:
     CPipelineOptions(int pipelineType = kSingleSourcePipeline)
     :   m_PipelineType(pipelineType),
@@ -47,7 +54,12 @@ public:
         m_StreamMimeType(-1),
         m_AudioStreamMimeType(-1),
         m_bHLSModeEnabled(false),
-        m_audioFlags(0)
+        m_audioFlags(0),
+        m_VideoDecoderThreads(0),
+        m_SourceReadAhead(0),
+        m_SpectrumWindow(1),
+        m_SpectrumOverlap(0),
+        m_BufferingPolicy(kBufferingBalanced)
     {}
 
     virtual ~CPipelineOptions() {}
@@ -73,6 +85,26 @@ public:
     inline void  SetAudioFlags(int audioFlags) { m_audioFlags = audioFlags; }
     inline int  GetAudioFlags() { return m_audioFlags; }
 
+    // Number of threads used by the video decoder, 0 to match the number of cores.
+    inline void SetVideoDecoderThreads(int threads) { m_VideoDecoderThreads = threads; }
+    inline int  GetVideoDecoderThreads() { return m_VideoDecoderThreads; }
+
+    // Number of blocks the source reads ahead on its own thread, 0 to read on the streaming thread.
+    inline void SetSourceReadAhead(int blocks) { m_SourceReadAhead = blocks; }
+    inline int  GetSourceReadAhead() { return m_SourceReadAhead; }
+
+    // Window function applied by the audio spectrum, a GstFFTWindow value (1 is Hamming).
+    inline void SetSpectrumWindow(int window) { m_SpectrumWindow = window; }
+    inline int  GetSpectrumWindow() { return m_SpectrumWindow; }
+
+    // Overlap of consecutive audio spectrum frames, in percent of the frame size.
+    inline void SetSpectrumOverlap(int percent) { m_SpectrumOverlap = percent; }
+    inline int  GetSpectrumOverlap() { return m_SpectrumOverlap; }
+
+    // Sizing policy of the queues in front of the decoders, one of kBuffering*.
+    inline void SetBufferingPolicy(int policy) { m_BufferingPolicy = policy; }
+    inline int  GetBufferingPolicy() { return m_BufferingPolicy; }
+
     // Returns true if we need to force default track ID. For multi source streams
     // two demuxers (qtdemux in case of fMP4 HLS with EXT-X-MEDIA) will report same
     // ID, since two demuxers are not aware of each other and that we actually
@@ -109,6 +141,11 @@ private:
     int         m_AudioStreamMimeType;
     bool        m_bHLSModeEnabled;
     int         m_audioFlags;
+    int         m_VideoDecoderThreads;
+    int         m_SourceReadAhead;
+    int         m_SpectrumWindow;
+    int         m_SpectrumOverlap;
+    int         m_BufferingPolicy;
 
     // Audio parser or demultiplexer for main stream
     string      m_StreamParser;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -2684,3 +2684,360 @@ int ColorConvert_YCbCr422p_to_BGRA32_no_alpha(uint8_t *bgra,
     return 0;
 }
 // --- End YCbCr422p conversion functions
+
+// --- Begin row range conversion functions
+#if ENABLE_SIMD_SSE2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif // ENABLE_SIMD_SSE2
+
+/*
+ * Fixed point constants of the SSE2 YCbCr420p functions above. Samples are
+ * scaled to 16 bits (x << 8 for 8 bit input) and multiplied keeping the
+ * high word, so every path below produces the same output as those
+ * functions. 10 bit P010 samples are used as they are, which keeps their
+ * extra precision.
+ */
+#define CC_Y    0x2543      /* 1.1644  * 8192 */
+#define CC_BU   0x4097      /* 2.0184  * 8192 */
+#define CC_GU   0x0c8b      /* abs( -0.3920 * 8192 ) */
+#define CC_GV   0x1a06      /* abs( -0.8132 * 8192 ) */
+#define CC_RV   0x3317      /* 1.5966  * 8192 */
+#define CC_BOFF (-8864)     /* -276.9856 * 32 */
+#define CC_GOFF 4340        /* 135.6352  * 32 */
+#define CC_ROFF (-7136)     /* -222.9952 * 32 */
+
+static int simd_level = -1;
+
+#if ENABLE_SIMD_SSE2
+static int cpu_supports_avx2(void)
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return 0;
+    __cpuid(info, 1);
+    // The OS must save the AVX state (OSXSAVE and XCR0 bits 1 and 2).
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+        (_xgetbv(0) & 0x6) != 0x6)
+        return 0;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif // ENABLE_SIMD_SSE2
+
+static int best_simd_level(void)
+{
+    static int best = -1;
+
+    if (best < 0) {
+#if ENABLE_SIMD_SSE2
+        best = cpu_supports_avx2() ? COLOR_CONVERT_SIMD_AVX2 : COLOR_CONVERT_SIMD_SSE2;
+#else
+        best = COLOR_CONVERT_SIMD_NONE;
+#endif
+    }
+    return best;
+}
+
+int ColorConvert_GetSIMDLevel(void)
+{
+    if (simd_level < 0)
+        simd_level = best_simd_level();
+    return simd_level;
+}
+
+int ColorConvert_SetSIMDLevel(int level)
+{
+    int best = best_simd_level();
+
+    if (level < COLOR_CONVERT_SIMD_NONE)
+        level = COLOR_CONVERT_SIMD_NONE;
+    simd_level = (level < best) ? level : best;
+    return simd_level;
+}
+
+static inline uint8_t cc_clamp(int32_t v)
+{
+    v >>= 5;
+    return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+/* Converts two pixels sharing one chroma pair, all samples scaled to 16 bits. */
+static inline void cc_pair(uint8_t *d, uint32_t y0, uint32_t y1,
+                           uint32_t cb, uint32_t cr, int32_t bgra)
+{
+    int32_t b = (int32_t)((cb * CC_BU) >> 16) + CC_BOFF;
+    int32_t g = CC_GOFF - (int32_t)(((cb * CC_GU) >> 16) + ((cr * CC_GV) >> 16));
+    int32_t r = (int32_t)((cr * CC_RV) >> 16) + CC_ROFF;
+    int32_t yy0 = (int32_t)((y0 * CC_Y) >> 16);
+    int32_t yy1 = (int32_t)((y1 * CC_Y) >> 16);
+
+    if (bgra) {
+        d[0] = cc_clamp(yy0 + b);
+        d[1] = cc_clamp(yy0 + g);
+        d[2] = cc_clamp(yy0 + r);
+        d[3] = 0xff;
+        d[4] = cc_clamp(yy1 + b);
+        d[5] = cc_clamp(yy1 + g);
+        d[6] = cc_clamp(yy1 + r);
+        d[7] = 0xff;
+    } else {
+        d[0] = 0xff;
+        d[1] = cc_clamp(yy0 + r);
+        d[2] = cc_clamp(yy0 + g);
+        d[3] = cc_clamp(yy0 + b);
+        d[4] = 0xff;
+        d[5] = cc_clamp(yy1 + r);
+        d[6] = cc_clamp(yy1 + g);
+        d[7] = cc_clamp(yy1 + b);
+    }
+}
+
+/* Byte offsets of Y0, Cb and Cr within a packed 4:2:2 macropixel. */
+static void cc_packed_offsets(int32_t format, int32_t *yo, int32_t *uo, int32_t *vo)
+{
+    if (format == COLOR_CONVERT_YUY2) {
+        *yo = 0; *uo = 1; *vo = 3;
+    } else {
+        *yo = 1; *uo = 0; *vo = 2;
+    }
+}
+
+/*
+ * Converts pixels [from, width) of one row. from must be even. pY and pC
+ * point to the start of the luma and chroma rows (for the packed layouts
+ * both point to the row).
+ */
+static void cc_row_scalar(const ColorConvertSource *src, uint8_t *d,
+                          const uint8_t *pY, const uint8_t *pU, const uint8_t *pV,
+                          int32_t from, int32_t bgra)
+{
+    int32_t width = src->width;
+    int32_t i, yo, uo, vo;
+    const uint16_t *y16, *c16;
+
+    d += from * 4;
+    switch (src->format) {
+        case COLOR_CONVERT_YCbCr420p:
+            for (i = from; i < width; i += 2, d += 8)
+                cc_pair(d, pY[i] << 8, pY[i + 1] << 8, pU[i >> 1] << 8, pV[i >> 1] << 8, bgra);
+            break;
+        case COLOR_CONVERT_NV12:
+            for (i = from; i < width; i += 2, d += 8)
+                cc_pair(d, pY[i] << 8, pY[i + 1] << 8, pU[i] << 8, pU[i + 1] << 8, bgra);
+            break;
+        case COLOR_CONVERT_P010:
+            y16 = (const uint16_t*)pY;
+            c16 = (const uint16_t*)pU;
+            for (i = from; i < width; i += 2, d += 8)
+                cc_pair(d, y16[i], y16[i + 1], c16[i], c16[i + 1], bgra);
+            break;
+        default:
+            cc_packed_offsets(src->format, &yo, &uo, &vo);
+            for (i = from * 2; i < width * 2; i += 4, d += 8)
+                cc_pair(d, pY[i + yo] << 8, pY[i + yo + 2] << 8, pY[i + uo] << 8, pY[i + vo] << 8, bgra);
+            break;
+    }
+}
+
+#if ENABLE_SIMD_SSE2
+/*
+ * Converts 16 pixels from 16 bit scaled samples, cb and cr already
+ * replicated per pixel, and stores them to d (no alignment required).
+ */
+static TARGET_AVX2 inline void cc_store16_avx2(uint8_t *d, __m256i y, __m256i cb, __m256i cr, int32_t bgra)
+{
+    const __m256i alpha = _mm256_set1_epi16(0xff);
+    __m256i yy, b, g, r, p0, p1, t0, t1;
+
+    yy = _mm256_mulhi_epu16(y, _mm256_set1_epi16(CC_Y));
+    b = _mm256_add_epi16(_mm256_mulhi_epu16(cb, _mm256_set1_epi16(CC_BU)), _mm256_set1_epi16(CC_BOFF));
+    g = _mm256_sub_epi16(_mm256_set1_epi16(CC_GOFF),
+                         _mm256_add_epi16(_mm256_mulhi_epu16(cb, _mm256_set1_epi16(CC_GU)),
+                                          _mm256_mulhi_epu16(cr, _mm256_set1_epi16(CC_GV))));
+    r = _mm256_add_epi16(_mm256_mulhi_epu16(cr, _mm256_set1_epi16(CC_RV)), _mm256_set1_epi16(CC_ROFF));
+
+    b = _mm256_srai_epi16(_mm256_add_epi16(yy, b), 5);
+    g = _mm256_srai_epi16(_mm256_add_epi16(yy, g), 5);
+    r = _mm256_srai_epi16(_mm256_add_epi16(yy, r), 5);
+
+    /*
+     * Each 128 bit lane holds 8 pixels. Packing the components in memory
+     * order as (c0, c1) and (c2, c3) and interleaving twice yields pixels
+     * 0-3 and 4-7 of each lane.
+     */
+    if (bgra) {
+        p0 = _mm256_packus_epi16(b, g);
+        p1 = _mm256_packus_epi16(r, alpha);
+    } else {
+        p0 = _mm256_packus_epi16(alpha, r);
+        p1 = _mm256_packus_epi16(g, b);
+    }
+    t0 = _mm256_unpacklo_epi8(p0, p1);
+    t1 = _mm256_unpackhi_epi8(p0, p1);
+    p0 = _mm256_unpacklo_epi8(t0, t1);
+    p1 = _mm256_unpackhi_epi8(t0, t1);
+    _mm256_storeu_si256((__m256i*)d, _mm256_permute2x128_si256(p0, p1, 0x20));
+    _mm256_storeu_si256((__m256i*)(d + 32), _mm256_permute2x128_si256(p0, p1, 0x31));
+}
+
+/* Returns the number of pixels converted, a multiple of 16. */
+static TARGET_AVX2 int32_t cc_row_avx2(const ColorConvertSource *src, uint8_t *d,
+                                       const uint8_t *pY, const uint8_t *pU, const uint8_t *pV,
+                                       int32_t bgra)
+{
+    /* replicate the Cb (even) or Cr (odd) words of interleaved chroma */
+    const __m256i dupCb = _mm256_setr_epi8(0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8, 9, 12, 13, 12, 13,
+                                           0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8, 9, 12, 13, 12, 13);
+    const __m256i dupCr = _mm256_setr_epi8(2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10, 11, 14, 15, 14, 15,
+                                           2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10, 11, 14, 15, 14, 15);
+    int32_t width = src->width & ~15;
+    int32_t i, k, yo, uo, vo;
+    __m256i y, c, cb, cr;
+    __m128i c8;
+
+    switch (src->format) {
+        case COLOR_CONVERT_YCbCr420p:
+            for (i = 0; i < width; i += 16) {
+                y = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(pY + i))), 8);
+                c8 = _mm_loadl_epi64((const __m128i*)(pU + (i >> 1)));
+                cb = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi8(c8, c8)), 8);
+                c8 = _mm_loadl_epi64((const __m128i*)(pV + (i >> 1)));
+                cr = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi8(c8, c8)), 8);
+                cc_store16_avx2(d + i * 4, y, cb, cr, bgra);
+            }
+            break;
+        case COLOR_CONVERT_NV12:
+            for (i = 0; i < width; i += 16) {
+                y = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(pY + i))), 8);
+                c = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(pU + i))), 8);
+                cc_store16_avx2(d + i * 4, y, _mm256_shuffle_epi8(c, dupCb), _mm256_shuffle_epi8(c, dupCr), bgra);
+            }
+            break;
+        case COLOR_CONVERT_P010:
+            for (i = 0; i < width; i += 16) {
+                y = _mm256_loadu_si256((const __m256i*)(pY + i * 2));
+                c = _mm256_loadu_si256((const __m256i*)(pU + i * 2));
+                cc_store16_avx2(d + i * 4, y, _mm256_shuffle_epi8(c, dupCb), _mm256_shuffle_epi8(c, dupCr), bgra);
+            }
+            break;
+        default: {
+            /* byte shuffles moving each sample into the high byte of its pixel's word */
+            int8_t my[32], mu[32], mv[32];
+            __m256i shufY, shufU, shufV;
+
+            cc_packed_offsets(src->format, &yo, &uo, &vo);
+            for (k = 0; k < 32; k += 2) {
+                int32_t base = ((k & 15) >> 2) * 4;
+                my[k] = mu[k] = mv[k] = (int8_t)0x80;
+                my[k + 1] = (int8_t)(base + yo + (k & 2));
+                mu[k + 1] = (int8_t)(base + uo);
+                mv[k + 1] = (int8_t)(base + vo);
+            }
+            shufY = _mm256_loadu_si256((const __m256i*)my);
+            shufU = _mm256_loadu_si256((const __m256i*)mu);
+            shufV = _mm256_loadu_si256((const __m256i*)mv);
+            for (i = 0; i < width; i += 16) {
+                c = _mm256_loadu_si256((const __m256i*)(pY + i * 2));
+                cc_store16_avx2(d + i * 4, _mm256_shuffle_epi8(c, shufY),
+                                _mm256_shuffle_epi8(c, shufU), _mm256_shuffle_epi8(c, shufV), bgra);
+            }
+            break;
+        }
+    }
+
+    return width;
+}
+#endif // ENABLE_SIMD_SSE2
+
+int ColorConvert_Rows(const ColorConvertSource *src,
+                      uint8_t *dst,
+                      int32_t dst_stride,
+                      int32_t bgra,
+                      int32_t first_row,
+                      int32_t row_count)
+{
+    int32_t j, chroma_shift = 1;
+    const uint8_t *pY, *pU, *pV;
+
+    if (src == NULL || dst == NULL || src->planes[0] == NULL)
+        return 1;
+
+    if (src->width <= 0 || (src->width & 1) || src->height <= 0)
+        return 1;
+
+    if (first_row < 0 || row_count <= 0 || row_count > src->height - first_row)
+        return 1;
+
+    switch (src->format) {
+        case COLOR_CONVERT_YCbCr420p:
+            if (src->planes[2] == NULL)
+                return 1;
+            // fall through
+        case COLOR_CONVERT_NV12:
+        case COLOR_CONVERT_P010:
+            if (src->planes[1] == NULL || ((src->height | first_row | row_count) & 1))
+                return 1;
+            break;
+        case COLOR_CONVERT_YUY2:
+        case COLOR_CONVERT_UYVY:
+            chroma_shift = 0;
+            break;
+        default:
+            return 1;
+    }
+
+    dst += first_row * dst_stride;
+
+#if ENABLE_SIMD_SSE2
+    int level = ColorConvert_GetSIMDLevel();
+
+    // The SSE2 functions store with aligned writes.
+    if (level == COLOR_CONVERT_SIMD_SSE2 && src->format == COLOR_CONVERT_YCbCr420p &&
+        (((intptr_t)dst | dst_stride) & 15) == 0) {
+        pY = src->planes[0] + first_row * src->strides[0];
+        pU = src->planes[1] + (first_row >> 1) * src->strides[1];
+        pV = src->planes[2] + (first_row >> 1) * src->strides[2];
+        if (bgra)
+            return ColorConvert_YCbCr420p_to_BGRA32_no_alpha(dst, dst_stride, src->width, row_count,
+                                                             pY, pV, pU, src->strides[0], src->strides[2], src->strides[1]);
+        return ColorConvert_YCbCr420p_to_ARGB32_no_alpha(dst, dst_stride, src->width, row_count,
+                                                         pY, pV, pU, src->strides[0], src->strides[2], src->strides[1]);
+    }
+#endif // ENABLE_SIMD_SSE2
+
+    for (j = first_row; j < first_row + row_count; j++) {
+        int32_t done = 0;
+
+        pY = src->planes[0] + j * src->strides[0];
+        pU = pV = pY;
+        if (chroma_shift) {
+            pU = src->planes[1] + (j >> 1) * src->strides[1];
+            if (src->format == COLOR_CONVERT_YCbCr420p)
+                pV = src->planes[2] + (j >> 1) * src->strides[2];
+        }
+
+#if ENABLE_SIMD_SSE2
+        if (level == COLOR_CONVERT_SIMD_AVX2)
+            done = cc_row_avx2(src, dst, pY, pU, pV, bgra);
+#endif // ENABLE_SIMD_SSE2
+        if (done < src->width)
+            cc_row_scalar(src, dst, pY, pU, pV, done, bgra);
+
+        dst += dst_stride;
+    }
+
+    return 0;
+}
+// --- End row range conversion functions
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -101,6 +101,57 @@ extern "C" {
                                                   int32_t y_stride,
                                                   int32_t uv_stride);
 
+    /*
+     * Source layouts accepted by ColorConvert_Rows(). Chroma is always
+     * subsampled horizontally by two; the 4:2:0 layouts also vertically.
+     */
+    enum {
+        COLOR_CONVERT_YCbCr420p = 0,    // planes: Y, Cb, Cr
+        COLOR_CONVERT_NV12,             // planes: Y, interleaved CbCr
+        COLOR_CONVERT_P010,             // NV12 layout, 16 bit samples with 10 significant MSBs
+        COLOR_CONVERT_YUY2,             // plane: Y0 Cb Y1 Cr
+        COLOR_CONVERT_UYVY              // plane: Cb Y0 Cr Y1
+    };
+
+    typedef struct {
+        int32_t format;
+        int32_t width;
+        int32_t height;
+        const uint8_t *planes[3];
+        int32_t strides[3];             // in bytes
+    } ColorConvertSource;
+
+    /*
+     * Converts rows [first_row, first_row + row_count) of the source to
+     * BGRA32 (bgra != 0) or ARGB32 with opaque alpha. dst points to the
+     * first row of the whole destination image. Disjoint row ranges may be
+     * converted concurrently; for the 4:2:0 layouts ranges have to start on
+     * an even row and hold an even number of rows. Returns 0 on success.
+     */
+    int ColorConvert_Rows(const ColorConvertSource *src,
+                          uint8_t *dst,
+                          int32_t dst_stride,
+                          int32_t bgra,
+                          int32_t first_row,
+                          int32_t row_count);
+
+#define COLOR_CONVERT_SIMD_NONE 0
+#define COLOR_CONVERT_SIMD_SSE2 1
+#define COLOR_CONVERT_SIMD_AVX2 2
+
+    /*
+     * Returns the instruction set used by ColorConvert_Rows(). This is the
+     * best one supported by the CPU unless lowered by
+     * ColorConvert_SetSIMDLevel().
+     */
+    int ColorConvert_GetSIMDLevel(void);
+
+    /*
+     * Limits ColorConvert_Rows() to the given instruction set and returns
+     * the level actually in effect. Meant for testing and benchmarking.
+     */
+    int ColorConvert_SetSIMDLevel(int level);
+
 #ifdef __cplusplus
 };
 #endif
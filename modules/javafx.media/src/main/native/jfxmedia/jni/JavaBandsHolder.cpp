@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,7 +26,13 @@
 #include "JavaBandsHolder.h"
 #include "JniUtils.h"
 
+#include <string.h>
+
 CJavaBandsHolder::CJavaBandsHolder()
+:   m_jvm(NULL),
+    m_Bands(0),
+    m_Buffer(NULL),
+    m_pBands(NULL)
 {
 }
 
@@ -37,21 +43,24 @@ CJavaBandsHolder::~CJavaBandsHolder()
         JNIEnv *pEnv = jenv.getEnvironment();
 
         if (pEnv) {
-            if (m_Magnitudes) {
-                pEnv->DeleteGlobalRef(m_Magnitudes);
-                m_Magnitudes = NULL;
-            }
-
-            if (m_Phases) {
-                pEnv->DeleteGlobalRef(m_Phases);
-                m_Phases = NULL;
+            if (m_Buffer) {
+                pEnv->DeleteGlobalRef(m_Buffer);
+                m_Buffer = NULL;
+                m_pBands = NULL;
             }
         }
     }
 }
 
-bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases)
+bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jobject buffer)
 {
+    if (bands <= 0 || buffer == NULL)
+        return false;
+
+    float *pBands = (float*)env->GetDirectBufferAddress(buffer);
+    if (pBands == NULL || env->GetDirectBufferCapacity(buffer) < 2 * (jlong)bands)
+        return false;
+
     env->GetJavaVM(&m_jvm);
     if (env->ExceptionCheck()) {
         env->ExceptionClear();
@@ -59,9 +68,16 @@ bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jflo
         return false;
     }
 
+    // The global reference keeps the buffer, and so the memory at pBands,
+    // alive for as long as this holder is.
+    m_Buffer = env->NewGlobalRef(buffer);
+    if (m_Buffer == NULL) {
+        m_jvm = NULL;
+        return false;
+    }
+
     m_Bands = bands;
-    m_Magnitudes = (jfloatArray)env->NewGlobalRef(magnitudes);
-    m_Phases = (jfloatArray)env->NewGlobalRef(phases);
+    m_pBands = pBands;
 
     InitRef(this);
 
@@ -70,25 +86,11 @@ bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jflo
 
 void CJavaBandsHolder::UpdateBands(int size, const float* magnitudes, const float* phases)
 {
-    if (m_Bands != size || m_jvm == NULL)
+    if (m_Bands != size || m_pBands == NULL)
         return;
 
-    CJavaEnvironment jenv(m_jvm);
-    JNIEnv *pEnv = jenv.getEnvironment();
-    if (pEnv) {
-        // use local references due to threading issues
-        jfloatArray localMagnitudes = (jfloatArray)pEnv->NewLocalRef(m_Magnitudes);
-        jfloatArray localPhases = (jfloatArray)pEnv->NewLocalRef(m_Phases);
-
-        if (localMagnitudes && localPhases) {
-            pEnv->SetFloatArrayRegion(localMagnitudes, 0, size, magnitudes);
-            if (!jenv.clearException()) {
-                pEnv->SetFloatArrayRegion(localPhases, 0, size, phases);
-                jenv.clearException();
-            }
-        }
-
-        pEnv->DeleteLocalRef(localMagnitudes);
-        pEnv->DeleteLocalRef(localPhases);
-    }
+    // The bands live in a direct buffer, so no VM attach or JNI call is
+    // needed to publish them.
+    memcpy(m_pBands, magnitudes, size * sizeof(float));
+    memcpy(m_pBands + size, phases, size * sizeof(float));
 }
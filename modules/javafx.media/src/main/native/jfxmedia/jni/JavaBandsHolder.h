@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,14 +36,14 @@ public:
     ~CJavaBandsHolder();
 
 public:
-    bool Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases);
+    bool Init(JNIEnv* env, int bands, jobject buffer);
     void UpdateBands(int size, const float* magnitudes, const float* phases);
 
 private:
     JavaVM      *m_jvm;
     int         m_Bands;
-    jfloatArray m_Magnitudes;
-    jfloatArray m_Phases;
+    jobject     m_Buffer;  // direct FloatBuffer holding magnitudes then phases
+    float       *m_pBands; // address of m_Buffer, valid while m_Buffer is held
 };
 
 #endif // _JAVA_SPECTRUM_UPDATER_H_
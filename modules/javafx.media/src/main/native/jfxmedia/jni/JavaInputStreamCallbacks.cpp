@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,7 @@
 jfieldID  CJavaInputStreamCallbacks::m_BufferFID = 0;
 jmethodID CJavaInputStreamCallbacks::m_NeedBufferMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_ReadNextBlockMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_ReadNextBlockIntoMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_ReadBlockMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_IsSeekableMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_IsRandomAccessMID = 0;
@@ -97,6 +98,12 @@ bool CJavaInputStreamCallbacks::Init(JNIEnv *env, jobject jConnectionHolder)
             hasException = (javaEnv.reportException() || (NULL == m_ReadNextBlockMID));
         }
 
+        if (!hasException)
+        {
+            m_ReadNextBlockIntoMID = env->GetMethodID(klass, "readNextBlock", "(Ljava/nio/ByteBuffer;)I");
+            hasException = (javaEnv.reportException() || (NULL == m_ReadNextBlockIntoMID));
+        }
+
         if (!hasException)
         {
             m_ReadBlockMID = env->GetMethodID(klass, "readBlock", "(JI)I");
@@ -181,6 +188,34 @@ int CJavaInputStreamCallbacks::ReadNextBlock()
     return result;
 }
 
+int CJavaInputStreamCallbacks::ReadNextBlockInto(void* destination, int size)
+{
+    int result = -1;
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            // Java reads straight into the destination, the buffer must not outlive this call.
+            jobject buffer = pEnv->NewDirectByteBuffer(destination, (jlong)size);
+            if (buffer) {
+                result = pEnv->CallIntMethod(connection, m_ReadNextBlockIntoMID, buffer);
+                if (javaEnv.clearException()) {
+                    result = -2;
+                }
+                pEnv->DeleteLocalRef(buffer);
+            } else {
+                javaEnv.clearException();
+                result = -2;
+            }
+            pEnv->DeleteLocalRef(connection);
+        }
+    }
+
+    return result;
+}
+
 int CJavaInputStreamCallbacks::ReadBlock(int64_t position, int size)
 {
     int result = -1;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,7 @@ virtual ~CJavaInputStreamCallbacks();
 
     bool NeedBuffer();
     int  ReadNextBlock();
+    int  ReadNextBlockInto(void* destination, int size);
     int  ReadBlock(int64_t position, int size);
     void CopyBlock(void* destination, int size);
     bool IsSeekable();
@@ -54,6 +55,7 @@ private:
     static jfieldID  m_BufferFID;
     static jmethodID m_NeedBufferMID;
     static jmethodID m_ReadNextBlockMID;
+    static jmethodID m_ReadNextBlockIntoMID;
     static jmethodID m_ReadBlockMID;
     static jmethodID m_IsSeekableMID;
     static jmethodID m_IsRandomAccessMID;
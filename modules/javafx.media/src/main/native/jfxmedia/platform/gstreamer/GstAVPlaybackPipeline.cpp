@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,15 @@
 #define MAX_SIZE_BUFFERS_LIMIT 25
 #define MAX_SIZE_BUFFERS_INC   5
 
+// Limits of the auto buffering policy. Queues are grown, never shrunk, so
+// that a stream which needed deep queues once keeps them.
+#define AUTO_MAX_SIZE_BUFFERS     60
+#define AUTO_HIGH_BITRATE         20000000  // bits per second
+#define AUTO_DECODE_LOAD_PERCENT  50        // of the frame duration
+
+// Underrun warnings are sent at most this often, in microseconds.
+#define UNDERRUN_WARNING_INTERVAL G_USEC_PER_SEC
+
 //*************************************************************************************************
 //********** class CGstAVPlaybackPipeline
 //*************************************************************************************************
@@ -64,6 +73,21 @@ CGstAVPlaybackPipeline::CGstAVPlaybackPipeline(const GstElementContainer& elemen
     m_videoCodecErrorCode = ERROR_NONE;
     m_bStaticPipeline = false; // For now all video pipelines are dynamic
     m_FirstPTS = GST_CLOCK_TIME_NONE;
+    g_mutex_init(&m_LatestFrameLock);
+    m_pLatestFrame = NULL;
+    m_bLatestFrameAnnounced = false;
+    m_DroppedFrames = 0;
+    m_pConvertPool = new CGstVideoBufferPool();
+    g_mutex_init(&m_QueueStatsLock);
+    m_AudioUnderruns = 0;
+    m_VideoUnderruns = 0;
+    m_LastUnderrunWarning = 0;
+    g_atomic_int_set(&m_AudioQueueEOS, 0);
+    g_atomic_int_set(&m_VideoQueueEOS, 0);
+    m_audioQueueProbeHID = 0L;
+    m_videoQueueProbeHID = 0L;
+    m_LastStatsFrames = 0;
+    m_LastStatsDecodeTime = 0;
 }
 
 /**
@@ -77,6 +101,11 @@ CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()
     g_print ("CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()\n");
 #endif
     LOGGER_LOGMSG(LOGGER_DEBUG, "CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()");
+
+    if (m_pConvertPool != NULL)
+        m_pConvertPool->Unref();
+    g_mutex_clear(&m_LatestFrameLock);
+    g_mutex_clear(&m_QueueStatsLock);
 }
 
 /**
@@ -106,6 +135,22 @@ uint32_t CGstAVPlaybackPipeline::Init()
     g_signal_connect(m_Elements[AUDIO_QUEUE], "underrun", G_CALLBACK (queue_underrun), this);
     g_signal_connect(m_Elements[VIDEO_QUEUE], "underrun", G_CALLBACK (queue_underrun), this);
 
+    // Queues drain after EOS, watch for it so that is not taken for an underrun.
+    GstPad *pPad = gst_element_get_static_pad(m_Elements[AUDIO_QUEUE], "sink");
+    if (NULL != pPad)
+    {
+        m_audioQueueProbeHID = gst_pad_add_probe(pPad, (GstPadProbeType)(GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM | GST_PAD_PROBE_TYPE_EVENT_FLUSH),
+                                                 (GstPadProbeCallback)QueueSinkEventProbe, this, NULL);
+        gst_object_unref(pPad);
+    }
+    pPad = gst_element_get_static_pad(m_Elements[VIDEO_QUEUE], "sink");
+    if (NULL != pPad)
+    {
+        m_videoQueueProbeHID = gst_pad_add_probe(pPad, (GstPadProbeType)(GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM | GST_PAD_PROBE_TYPE_EVENT_FLUSH),
+                                                 (GstPadProbeCallback)QueueSinkEventProbe, this, NULL);
+        gst_object_unref(pPad);
+    }
+
     return CGstAudioPlaybackPipeline::Init();
 }
 
@@ -160,6 +205,27 @@ void CGstAVPlaybackPipeline::Dispose()
     g_signal_handlers_disconnect_by_func(m_Elements[AUDIO_QUEUE], (void*)G_CALLBACK(queue_underrun), this);
     g_signal_handlers_disconnect_by_func(m_Elements[VIDEO_QUEUE], (void*)G_CALLBACK(queue_underrun), this);
 
+    if (m_audioQueueProbeHID)
+    {
+        GstPad *pPad = gst_element_get_static_pad(m_Elements[AUDIO_QUEUE], "sink");
+        if (NULL != pPad)
+        {
+            gst_pad_remove_probe(pPad, m_audioQueueProbeHID);
+            gst_object_unref(pPad);
+        }
+        m_audioQueueProbeHID = 0L;
+    }
+    if (m_videoQueueProbeHID)
+    {
+        GstPad *pPad = gst_element_get_static_pad(m_Elements[VIDEO_QUEUE], "sink");
+        if (NULL != pPad)
+        {
+            gst_pad_remove_probe(pPad, m_videoQueueProbeHID);
+            gst_object_unref(pPad);
+        }
+        m_videoQueueProbeHID = 0L;
+    }
+
     CGstAudioPlaybackPipeline::Dispose();
 
     if (!m_bHasAudio && m_Elements[AUDIO_BIN] != NULL)
@@ -167,6 +233,112 @@ void CGstAVPlaybackPipeline::Dispose()
 
     if (!m_bHasVideo && m_Elements[VIDEO_BIN] != NULL)
         gst_object_unref(m_Elements[VIDEO_BIN]);
+
+    // The pipeline is stopped, no more frames will be posted.
+    g_mutex_lock(&m_LatestFrameLock);
+    CGstVideoFrame* pVideoFrame = m_pLatestFrame;
+    guint64 droppedFrames = m_DroppedFrames;
+    m_pLatestFrame = NULL;
+    g_mutex_unlock(&m_LatestFrameLock);
+    delete pVideoFrame;
+
+#if ENABLE_LOGGING
+    if (droppedFrames > 0)
+    {
+        gchar* message = g_strdup_printf("CGstAVPlaybackPipeline::Dispose() %" G_GUINT64_FORMAT
+                                         " superseded video frames were dropped", droppedFrames);
+        LOGGER_LOGMSG(LOGGER_DEBUG, message);
+        g_free(message);
+    }
+#endif
+}
+
+/**
+ * CGstAVPlaybackPipeline::TakeLatestVideoFrame()
+ *
+ * Takes the frame waiting in the latest-frame mailbox, if any. Called from
+ * the Java event thread in response to a SendNewFrameEvent(NULL).
+ */
+CVideoFrame* CGstAVPlaybackPipeline::TakeLatestVideoFrame()
+{
+    g_mutex_lock(&m_LatestFrameLock);
+    CGstVideoFrame* pVideoFrame = m_pLatestFrame;
+    m_pLatestFrame = NULL;
+    m_bLatestFrameAnnounced = false;
+    g_mutex_unlock(&m_LatestFrameLock);
+
+    return pVideoFrame;
+}
+
+/**
+ * CGstAVPlaybackPipeline::PostLatestFrame()
+ *
+ * Leaves a frame in the latest-frame mailbox, replacing and deleting any
+ * frame that has not been taken yet.
+ *
+ * @return  true if Java has to be notified, i.e. no notification is pending
+ */
+bool CGstAVPlaybackPipeline::PostLatestFrame(CGstVideoFrame* pVideoFrame)
+{
+    g_mutex_lock(&m_LatestFrameLock);
+    CGstVideoFrame* pDroppedFrame = m_pLatestFrame;
+    bool bAnnounce = !m_bLatestFrameAnnounced;
+    m_pLatestFrame = pVideoFrame;
+    m_bLatestFrameAnnounced = true;
+    if (pDroppedFrame != NULL)
+        m_DroppedFrames++;
+    g_mutex_unlock(&m_LatestFrameLock);
+
+    delete pDroppedFrame;
+
+    return bAnnounce;
+}
+
+/**
+ * CGstAVPlaybackPipeline::DeliverFrame()
+ *
+ * Wraps a decoded sample in a video frame and posts it to the latest-frame
+ * mailbox. Frames that are superseded before Java takes them never cross
+ * JNI, so high frame rates or a busy event thread cost no Java allocations.
+ *
+ * @param   pPipeline   Pointer to this class
+ * @param   pSample     Decoded sample; the caller keeps its reference
+ */
+void CGstAVPlaybackPipeline::DeliverFrame(CGstAVPlaybackPipeline* pPipeline, GstSample* pSample)
+{
+    CGstVideoFrame* pVideoFrame = new CGstVideoFrame();
+    if (!pVideoFrame->Init(pSample, pPipeline->m_pConvertPool))
+    {
+        delete pVideoFrame;
+        return;
+    }
+
+    if (pVideoFrame->IsValid() && pPipeline->m_pEventDispatcher)
+    {
+        CPlayerEventDispatcher* pEventDispatcher = pPipeline->m_pEventDispatcher;
+
+        // Java takes the frame out of the mailbox and deletes it later.
+        if (pPipeline->PostLatestFrame(pVideoFrame) && !pEventDispatcher->SendNewFrameEvent(NULL))
+        {
+            // Let the next frame try again.
+            g_mutex_lock(&pPipeline->m_LatestFrameLock);
+            pPipeline->m_bLatestFrameAnnounced = false;
+            g_mutex_unlock(&pPipeline->m_LatestFrameLock);
+
+            if(!pEventDispatcher->SendPlayerMediaErrorEvent(ERROR_JNI_SEND_NEW_FRAME_EVENT))
+            {
+                LOGGER_LOGMSG(LOGGER_ERROR, "Cannot send media error event.\n");
+            }
+        }
+    }
+    else
+    {
+        delete pVideoFrame;
+        if (pPipeline->m_pEventDispatcher != NULL) {
+            pPipeline->m_pEventDispatcher->Warning(WARNING_GSTREAMER_INVALID_FRAME,
+                                                   "Invalid frame");
+        }
+    }
 }
 
 bool CGstAVPlaybackPipeline::IsCodecSupported(GstCaps *pCaps)
@@ -348,37 +520,7 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
             GST_BUFFER_TIMESTAMP(pBuffer) - pPipeline->m_FirstPTS;
     }
 
-    //***** Create a VideoFrame object
-    CGstVideoFrame* pVideoFrame = new CGstVideoFrame();
-    if (!pVideoFrame->Init(pSample))
-    {
-        gst_sample_unref(pSample);
-        delete pVideoFrame;
-        return GST_FLOW_OK;
-    }
-
-    if (pVideoFrame->IsValid() && pPipeline->m_pEventDispatcher)
-    {
-        CPlayerEventDispatcher* pEventDispatcher = pPipeline->m_pEventDispatcher;
-
-        // Send new frame which Java will delete later.
-        if (!pEventDispatcher->SendNewFrameEvent(pVideoFrame))
-        {
-            if(!pEventDispatcher->SendPlayerMediaErrorEvent(ERROR_JNI_SEND_NEW_FRAME_EVENT))
-            {
-                LOGGER_LOGMSG(LOGGER_ERROR, "Cannot send media error event.\n");
-            }
-        }
-    }
-    else
-    {
-        delete pVideoFrame;
-        if (pPipeline->m_pEventDispatcher != NULL) {
-            pPipeline->m_pEventDispatcher->Warning(WARNING_GSTREAMER_INVALID_FRAME,
-                                                   "Invalid frame");
-        }
-
-    }
+    DeliverFrame(pPipeline, pSample);
 
 // INLINE - gst_sample_unref()
     gst_sample_unref (pSample);
@@ -427,28 +569,7 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkPreroll(GstElement* pElem, CGstAV
                 GST_BUFFER_TIMESTAMP(pBuffer) - pPipeline->m_FirstPTS;
         }
 
-        CGstVideoFrame* pVideoFrame = new CGstVideoFrame();
-        if (!pVideoFrame->Init(pSample))
-        {
-            // INLINE - gst_sample_unref()
-            gst_sample_unref (pSample);
-            delete pVideoFrame;
-            return GST_FLOW_OK;
-        }
-        if (pVideoFrame->IsValid()) {
-            if (!pPipeline->m_pEventDispatcher->SendNewFrameEvent(pVideoFrame))
-            {
-                if (!pPipeline->m_pEventDispatcher->SendPlayerMediaErrorEvent(ERROR_JNI_SEND_NEW_FRAME_EVENT))
-                {
-                    LOGGER_LOGMSG(LOGGER_ERROR, "Cannot send media error event.\n");
-                }
-            }
-        } else {
-            delete pVideoFrame;
-            if (pPipeline->m_pEventDispatcher != NULL) {
-                pPipeline->m_pEventDispatcher->Warning(WARNING_GSTREAMER_INVALID_FRAME, "Invalid frame");
-            }
-        }
+        DeliverFrame(pPipeline, pSample);
     }
 
 // INLINE - gst_sample_unref()
@@ -763,6 +884,152 @@ void CGstAVPlaybackPipeline::CheckQueueSize(GstElement *element)
     }
 }
 
+void CGstAVPlaybackPipeline::GrowQueue(GstElement* queue, guint maxSizeBuffers)
+{
+    guint max_size_buffers = 0;
+
+    maxSizeBuffers = MIN(maxSizeBuffers, AUTO_MAX_SIZE_BUFFERS);
+    g_object_get(queue, "max-size-buffers", &max_size_buffers, NULL);
+    if (max_size_buffers < maxSizeBuffers)
+    {
+        g_object_set(queue, "max-size-buffers", maxSizeBuffers, NULL);
+        LOGGER_LOGMSG(LOGGER_DEBUG, (queue == m_Elements[VIDEO_QUEUE]) ? "Video queue grown" : "Audio queue grown");
+    }
+}
+
+// Returns the bitrate of the data currently held by the queue, 0 if unknown.
+guint64 CGstAVPlaybackPipeline::GetQueueBitrate(GstElement* queue)
+{
+    guint current_level_bytes = 0;
+    guint64 current_level_time = 0;
+
+    g_object_get(queue, "current-level-bytes", &current_level_bytes, "current-level-time", &current_level_time, NULL);
+    if (current_level_time == 0)
+        return 0;
+
+    return gst_util_uint64_scale((guint64)current_level_bytes * 8, GST_SECOND, current_level_time);
+}
+
+/**
+ * CGstAVPlaybackPipeline::OnVideoDecoderStats()
+ *
+ * Grows the video queue under the auto buffering policy when the stream
+ * bitrate is high or decoding takes a large part of each frame duration,
+ * since both leave little slack for bitrate peaks.
+ */
+void CGstAVPlaybackPipeline::OnVideoDecoderStats(const GstStructure *pStats)
+{
+    guint64 frames = 0;
+    guint64 decodeTime = 0;
+
+    if (m_pOptions->GetBufferingPolicy() != CPipelineOptions::kBufferingAuto)
+        return;
+
+    gst_structure_get_uint64(pStats, "frames", &frames);
+    gst_structure_get_uint64(pStats, "decode-time", &decodeTime);
+
+    // The statistics are cumulative and restart with the decoder
+    guint64 newFrames = frames;
+    guint64 newDecodeTime = decodeTime;
+    if (frames >= m_LastStatsFrames && decodeTime >= m_LastStatsDecodeTime)
+    {
+        newFrames -= m_LastStatsFrames;
+        newDecodeTime -= m_LastStatsDecodeTime;
+    }
+    m_LastStatsFrames = frames;
+    m_LastStatsDecodeTime = decodeTime;
+
+    bool bGrow = (GetQueueBitrate(m_Elements[VIDEO_QUEUE]) >= AUTO_HIGH_BITRATE);
+
+    float frameRate = GetEncodedVideoFrameRate();
+    if (!bGrow && newFrames > 0 && frameRate > 0.0F)
+    {
+        double frameDuration = GST_SECOND / frameRate;
+        bGrow = ((double)newDecodeTime / newFrames * 100.0 > frameDuration * AUTO_DECODE_LOAD_PERCENT);
+    }
+
+    if (bGrow)
+        GrowQueue(m_Elements[VIDEO_QUEUE],
+                  CGstPipelineFactory::GetQueueSize(CPipelineOptions::kBufferingHighThroughput, true));
+}
+
+/**
+ * CGstAVPlaybackPipeline::ReportQueueUnderrun()
+ *
+ * Counts an underrun of a queue during playback and sends a warning with the
+ * current levels of both queues, at most once per UNDERRUN_WARNING_INTERVAL.
+ */
+void CGstAVPlaybackPipeline::ReportQueueUnderrun(GstElement* queue)
+{
+    bool bVideo = (queue == m_Elements[VIDEO_QUEUE]);
+    gint64 now = g_get_monotonic_time();
+    bool bWarn = false;
+    guint audioUnderruns, videoUnderruns;
+
+    g_mutex_lock(&m_QueueStatsLock);
+    if (bVideo)
+        m_VideoUnderruns++;
+    else
+        m_AudioUnderruns++;
+    audioUnderruns = m_AudioUnderruns;
+    videoUnderruns = m_VideoUnderruns;
+    if (now - m_LastUnderrunWarning >= UNDERRUN_WARNING_INTERVAL)
+    {
+        m_LastUnderrunWarning = now;
+        bWarn = true;
+    }
+    g_mutex_unlock(&m_QueueStatsLock);
+
+    if (!bWarn || m_pEventDispatcher == NULL)
+        return;
+
+    guint audio_level = 0, audio_max = 0, video_level = 0, video_max = 0;
+    g_object_get(m_Elements[AUDIO_QUEUE], "current-level-buffers", &audio_level, "max-size-buffers", &audio_max, NULL);
+    g_object_get(m_Elements[VIDEO_QUEUE], "current-level-buffers", &video_level, "max-size-buffers", &video_max, NULL);
+
+    gchar* message = g_strdup_printf("%s queue underrun: audio queue %u/%u buffers (%u underruns), "
+                                     "video queue %u/%u buffers (%u underruns), %" G_GUINT64_FORMAT " bit/s",
+                                     bVideo ? "Video" : "Audio",
+                                     audio_level, audio_max, audioUnderruns,
+                                     video_level, video_max, videoUnderruns,
+                                     GetQueueBitrate(m_Elements[VIDEO_QUEUE]));
+    if (message != NULL)
+    {
+        m_pEventDispatcher->Warning(WARNING_GSTREAMER_QUEUE_UNDERRUN, message);
+        g_free(message);
+    }
+}
+
+GstPadProbeReturn CGstAVPlaybackPipeline::QueueSinkEventProbe(GstPad* pPad, GstPadProbeInfo *pInfo, CGstAVPlaybackPipeline* pPipeline)
+{
+    GstEvent *pEvent = GST_PAD_PROBE_INFO_EVENT(pInfo);
+    GstObject *pQueue = GST_OBJECT_PARENT(pPad);
+    volatile gint *pEOS = NULL;
+
+    if (pQueue == GST_OBJECT(pPipeline->m_Elements[AUDIO_QUEUE]))
+        pEOS = &pPipeline->m_AudioQueueEOS;
+    else if (pQueue == GST_OBJECT(pPipeline->m_Elements[VIDEO_QUEUE]))
+        pEOS = &pPipeline->m_VideoQueueEOS;
+
+    if (pEOS != NULL && pEvent != NULL)
+    {
+        switch (GST_EVENT_TYPE(pEvent))
+        {
+            case GST_EVENT_EOS:
+                g_atomic_int_set(pEOS, 1);
+                break;
+            case GST_EVENT_FLUSH_STOP:
+            case GST_EVENT_STREAM_START:
+                g_atomic_int_set(pEOS, 0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return GST_PAD_PROBE_OK;
+}
+
 void CGstAVPlaybackPipeline::queue_overrun(GstElement *element, CGstAVPlaybackPipeline *pPipeline)
 {
     pPipeline->CheckQueueSize(element);
@@ -819,6 +1086,23 @@ void CGstAVPlaybackPipeline::queue_underrun(GstElement *element, CGstAVPlaybackP
             max_size_buffers += MAX_SIZE_BUFFERS_INC;
             g_object_set(inc_element, "max-size-buffers", max_size_buffers, NULL);
         }
+
+        // Queues drain on their own while prerolling, after a flush and at the
+        // end of the stream, only running dry during steady playback means the
+        // data arrives too slowly.
+        volatile gint *pEOS = (pPipeline->m_Elements[VIDEO_QUEUE] == element) ? &pPipeline->m_VideoQueueEOS
+                                                                              : &pPipeline->m_AudioQueueEOS;
+        if (state == GST_STATE_PLAYING && pending_state == GST_STATE_VOID_PENDING &&
+            !g_atomic_int_get(pEOS) && pPipeline->IsPlayerState(Playing) && !pPipeline->IsSeekInProgress())
+        {
+            pPipeline->ReportQueueUnderrun(element);
+
+            if (!inc_size_time && pPipeline->m_pOptions->GetBufferingPolicy() == CPipelineOptions::kBufferingAuto)
+            {
+                g_object_get(element, "max-size-buffers", &max_size_buffers, NULL);
+                pPipeline->GrowQueue(element, max_size_buffers + MAX_SIZE_BUFFERS_INC);
+            }
+        }
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,8 @@
 #include "GstAudioPlaybackPipeline.h"
 #include "GstPipelineFactory.h"
 
+class CGstVideoFrame;
+class CGstVideoBufferPool;
 
 /**
  * class CGstAVPlaybackPipeline
@@ -52,6 +54,9 @@ public:
     virtual bool LoadDecoder(GstCaps *pCaps);
 
     virtual void CheckQueueSize(GstElement *element);
+    virtual void OnVideoDecoderStats(const GstStructure *pStats);
+
+    virtual CVideoFrame* TakeLatestVideoFrame();
 
     void         SetEncodedVideoFrameRate(float frameRate);
 
@@ -69,6 +74,14 @@ private:
     static GstFlowReturn     OnAppSinkHaveFrame(GstElement* pElem, CGstAVPlaybackPipeline* pPipeline);
     static void     OnAppSinkVideoFrameDiscont(CGstAVPlaybackPipeline* pPipeline, GstSample *pSample);
     static GstPadProbeReturn VideoDecoderSrcProbe(GstPad* pPad, GstPadProbeInfo *pInfo, CGstAVPlaybackPipeline* pPipeline);
+    static GstPadProbeReturn QueueSinkEventProbe(GstPad* pPad, GstPadProbeInfo *pInfo, CGstAVPlaybackPipeline* pPipeline);
+    static void     DeliverFrame(CGstAVPlaybackPipeline* pPipeline, GstSample* pSample);
+
+    bool            PostLatestFrame(CGstVideoFrame* pVideoFrame);
+
+    void            GrowQueue(GstElement* queue, guint maxSizeBuffers);
+    guint64         GetQueueBitrate(GstElement* queue);
+    void            ReportQueueUnderrun(GstElement* queue);
 
     inline float    GetEncodedVideoFrameRate()
     {
@@ -83,6 +96,31 @@ private:
     gfloat                  m_EncodedVideoFrameRate;
     int                     m_videoCodecErrorCode;
     GstClockTime            m_FirstPTS;
+
+    // Latest-frame mailbox: holds the newest decoded frame until the Java
+    // event thread takes it. m_bLatestFrameAnnounced is set while a
+    // notification is outstanding.
+    GMutex                  m_LatestFrameLock;
+    CGstVideoFrame*         m_pLatestFrame;
+    bool                    m_bLatestFrameAnnounced;
+    guint64                 m_DroppedFrames;
+    CGstVideoBufferPool*    m_pConvertPool;
+
+    // Queue metrics, reported with WARNING_GSTREAMER_QUEUE_UNDERRUN and used
+    // by the auto buffering policy. Protected by m_QueueStatsLock.
+    GMutex                  m_QueueStatsLock;
+    guint                   m_AudioUnderruns;
+    guint                   m_VideoUnderruns;
+    gint64                  m_LastUnderrunWarning;
+    // Set once EOS entered the queue, until a flush or a new stream.
+    volatile gint           m_AudioQueueEOS;
+    volatile gint           m_VideoQueueEOS;
+    gulong                  m_audioQueueProbeHID;
+    gulong                  m_videoQueueProbeHID;
+    // Decoder statistics at the previous video-decoder-stats message, only
+    // touched on the bus thread.
+    guint64                 m_LastStatsFrames;
+    guint64                 m_LastStatsDecodeTime;
 };
 
 #endif  //_GST_AV_PLAYBACK_PIPELINE_H_
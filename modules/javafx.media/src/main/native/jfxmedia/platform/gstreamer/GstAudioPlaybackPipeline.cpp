@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -74,6 +74,7 @@ CGstAudioPlaybackPipeline::CGstAudioPlaybackPipeline(const GstElementContainer&
 
     m_SeekLock = CJfxCriticalSection::Create();
     m_LastSeekTime = -1;
+    g_atomic_int_set(&m_SeekPending, 0);
 
     m_dLastReportedDuration = DURATION_UNKNOWN;
 
@@ -126,6 +127,10 @@ uint32_t CGstAudioPlaybackPipeline::Init()
     if (m_pAudioSpectrum == NULL)
         return ERROR_MEMORY_ALLOCATION;
 
+    g_object_set(m_Elements[AUDIO_SPECTRUM],
+                 "window", (guint)m_pOptions->GetSpectrumWindow(),
+                 "overlap", (guint)m_pOptions->GetSpectrumOverlap(), NULL);
+
     if (m_pOptions->GetBufferingEnabled())
         m_bStaticPipeline = false; // Pipeline is dynamic if we have progress buffer
 
@@ -607,6 +612,7 @@ uint32_t CGstAudioPlaybackPipeline::SeekPipeline(gint64 seek_time)
     m_SeekLock->Enter();
 
     m_LastSeekTime = seek_time;
+    g_atomic_int_set(&m_SeekPending, 1);
 
     if (m_fRate < -1.0F || m_fRate > 1.0F)
         seekFlags = (GstSeekFlags)(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_SKIP);
@@ -647,6 +653,7 @@ uint32_t CGstAudioPlaybackPipeline::SeekPipeline(gint64 seek_time)
         }
     }
 
+    g_atomic_int_set(&m_SeekPending, 0);
     m_SeekLock->Exit();
 
     return ERROR_GSTREAMER_PIPELINE_SEEK;
@@ -1518,24 +1525,10 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
                 if (!gst_structure_get_clock_time (pStr, "duration", &duration))
                     duration = GST_CLOCK_TIME_NONE;
 
-                size_t bandsNum = pPipeline->GetAudioSpectrum()->GetBands();
-
-                if (bandsNum > 0)
+                if (pPipeline->m_pAudioSpectrum != NULL)
                 {
-                    float *magnitudes = new float[bandsNum];
-                    float *phases = new float[bandsNum];
-
-                    const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
-                    const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-                    for (int i=0; i < bandsNum; i++)
-                    {
-                        magnitudes[i] = g_value_get_float( gst_value_list_get_value (magnitudes_value, i));
-                        phases[i] = g_value_get_float( gst_value_list_get_value (phases_value, i));
-                    }
-                    pPipeline->GetAudioSpectrum()->UpdateBands((int)bandsNum, magnitudes, phases);
-
-                    delete [] magnitudes;
-                    delete [] phases;
+                    pPipeline->m_pAudioSpectrum->UpdateBands(gst_structure_get_value(pStr, "magnitude"),
+                                                             gst_structure_get_value(pStr, "phase"));
                 }
 
                 if (!pPipeline->m_pEventDispatcher->SendAudioSpectrumEvent(GST_TIME_AS_SECONDS((double)timestamp),
@@ -1549,13 +1542,40 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
                     }
                 }
           }
-
+            else if (gst_structure_has_name(pStr, VIDEO_DECODER_STATS_MESSAGE))
+            {
+                pPipeline->OnVideoDecoderStats(pStr);
+#if ENABLE_LOGGING
+                gint threads = 0;
+                guint64 frames = 0;
+                guint64 decodeTime = 0;
+                guint queueDepth = 0;
+                guint maxQueueDepth = 0;
+
+                gst_structure_get_int(pStr, "threads", &threads);
+                gst_structure_get_uint64(pStr, "frames", &frames);
+                gst_structure_get_uint64(pStr, "decode-time", &decodeTime);
+                gst_structure_get_uint(pStr, "queue-depth", &queueDepth);
+                gst_structure_get_uint(pStr, "max-queue-depth", &maxQueueDepth);
+
+                if (frames > 0)
+                {
+                    gchar* message = g_strdup_printf("Video decoder: %" G_GUINT64_FORMAT " frames on %d threads, "
+                                                     "%.3f ms per frame, queue depth %u (max %u)",
+                                                     frames, threads, (double)decodeTime / frames / GST_MSECOND,
+                                                     queueDepth, maxQueueDepth);
+                    LOGGER_LOGMSG(LOGGER_DEBUG, message);
+                    g_free(message);
+                }
+#endif // ENABLE_LOGGING
+            }
         }
             break;
 
         case GST_MESSAGE_ASYNC_DONE:
             pPipeline->m_SeekLock->Enter();
             pPipeline->m_LastSeekTime = -1;
+            g_atomic_int_set(&pPipeline->m_SeekPending, 0);
             pPipeline->m_SeekLock->Exit();
             break;
 
@@ -1674,6 +1694,13 @@ bool CGstAudioPlaybackPipeline::IsPlayerPendingState(PlayerState state)
     return result;
 }
 
+// Lock free, since m_SeekLock is held across flushing seeks which wait for the
+// streaming threads this may be called from.
+bool CGstAudioPlaybackPipeline::IsSeekInProgress()
+{
+    return g_atomic_int_get(&m_SeekPending) != 0;
+}
+
 /**
  * CGstAudioPlaybackPipeline::UpdatePlayerState()
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -111,6 +111,7 @@ public:
     virtual bool LoadDecoder(GstCaps *pCaps);
 
     virtual void CheckQueueSize(GstElement *element) {};
+    virtual void OnVideoDecoderStats(const GstStructure *pStats) {};
 
     GstElementContainer m_Elements;
 
@@ -124,6 +125,7 @@ protected:
     void                UpdatePlayerState(GstState newState, GstState oldState);
     bool                IsPlayerState(PlayerState state);
     bool                IsPlayerPendingState(PlayerState state);
+    bool                IsSeekInProgress();
 
     sBusCallbackContent* m_pBusCallbackContent;
 
@@ -175,6 +177,7 @@ private:
     // Seek/Rate
     CJfxCriticalSection* m_SeekLock;
     gint64               m_LastSeekTime;
+    volatile gint        m_SeekPending;   // From a seek until its ASYNC_DONE, read without m_SeekLock
 
     // Incrementally filled structure. Earlier it's filled earlier we send AudioTrack event.
     struct AudioTrackInfo
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include <PipelineManagement/AudioSpectrum.h>
 #include <jni/JavaBandsHolder.h>
 #include <jni/JniUtils.h>
+#include <new>
 
 /************************************************************************
  *
@@ -63,11 +64,15 @@ CGstAudioSpectrum::CGstAudioSpectrum(GstElement* pSpectrum, bool enabled)
                               "message-magnitude", TRUE,
                               "message-phase", TRUE, NULL);
     g_atomic_pointer_set(&m_pHolder, NULL);
+
+    m_pBands = NULL;
+    m_BandsSize = 0;
 }
 
 CGstAudioSpectrum::~CGstAudioSpectrum()
 {
     CBandsHolder::ReleaseRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
+    delete [] m_pBands;
     gst_object_unref(m_pSpectrum);
 }
 
@@ -102,10 +107,42 @@ void CGstAudioSpectrum::SetBands(int bands, CBandsHolder* holder)
 void CGstAudioSpectrum::UpdateBands(int size, const float* magnitudes, const float* phases)
 {
     CBandsHolder *holder = CBandsHolder::AddRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
-    holder->UpdateBands(size, magnitudes, phases);
+    if (holder != NULL)
+        holder->UpdateBands(size, magnitudes, phases);
     CBandsHolder::ReleaseRef(holder);
 }
 
+void CGstAudioSpectrum::UpdateBands(const GValue* magnitudes, const GValue* phases)
+{
+    if (magnitudes == NULL || phases == NULL)
+        return;
+
+    guint size = gst_value_list_get_size(magnitudes);
+    if (size == 0 || size != gst_value_list_get_size(phases))
+        return;
+
+    if (m_BandsSize != size)
+    {
+        delete [] m_pBands;
+        m_pBands = new (std::nothrow) float[2 * size];
+        m_BandsSize = (m_pBands != NULL) ? size : 0;
+        if (m_pBands == NULL)
+            return;
+    }
+
+    float *pMagnitudes = m_pBands;
+    float *pPhases = m_pBands + size;
+    for (guint i = 0; i < size; i++)
+    {
+        pMagnitudes[i] = g_value_get_float(gst_value_list_get_value(magnitudes, i));
+        pPhases[i] = g_value_get_float(gst_value_list_get_value(phases, i));
+    }
+
+    // The holder drops updates whose size does not match the band count set
+    // from Java, e.g. while a band count change is still in flight.
+    UpdateBands((int)size, pMagnitudes, pPhases);
+}
+
 double CGstAudioSpectrum::GetInterval()
 {
     guint64 interval;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,7 @@ public:
     virtual void      SetBands(int bands, CBandsHolder* updater);
     virtual size_t    GetBands();
     virtual void      UpdateBands(int size, const float* magnitudes, const float* phases);
+    void              UpdateBands(const GValue* magnitudes, const GValue* phases);
 
     virtual double    GetInterval();
     virtual void      SetInterval(double interval);
@@ -51,6 +52,11 @@ public:
 private:
     GstElement*            m_pSpectrum;
     volatile CBandsHolder* m_pHolder;
+
+    // Scratch space for unpacking spectrum messages, reused between messages.
+    // Only touched from the bus thread.
+    float*                 m_pBands;
+    guint                  m_BandsSize;
 };
 
 #endif // _GST_AUDIO_SPECTRUM_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -179,11 +179,22 @@ extern "C" {
      * @return  Media reference.  This reference must be used when calling GSTMediaPlayer function.
      */
     JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMedia_gstInitNativeMedia
-    (JNIEnv *env, jobject obj, jobject jLocator, jstring jContentType, jlong jSizeHint, jlongArray jlMediaHandle)
+    (JNIEnv *env, jobject obj, jobject jLocator, jstring jContentType, jlong jSizeHint, jint jVideoDecoderThreads,
+     jint jSourceReadAhead, jint jSpectrumWindow, jint jSpectrumOverlap,
+     jint jBufferingPolicy, jlongArray jlMediaHandle)
     {
         LOWLEVELPERF_EXECTIMESTART("gstInitNativeMediaToSendToJavaPlayerStateEventPaused");
         LOWLEVELPERF_EXECTIMESTART("gstInitNativeMedia()");
-        uint32_t result = InitMedia(env, NULL, jLocator, jContentType, jSizeHint, jlMediaHandle);
+        CPipelineOptions* pOptions = new (nothrow) CPipelineOptions();
+        if (NULL == pOptions)
+            return ERROR_MEMORY_ALLOCATION;
+        pOptions->SetVideoDecoderThreads((int)jVideoDecoderThreads);
+        pOptions->SetSourceReadAhead((int)jSourceReadAhead);
+        pOptions->SetSpectrumWindow((int)jSpectrumWindow);
+        pOptions->SetSpectrumOverlap((int)jSpectrumOverlap);
+        pOptions->SetBufferingPolicy((int)jBufferingPolicy);
+
+        uint32_t result = InitMedia(env, pOptions, jLocator, jContentType, jSizeHint, jlMediaHandle);
         LOWLEVELPERF_EXECTIMESTOP("gstInitNativeMedia()");
 
         return result;
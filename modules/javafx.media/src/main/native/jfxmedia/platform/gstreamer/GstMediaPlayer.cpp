@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -545,6 +545,26 @@ JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMed
     return iRet;
 }
 
+/**
+ * gstTakeLatestFrame()
+ *
+ * Takes the newest video frame out of the pipeline's latest-frame mailbox.
+ * The returned frame is owned by the caller; 0 is returned if none is waiting.
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMediaPlayer_gstTakeLatestFrame
+(JNIEnv *env, jobject obj, jlong ref_media)
+{
+    CMedia* pMedia = (CMedia*)jlong_to_ptr(ref_media);
+    if (NULL == pMedia)
+        return 0;
+
+    CPipeline* pPipeline = (CPipeline*)pMedia->GetPipeline();
+    if (NULL == pPipeline)
+        return 0;
+
+    return ptr_to_jlong(pPipeline->TakeLatestVideoFrame());
+}
+
 #ifdef __cplusplus
 }
 #endif
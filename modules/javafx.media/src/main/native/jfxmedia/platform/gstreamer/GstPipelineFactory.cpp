@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,16 @@
 #define HLS_VALUE_MIMETYPE_FMP4 3
 #define HLS_VALUE_MIMETYPE_AAC  4
 
+// Initial max-size-buffers of the audio and video queues for each buffering
+// policy, indexed by CPipelineOptions::kBuffering*. The auto policy starts
+// balanced and is grown by CGstAVPlaybackPipeline while playing.
+static const guint g_QueueSizes[][2] = {
+    { 10, 10 }, // kBufferingBalanced
+    {  3,  5 }, // kBufferingLowLatency
+    { 20, 30 }, // kBufferingHighThroughput
+    { 10, 10 }, // kBufferingAuto
+};
+
 
 //*************************************************************************************************
 //********** class CGstPipelineFactory
@@ -244,6 +254,7 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
 
     g_signal_connect(javaSource, "read-next-block", G_CALLBACK(SourceReadNextBlock), callbacks);
     g_signal_connect(javaSource, "copy-block", G_CALLBACK(SourceCopyBlock), callbacks);
+    g_signal_connect(javaSource, "read-next-block-into", G_CALLBACK(SourceReadNextBlockInto), callbacks);
     g_signal_connect(javaSource, "seek-data", G_CALLBACK(SourceSeekData), callbacks);
     g_signal_connect(javaSource, "close-connection", G_CALLBACK(SourceCloseConnection), callbacks);
     g_signal_connect(javaSource, "property", G_CALLBACK(SourceProperty), callbacks);
@@ -253,6 +264,11 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
 
     if (pOptions->GetHLSModeEnabled())
         g_object_set(javaSource, "hls-mode", TRUE, NULL);
+    else
+        g_object_set(javaSource,
+                     "zero-copy", TRUE,
+                     "read-ahead", (guint)pOptions->GetSourceReadAhead(),
+                     NULL);
 
     if (streamMimeType == HLS_VALUE_MIMETYPE_MP2T)
         g_object_set(javaSource, "mimetype", CONTENT_TYPE_MP2T, NULL);
@@ -309,6 +325,11 @@ gint CGstPipelineFactory::SourceReadNextBlock(GstElement *src, gpointer data)
     return ((CStreamCallbacks*)data)->ReadNextBlock();
 }
 
+gint CGstPipelineFactory::SourceReadNextBlockInto(GstElement *src, gpointer buffer, int size, gpointer data)
+{
+    return ((CStreamCallbacks*)data)->ReadNextBlockInto(buffer, size);
+}
+
 gint CGstPipelineFactory::SourceReadBlock(GstElement *src, guint64 position, guint size, gpointer data)
 {
     return ((CStreamCallbacks*)data)->ReadBlock(position, size);
@@ -691,7 +712,7 @@ uint32_t CGstPipelineFactory::CreateAudioPipeline(bool bConvertFormat, CPipeline
     GstElement* audiobin;
     uRetCode = CreateAudioBin(pOptions->GetStreamParser(),
                               pOptions->GetAudioDecoder(),
-                              bConvertFormat, pElements, &flags, &audiobin);
+                              bConvertFormat, pOptions, pElements, &flags, &audiobin);
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
@@ -779,7 +800,7 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
     int audioFlags = 0;
     GstElement *audiobin = NULL;
     uRetCode = CreateAudioBin(NULL, pOptions->GetAudioDecoder(), bConvertFormat,
-                              pElements, &audioFlags, &audiobin);
+                              pOptions, pElements, &audioFlags, &audiobin);
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
@@ -807,10 +828,15 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
     }
 
     GstElement *videobin;
-    uRetCode = CreateVideoBin(pOptions->GetVideoDecoder(), pVideoSink, pElements, &videobin);
+    uRetCode = CreateVideoBin(pOptions->GetVideoDecoder(), pVideoSink, pOptions, pElements, &videobin);
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
+    // Only the libavcodec based decoder can be threaded.
+    GstElement *videodec = (*pElements)[VIDEO_DECODER];
+    if (videodec != NULL && g_object_class_find_property(G_OBJECT_GET_CLASS(videodec), "thread-count") != NULL)
+        g_object_set(videodec, "thread-count", pOptions->GetVideoDecoderThreads(), NULL);
+
     pElements->add(PIPELINE, pipeline);
     pElements->add(AV_DEMUXER, demuxer);
     if (audioDemuxer != NULL)
@@ -824,7 +850,7 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
 }
 
 uint32_t CGstPipelineFactory::CreateAudioBin(const char* strParserName, const char* strDecoderName,
-                                             bool bConvertFormat,
+                                             bool bConvertFormat, CPipelineOptions* pOptions,
                                              GstElementContainer* elements, int* pFlags,
                                              GstElement** ppAudiobin)
 {
@@ -963,13 +989,16 @@ uint32_t CGstPipelineFactory::CreateAudioBin(const char* strParserName, const ch
         *pFlags |= AUDIO_DECODER_HAS_SOURCE_PROBE | AUDIO_DECODER_HAS_SINK_PROBE;
     }
 
-    // Switch off limiting of the audioqueue for bytes and buffers.
-    g_object_set(audioqueue, "max-size-bytes", (guint)0, "max-size-buffers", (guint)10, "max-size-time", (guint64)0, NULL);
+    // Switch off limiting of the audioqueue for bytes and time, the buffering policy sets the number of buffers.
+    g_object_set(audioqueue, "max-size-bytes", (guint)0,
+                 "max-size-buffers", GetQueueSize(pOptions->GetBufferingPolicy(), false),
+                 "max-size-time", (guint64)0, NULL);
 
     return ERROR_NONE;
 }
 
 uint32_t CGstPipelineFactory::CreateVideoBin(const char* strDecoderName, GstElement* pVideoSink,
+                                             CPipelineOptions* pOptions,
                                              GstElementContainer* elements, GstElement** ppVideobin)
 {
     *ppVideobin = gst_bin_new(NULL);
@@ -1043,8 +1072,10 @@ uint32_t CGstPipelineFactory::CreateVideoBin(const char* strDecoderName, GstElem
     add(VIDEO_DECODER, videodec).
     add(VIDEO_SINK, pVideoSink);
 
-    // Switch off limiting of the videoqueue for bytes and buffers.
-    g_object_set(videoqueue, "max-size-bytes", (guint)0, "max-size-buffers", (guint)10, "max-size-time", (guint64)0, NULL);
+    // Switch off limiting of the videoqueue for bytes and time, the buffering policy sets the number of buffers.
+    g_object_set(videoqueue, "max-size-bytes", (guint)0,
+                 "max-size-buffers", GetQueueSize(pOptions->GetBufferingPolicy(), true),
+                 "max-size-time", (guint64)0, NULL);
     g_object_set(pVideoSink, "qos", TRUE, NULL);
 
     return ERROR_NONE;
@@ -1058,6 +1089,14 @@ GstElement* CGstPipelineFactory::CreateElement(const char* strFactoryName)
     return gst_element_factory_make (strFactoryName, NULL);
 }
 
+guint CGstPipelineFactory::GetQueueSize(int bufferingPolicy, bool bVideo)
+{
+    if (bufferingPolicy < 0 || bufferingPolicy >= (int)G_N_ELEMENTS(g_QueueSizes))
+        bufferingPolicy = CPipelineOptions::kBufferingBalanced;
+
+    return g_QueueSizes[bufferingPolicy][bVideo ? 1 : 0];
+}
+
 GstElement* CGstPipelineFactory::GetByFactoryName(GstElement* bin, const char* strFactoryName)
 {
     if (!GST_IS_BIN(bin))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,7 @@ class CGstPipelineFactory : public CPipelineFactory
 public:
     uint32_t           CreatePlayerPipeline(CLocator* locator, CPipelineOptions *pOptions, CPipeline** ppPipeline);
     static GstElement* GetByFactoryName(GstElement* bin, const char* strFactoryName);
+    static guint       GetQueueSize(int bufferingPolicy, bool bVideo);
 
     virtual ~CGstPipelineFactory();
 
@@ -72,8 +73,9 @@ private:
 
 
     uint32_t    CreateAudioBin(const char* strParserName, const char* strDecoderName, bool bConvertFormat,
-                               GstElementContainer* elements, int* pFlags, GstElement** pAudiobin);
-    uint32_t    CreateVideoBin(const char* strDecoderName, GstElement* pVideoSink,
+                               CPipelineOptions* pOptions, GstElementContainer* elements, int* pFlags,
+                               GstElement** pAudiobin);
+    uint32_t    CreateVideoBin(const char* strDecoderName, GstElement* pVideoSink, CPipelineOptions* pOptions,
                                GstElementContainer* elements, GstElement** ppVideobin);
 
     GstElement* CreateElement(const char* strFactoryName);
@@ -83,6 +85,7 @@ private:
 
     // javasource signals
     static gint     SourceReadNextBlock(GstElement *src, gpointer data);
+    static gint     SourceReadNextBlockInto(GstElement *src, gpointer buffer, int size, gpointer data);
     static gint     SourceReadBlock(GstElement *src, guint64 position, guint size, gpointer data);
     static void     SourceCopyBlock(GstElement *src, gpointer buffer, int size, gpointer data);
     static gint64   SourceSeekData(GstElement *src, guint64 offset, gpointer data);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -73,6 +73,214 @@ static GstBuffer *alloc_aligned_buffer(guint size)
     return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, alignedSize, 0, alignedSize, newData, free_aligned_buffer);
 }
 
+static GstBufferPool *create_buffer_pool(guint size)
+{
+    GstBufferPool *pool = gst_buffer_pool_new();
+    GstStructure *config = gst_buffer_pool_get_config(pool);
+    GstAllocationParams params;
+
+    // same 16 byte alignment as alloc_aligned_buffer(), no upper limit on
+    // the number of buffers so that acquiring never blocks
+    gst_allocation_params_init(&params);
+    params.align = 15;
+    gst_buffer_pool_config_set_params(config, NULL, size, 0, 0);
+    gst_buffer_pool_config_set_allocator(config, NULL, &params);
+
+    if (!gst_buffer_pool_set_config(pool, config) ||
+        !gst_buffer_pool_set_active(pool, TRUE)) {
+        gst_object_unref(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+// Frames of at least this many pixels are converted in horizontal stripes,
+// see convert_frame().
+#define CONVERT_STRIPE_MIN_PIXELS   (1920 * 1080)
+#define CONVERT_MAX_THREADS         4
+#define CONVERT_MAX_STRIPES         16
+
+typedef struct _ConvertTask
+{
+    const ColorConvertSource *source;
+    uint8_t *dest;
+    int32_t destStride;
+    int32_t bgra;
+    GMutex lock;
+    GCond done;
+    gint pending;
+    gint status;
+} ConvertTask;
+
+typedef struct _ConvertStripe
+{
+    ConvertTask *task;
+    int32_t firstRow;
+    int32_t rowCount;
+} ConvertStripe;
+
+static GThreadPool *convert_pool = NULL;
+static gint convert_threads = 1;
+
+static void convert_stripe(gpointer data, gpointer user_data)
+{
+    ConvertStripe *stripe = (ConvertStripe*)data;
+    ConvertTask *task = stripe->task;
+    int status = ColorConvert_Rows(task->source, task->dest, task->destStride, task->bgra,
+                                   stripe->firstRow, stripe->rowCount);
+
+    g_mutex_lock(&task->lock);
+    task->status |= status;
+    if (--task->pending == 0) {
+        g_cond_signal(&task->done);
+    }
+    g_mutex_unlock(&task->lock);
+}
+
+// Returns the number of threads converting a large frame, the calling one
+// included. Defaults to one per processor, up to CONVERT_MAX_THREADS; the
+// JFXMEDIA_CONVERT_THREADS environment variable overrides it and 1 turns
+// striping off.
+static gint get_convert_threads()
+{
+    static gsize initialized = 0;
+
+    if (g_once_init_enter(&initialized)) {
+        const gchar *value = g_getenv("JFXMEDIA_CONVERT_THREADS");
+        gint threads = MIN(g_get_num_processors(), CONVERT_MAX_THREADS);
+
+        if (value != NULL) {
+            threads = (gint)CLAMP(g_ascii_strtoll(value, NULL, 10), 1, CONVERT_MAX_STRIPES);
+        }
+        if (threads > 1) {
+            convert_pool = g_thread_pool_new(convert_stripe, NULL, threads - 1, FALSE, NULL);
+            if (convert_pool == NULL) {
+                threads = 1;
+            }
+        }
+        convert_threads = threads;
+        g_once_init_leave(&initialized, 1);
+    }
+    return convert_threads;
+}
+
+// Converts a whole frame with ColorConvert_Rows(). Large frames are split
+// into one stripe per thread; the calling thread converts the first one
+// and waits for the pool to finish the others.
+static int convert_frame(const ColorConvertSource *source, uint8_t *dest, int32_t destStride, int32_t bgra)
+{
+    ConvertStripe stripes[CONVERT_MAX_STRIPES];
+    ConvertTask task;
+    gint threads = get_convert_threads();
+    gint rows, count, i;
+
+    if (threads <= 1 || (gint64)source->width * source->height < CONVERT_STRIPE_MIN_PIXELS) {
+        return ColorConvert_Rows(source, dest, destStride, bgra, 0, source->height);
+    }
+
+    // 4:2:0 stripes have to start on an even row
+    rows = ((source->height + threads - 1) / threads + 1) & ~1;
+    count = (source->height + rows - 1) / rows;
+
+    task.source = source;
+    task.dest = dest;
+    task.destStride = destStride;
+    task.bgra = bgra;
+    g_mutex_init(&task.lock);
+    g_cond_init(&task.done);
+    task.pending = count;
+    task.status = 0;
+
+    for (i = 0; i < count; i++) {
+        stripes[i].task = &task;
+        stripes[i].firstRow = i * rows;
+        stripes[i].rowCount = MIN(rows, source->height - i * rows);
+    }
+    for (i = 1; i < count; i++) {
+        if (!g_thread_pool_push(convert_pool, &stripes[i], NULL)) {
+            convert_stripe(&stripes[i], NULL);
+        }
+    }
+    convert_stripe(&stripes[0], NULL);
+
+    g_mutex_lock(&task.lock);
+    while (task.pending > 0) {
+        g_cond_wait(&task.done, &task.lock);
+    }
+    g_mutex_unlock(&task.lock);
+
+    g_cond_clear(&task.done);
+    g_mutex_clear(&task.lock);
+
+    return task.status;
+}
+
+//*************************************************************************************************
+//********** class CGstVideoBufferPool
+//*************************************************************************************************
+
+CGstVideoBufferPool::CGstVideoBufferPool()
+{
+    m_RefCount = 1;
+    g_mutex_init(&m_Lock);
+    m_pPool = NULL;
+    m_uiSize = 0;
+}
+
+CGstVideoBufferPool::~CGstVideoBufferPool()
+{
+    if (m_pPool != NULL) {
+        // Buffers still in use keep the pool alive and are freed on release.
+        gst_buffer_pool_set_active(m_pPool, FALSE);
+        gst_object_unref(m_pPool);
+    }
+    g_mutex_clear(&m_Lock);
+}
+
+void CGstVideoBufferPool::Ref()
+{
+    g_atomic_int_inc(&m_RefCount);
+}
+
+void CGstVideoBufferPool::Unref()
+{
+    if (g_atomic_int_dec_and_test(&m_RefCount)) {
+        delete this;
+    }
+}
+
+GstBuffer *CGstVideoBufferPool::Acquire(guint size)
+{
+    GstBufferPool *pool = NULL;
+    GstBuffer *buffer = NULL;
+
+    g_mutex_lock(&m_Lock);
+    if (m_pPool == NULL || m_uiSize != size) {
+        if (m_pPool != NULL) {
+            gst_buffer_pool_set_active(m_pPool, FALSE);
+            gst_object_unref(m_pPool);
+        }
+        m_pPool = create_buffer_pool(size);
+        m_uiSize = size;
+    }
+    if (m_pPool != NULL) {
+        pool = (GstBufferPool*)gst_object_ref(m_pPool);
+    }
+    g_mutex_unlock(&m_Lock);
+
+    if (pool != NULL) {
+        if (gst_buffer_pool_acquire_buffer(pool, &buffer, NULL) != GST_FLOW_OK) {
+            buffer = NULL;
+        }
+        gst_object_unref(pool);
+    }
+    return buffer;
+}
+
+//*************************************************************************************************
+//********** class CGstVideoFrame
+//*************************************************************************************************
+
 GstCaps *create_RGB_caps(CVideoFrame::FrameType type, guint width, guint height, guint encodedWidth, guint encodedHeight, guint stride)
 {
     gint red_mask, green_mask, blue_mask, alpha_mask;
@@ -114,6 +322,7 @@ CGstVideoFrame::CGstVideoFrame()
     m_pSample = NULL;
     m_pBuffer = NULL;
     m_bIsI420 = false;
+    m_pConvertPool = NULL;
 }
 
 CGstVideoFrame::~CGstVideoFrame()
@@ -122,12 +331,20 @@ CGstVideoFrame::~CGstVideoFrame()
 
     if (NULL != m_pBuffer)
         Dispose();
+
+    if (NULL != m_pConvertPool)
+        m_pConvertPool->Unref();
 }
 
-bool CGstVideoFrame::Init(GstSample* sample)
+bool CGstVideoFrame::Init(GstSample* sample, CGstVideoBufferPool* pConvertPool)
 {
     LOWLEVELPERF_COUNTERINC("CGstVideoFrame", 1, 1);
 
+    if (pConvertPool != NULL) {
+        pConvertPool->Ref();
+        m_pConvertPool = pConvertPool;
+    }
+
     // Increment the ref count as this object will be created
     // by the video sink and pushed into the FrameQueue.
     m_pSample = gst_sample_ref(sample);
@@ -339,6 +556,24 @@ void CGstVideoFrame::Dispose()
         gst_sample_unref(m_pSample);
         m_pSample = NULL;
     }
+
+    if (m_pConvertPool != NULL) {
+        m_pConvertPool->Unref();
+        m_pConvertPool = NULL;
+    }
+}
+
+GstBuffer *CGstVideoFrame::AllocConvertBuffer(guint size)
+{
+    GstBuffer *buffer = NULL;
+
+    if (m_pConvertPool != NULL) {
+        buffer = m_pConvertPool->Acquire(size);
+    }
+    if (buffer == NULL) {
+        buffer = alloc_aligned_buffer(size);
+    }
+    return buffer;
 }
 
 CVideoFrame *CGstVideoFrame::ConvertToFormat(FrameType type)
@@ -414,7 +649,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
         return NULL;
     }
 
-    destBuffer = alloc_aligned_buffer(alloc_size);
+    destBuffer = AllocConvertBuffer(alloc_size);
     if (!destBuffer) {
         return NULL;
     }
@@ -431,7 +666,21 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
     }
 
     // now do the conversion
-    if (destType == ARGB) {
+    if (!m_bHasAlpha && ((m_uiEncodedWidth | m_uiEncodedHeight) & 1) == 0) {
+        ColorConvertSource source;
+
+        memset(&source, 0, sizeof(source));
+        source.format = COLOR_CONVERT_YCbCr420p;
+        source.width = m_uiEncodedWidth;
+        source.height = m_uiEncodedHeight;
+        source.planes[0] = (const uint8_t*)m_pvPlaneData[0];
+        source.planes[1] = (const uint8_t*)m_pvPlaneData[u_index];
+        source.planes[2] = (const uint8_t*)m_pvPlaneData[v_index];
+        source.strides[0] = m_puiPlaneStrides[0];
+        source.strides[1] = m_puiPlaneStrides[u_index];
+        source.strides[2] = m_puiPlaneStrides[v_index];
+        status = convert_frame(&source, info.data, stride, destType != ARGB);
+    } else if (destType == ARGB) {
         if (m_bHasAlpha) {
             status = ColorConvert_YCbCr420p_to_ARGB32(
                         info.data, stride,
@@ -545,7 +794,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr422(FrameType destType)
         return NULL;
     }
 
-    destBuffer = alloc_aligned_buffer(alloc_size);
+    destBuffer = AllocConvertBuffer(alloc_size);
     if (!destBuffer) {
         return NULL;
     }
@@ -562,21 +811,15 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr422(FrameType destType)
     }
 
     // now do the conversion
-    if (destType == ARGB) {
-        status = ColorConvert_YCbCr422p_to_ARGB32_no_alpha(info.data, stride,
-                                                           m_uiEncodedWidth, m_uiEncodedHeight,
-                                                           (uint8_t*)m_pvPlaneData[0] + 1,
-                                                           (uint8_t*)m_pvPlaneData[0] + 2,
-                                                           (uint8_t*)m_pvPlaneData[0],
-                                                           m_puiPlaneStrides[0], m_puiPlaneStrides[0]);
-    } else {
-        status = ColorConvert_YCbCr422p_to_BGRA32_no_alpha(info.data, stride,
-                                                           m_uiEncodedWidth, m_uiEncodedHeight,
-                                                           (uint8_t*)m_pvPlaneData[0] + 1,
-                                                           (uint8_t*)m_pvPlaneData[0] + 2,
-                                                           (uint8_t*)m_pvPlaneData[0],
-                                                           m_puiPlaneStrides[0], m_puiPlaneStrides[0]);
-    }
+    ColorConvertSource source;
+
+    memset(&source, 0, sizeof(source));
+    source.format = COLOR_CONVERT_UYVY;
+    source.width = m_uiEncodedWidth;
+    source.height = m_uiEncodedHeight;
+    source.planes[0] = (const uint8_t*)m_pvPlaneData[0];
+    source.strides[0] = m_puiPlaneStrides[0];
+    status = convert_frame(&source, info.data, stride, destType != ARGB);
 
     gst_buffer_unmap(destBuffer, &info);
 
@@ -626,7 +869,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertSwapRGB(FrameType destType)
 
     size = gst_buffer_get_size(m_pBuffer);
 
-    destBuffer = alloc_aligned_buffer(size);
+    destBuffer = AllocConvertBuffer(size);
     if (!destBuffer) {
         return NULL;
     }
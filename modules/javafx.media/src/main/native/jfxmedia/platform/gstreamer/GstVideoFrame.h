@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,37 @@
 #define FOURCC_I420 "I420"
 #define FOURCC_UYVY "UYVY"
 
+/**
+ * class CGstVideoBufferPool
+ *
+ * Per-player pool of the 16-byte aligned buffers that frame conversions write
+ * into. A buffer returns to the pool when the last reference to the converted
+ * frame is dropped, so steady playback does not allocate. The pool is
+ * reference counted since converted frames may outlive their pipeline.
+ */
+class CGstVideoBufferPool
+{
+public:
+    CGstVideoBufferPool();
+
+    void Ref();
+    void Unref();
+
+    /*
+     * Returns a buffer of exactly the given size, or NULL. A request for a
+     * new size (after a resolution change) replaces the pooled buffers.
+     */
+    GstBuffer* Acquire(guint size);
+
+private:
+    ~CGstVideoBufferPool();
+
+    volatile gint   m_RefCount;
+    GMutex          m_Lock;
+    GstBufferPool*  m_pPool;
+    guint           m_uiSize;
+};
+
 /**
  * class CGstVideoFrame
  *
@@ -46,9 +77,10 @@ public:
 
     /*
      * Initialize a VideoFrame that wraps the given GstBuffer. The frame caps are
-     * extracted from the buffer itself.
+     * extracted from the buffer itself. Conversions of the frame take their
+     * buffers from pConvertPool if one is given.
      */
-    bool Init(GstSample* sample);
+    bool Init(GstSample* sample, CGstVideoBufferPool* pConvertPool = NULL);
 
     virtual void Dispose();
 
@@ -69,7 +101,9 @@ private:
     void*       m_pvBufferBaseAddress;
     unsigned long m_ulBufferSize;
     bool        m_bIsI420;
+    CGstVideoBufferPool* m_pConvertPool;
 
+    GstBuffer *AllocConvertBuffer(guint size);
     CGstVideoFrame *ConvertSwapRGB(FrameType destType);
     CGstVideoFrame *ConvertFromYCbCr420p(FrameType destType);
     CGstVideoFrame *ConvertFromYCbCr422(FrameType destType);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -139,5 +139,6 @@
 #define    WARNING_GSTREAMER_INVALID_FRAME    8388614
 #define    WARNING_GSTREAMER_PIPELINE_INFO_ERROR    8388615
 #define    WARNING_GSTREAMER_AUDIO_BUFFER_FIELD    8388616
+#define    WARNING_GSTREAMER_QUEUE_UNDERRUN    8388617
 
 #endif // _JFXMEDIA_ERRORS_H_
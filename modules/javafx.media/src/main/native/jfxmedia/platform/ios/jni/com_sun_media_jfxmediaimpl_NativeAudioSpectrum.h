@@ -26,10 +26,10 @@ extern "C" {
     /*
      * Class:     com_sun_media_jfxmediaimpl_NativeAudioSpectrum
      * Method:    nativeSetBands
-     * Signature: (JI[F[F)V
+     * Signature: (JILjava/nio/FloatBuffer;)V
      */
     JNIEXPORT void JNICALL Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeSetBands
-    (JNIEnv *, jobject, jlong, jint, jfloatArray, jfloatArray);
+    (JNIEnv *, jobject, jlong, jint, jobject);
 
     /*
      * Class:     com_sun_media_jfxmediaimpl_NativeAudioSpectrum
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,10 +49,10 @@ extern "C" {
     /*
      * Class:     com_sun_media_jfxmediaimpl_NativeAudioSpectrum
      * Method:    nativeSetBands
-     * Signature: (JI[F[F)V
+     * Signature: (JILjava/nio/FloatBuffer;)V
      */
     JNIEXPORT void JNICALL Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeSetBands
-    (JNIEnv *env, jobject obj, jlong jl, jint ji, jfloatArray jfa1, jfloatArray jfa2);
+    (JNIEnv *env, jobject obj, jlong jl, jint ji, jobject jo);
 
     /*
      * Class:     com_sun_media_jfxmediaimpl_NativeAudioSpectrum
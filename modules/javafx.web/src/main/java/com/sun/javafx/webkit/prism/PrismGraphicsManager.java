@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import com.sun.glass.ui.Screen;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.media.jfxmedia.MediaManager;
 import com.sun.prism.Graphics;
+import com.sun.prism.GraphicsPipeline;
 import com.sun.webkit.perf.WCFontPerfLogger;
 import com.sun.webkit.perf.WCGraphicsPerfLogger;
 import com.sun.webkit.graphics.*;
@@ -85,6 +86,10 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         return WCFontPerfLogger.isEnabled() && (f != null) ? new WCFontPerfLogger(f) : f;
     }
 
+    @Override protected String[] getFontFamilyNames() {
+        return GraphicsPipeline.getPipeline().getFontFactory().getFontFamilyNames();
+    }
+
     @Override
     protected WCFontCustomPlatformData createFontCustomPlatformData(
             InputStream inputStream) throws IOException
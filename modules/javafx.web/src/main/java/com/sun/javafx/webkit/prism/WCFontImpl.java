@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,18 +26,20 @@
 package com.sun.javafx.webkit.prism;
 
 import com.sun.javafx.font.CharToGlyphMapper;
+import com.sun.javafx.font.CompositeFontResource;
 import com.sun.javafx.font.FontFactory;
 import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrike;
+import com.sun.javafx.font.Metrics;
 import com.sun.javafx.font.PGFont;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.scene.text.GlyphList;
 import com.sun.javafx.scene.text.TextLayout;
+import com.sun.javafx.text.TextRun;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.webkit.graphics.WCFont;
-import com.sun.webkit.graphics.WCTextRun;
-import java.util.Arrays;
 import java.util.HashMap;
 
 final class WCFontImpl extends WCFont {
@@ -140,6 +142,31 @@ final class WCFontImpl extends WCFont {
         return glyphs;
     }
 
+    @Override public WCFont getFallbackFont(int codePoint) {
+        FontResource fr = font.getFontResource();
+        int glyph = fr.getGlyphMapper().charToGlyph(codePoint);
+        if (glyph == CharToGlyphMapper.MISSING_GLYPH) {
+            return null;
+        }
+        // Glyph codes of a composite font carry the slot of the physical
+        // font that has the glyph in the top byte.
+        int slot = glyph >>> 24;
+        if (slot == 0 || !(fr instanceof CompositeFontResource)) {
+            return this;
+        }
+        FontResource slotResource = ((CompositeFontResource) fr).getSlotResource(slot);
+        if (slotResource == null) {
+            return null;
+        }
+        FontFactory factory = GraphicsPipeline.getPipeline().getFontFactory();
+        PGFont fallback = factory.createFont(slotResource.getFullName(), font.getSize());
+        if (log.isLoggable(Level.FINE)) {
+            log.fine(String.format("fallback for U+%04X in %s = %s",
+                    codePoint, font.getFullName(), fallback.getFullName()));
+        }
+        return new WCFontImpl(fallback);
+    }
+
     @Override
     public float getAscent() {
         // REMIND: This method needs to require a render context.
@@ -202,15 +229,55 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getMetrics().getCapHeight();
     }
 
+    @Override public float[] getFontMetrics() {
+        Metrics metrics = getFontStrike().getMetrics();
+        float[] res = new float[FONT_METRICS_SIZE];
+        res[FONT_METRICS_X_HEIGHT] = metrics.getXHeight();
+        res[FONT_METRICS_CAP_HEIGHT] = metrics.getCapHeight();
+        res[FONT_METRICS_ASCENT] = - metrics.getAscent();
+        res[FONT_METRICS_DESCENT] = metrics.getDescent();
+        res[FONT_METRICS_LINE_SPACING] = metrics.getLineHeight();
+        res[FONT_METRICS_LINE_GAP] = metrics.getLineGap();
+        return res;
+    }
+
     @Override
-    public WCTextRun[] getTextRuns(final String str) {
+    public int[] getTextRunData(final String str) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format("str='%s' length=%d", str, str.length()));
         }
 
         final TextLayout layout = TextUtilities.createLayout(str, getPlatformFont());
-        return Arrays.stream(layout.getRuns())
-                     .map(WCTextRunImpl::new)
-                     .toArray(WCTextRunImpl[]::new);
+        final GlyphList[] runs = layout.getRuns();
+        int size = 1;
+        for (GlyphList run : runs) {
+            size += TEXT_RUN_HEADER_SIZE + run.getGlyphCount() * TEXT_RUN_GLYPH_SIZE;
+        }
+
+        final int[] data = new int[size];
+        data[0] = runs.length;
+        int offset = 1;
+        for (GlyphList glyphList : runs) {
+            final TextRun run = (TextRun) glyphList;
+            final int glyphCount = run.getGlyphCount();
+            data[offset + TEXT_RUN_FLAGS] = run.isLeftToRight() ? TEXT_RUN_FLAG_LTR : 0;
+            data[offset + TEXT_RUN_START] = run.getStart();
+            data[offset + TEXT_RUN_END] = run.getEnd();
+            data[offset + TEXT_RUN_GLYPH_COUNT] = glyphCount;
+            if (glyphCount > 0) {
+                // There is no initial advance in the Prism layout; the
+                // position of the first glyph is used instead.
+                data[offset + TEXT_RUN_INITIAL_ADVANCE_X] = Float.floatToRawIntBits(run.getPosX(0));
+                data[offset + TEXT_RUN_INITIAL_ADVANCE_Y] = Float.floatToRawIntBits(run.getPosY(0));
+            }
+            offset += TEXT_RUN_HEADER_SIZE;
+            for (int i = 0; i < glyphCount; i++) {
+                data[offset + TEXT_RUN_GLYPH_CODE] = run.getGlyphCode(i);
+                data[offset + TEXT_RUN_GLYPH_CHAR_OFFSET] = run.getCharOffset(i);
+                data[offset + TEXT_RUN_GLYPH_ADVANCE] = Float.floatToRawIntBits(run.getAdvance(i));
+                offset += TEXT_RUN_GLYPH_SIZE;
+            }
+        }
+        return data;
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,10 +37,11 @@ import com.sun.webkit.graphics.WCGraphicsManager;
 import com.sun.webkit.graphics.WCImage;
 import com.sun.webkit.graphics.WCImageDecoder;
 import com.sun.webkit.graphics.WCImageFrame;
-import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
+import java.nio.ByteBuffer;
 import java.util.Arrays;
+import java.util.Objects;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
@@ -57,8 +58,9 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     private boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
     private PrismImage[] images;
-    private volatile byte[] data;
-    private volatile int dataSize = 0;
+    // Direct buffers over the native memory of the received data, no copy
+    // is made; they must not be accessed after destroy().
+    private volatile ByteBuffer[] data;
     private String fileNameExtension;
 
     static {
@@ -80,6 +82,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         frames = null;
         images = null;
         framesDecoded = false;
+        data = null;
     }
 
     @Override protected String getFilenameExtension() {
@@ -90,19 +93,15 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    @Override protected void addImageData(ByteBuffer dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
             if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
+                data = new ByteBuffer[] { dataPortion };
             } else {
-                int newDataSize = dataSize + dataPortion.length;
-                if (newDataSize > data.length) {
-                    resizeDataArray(Math.max(newDataSize, data.length * 2));
-                }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
-                dataSize = newDataSize;
+                ByteBuffer[] newData = Arrays.copyOf(data, data.length + 1);
+                newData[data.length] = dataPortion;
+                data = newData;
             }
             // Try to decode the partial data until we get image size.
             if (!imageSizeAvilable()) {
@@ -110,9 +109,6 @@ final class WCImageDecoderImpl extends WCImageDecoder {
             }
         } else if (data != null && !fullDataReceived) {
             // null dataPortion means data completion
-            if (data.length > dataSize) {
-                resizeDataArray(dataSize);
-            }
             fullDataReceived = true;
         }
     }
@@ -148,12 +144,6 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
     }
 
-    private void resizeDataArray(int newDataSize) {
-        byte[] newData = new byte[newDataSize];
-        System.arraycopy(data, 0, newData, 0, dataSize);
-        data = newData;
-    }
-
     @Override protected void loadFromResource(String name) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format(
@@ -190,8 +180,75 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
     }
 
-    private ImageFrame[] loadFrames() {
-        return loadFrames(new ByteArrayInputStream(this.data, 0, this.dataSize));
+    // Synchronized with destroy(), which frees the memory behind the buffers.
+    private synchronized ImageFrame[] loadFrames() {
+        final ByteBuffer[] buffers = this.data;
+        if (buffers == null) {
+            return null;
+        }
+        return loadFrames(new ByteBufferInputStream(buffers));
+    }
+
+    /**
+     * Reads the data portions in sequence, without copying them.
+     */
+    private static final class ByteBufferInputStream extends InputStream {
+        private final ByteBuffer[] buffers;
+        private int current = 0;
+
+        private ByteBufferInputStream(ByteBuffer[] buffers) {
+            this.buffers = new ByteBuffer[buffers.length];
+            for (int i = 0; i < buffers.length; i++) {
+                // independent positions, the buffers are shared by all streams
+                this.buffers[i] = buffers[i].duplicate();
+            }
+        }
+
+        private ByteBuffer nextBuffer() {
+            while (current < buffers.length && !buffers[current].hasRemaining()) {
+                current++;
+            }
+            return current < buffers.length ? buffers[current] : null;
+        }
+
+        @Override public int read() {
+            ByteBuffer buffer = nextBuffer();
+            return buffer == null ? -1 : buffer.get() & 0xff;
+        }
+
+        @Override public int read(byte[] b, int off, int len) {
+            Objects.checkFromIndexSize(off, len, b.length);
+            if (len == 0) {
+                return 0;
+            }
+            int count = 0;
+            ByteBuffer buffer;
+            while (count < len && (buffer = nextBuffer()) != null) {
+                int n = Math.min(len - count, buffer.remaining());
+                buffer.get(b, off + count, n);
+                count += n;
+            }
+            return count == 0 ? -1 : count;
+        }
+
+        @Override public long skip(long n) {
+            long skipped = 0;
+            ByteBuffer buffer;
+            while (skipped < n && (buffer = nextBuffer()) != null) {
+                int k = (int) Math.min(n - skipped, buffer.remaining());
+                buffer.position(buffer.position() + k);
+                skipped += k;
+            }
+            return skipped;
+        }
+
+        @Override public int available() {
+            long remaining = 0;
+            for (int i = current; i < buffers.length; i++) {
+                remaining += buffers[i].remaining();
+            }
+            return (int) Math.min(remaining, Integer.MAX_VALUE);
+        }
     }
 
     private final ImageLoadListener readerListener = new ImageLoadListener() {
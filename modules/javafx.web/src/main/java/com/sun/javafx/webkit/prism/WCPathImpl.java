@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,8 @@ import com.sun.webkit.graphics.WCRectangle;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.prism.BasicStroke;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.Arrays;
 
 final class WCPathImpl extends WCPath<Path2D> {
@@ -243,6 +245,53 @@ final class WCPathImpl extends WCPath<Path2D> {
         path.append(((WCPathImpl)p).path, false);
     }
 
+    @Override
+    public void addSegments(ByteBuffer segments) {
+        segments.order(ByteOrder.nativeOrder());
+        final int verbCount = segments.getInt(0);
+        final int coordCount = segments.getInt(4);
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("WCPathImpl({0}).addSegments({1},{2})",
+                    new Object[] {getID(), verbCount, coordCount});
+        }
+        final int verbOffset = 8;
+        int coordOffset = (verbOffset + verbCount + 3) & ~3;
+        for (int i = 0; i < verbCount; i++) {
+            switch (segments.get(verbOffset + i)) {
+                case WCPathIterator.SEG_MOVETO:
+                    path.moveTo(segments.getFloat(coordOffset),
+                                segments.getFloat(coordOffset + 4));
+                    coordOffset += 8;
+                    break;
+                case WCPathIterator.SEG_LINETO:
+                    path.lineTo(segments.getFloat(coordOffset),
+                                segments.getFloat(coordOffset + 4));
+                    coordOffset += 8;
+                    break;
+                case WCPathIterator.SEG_QUADTO:
+                    path.quadTo(segments.getFloat(coordOffset),
+                                segments.getFloat(coordOffset + 4),
+                                segments.getFloat(coordOffset + 8),
+                                segments.getFloat(coordOffset + 12));
+                    coordOffset += 16;
+                    break;
+                case WCPathIterator.SEG_CUBICTO:
+                    path.curveTo(segments.getFloat(coordOffset),
+                                 segments.getFloat(coordOffset + 4),
+                                 segments.getFloat(coordOffset + 8),
+                                 segments.getFloat(coordOffset + 12),
+                                 segments.getFloat(coordOffset + 16),
+                                 segments.getFloat(coordOffset + 20));
+                    coordOffset += 24;
+                    break;
+                case WCPathIterator.SEG_CLOSE:
+                    path.closePath();
+                    continue;
+            }
+            hasCP = true;
+        }
+    }
+
     @Override
     public void closeSubpath() {
         if (log.isLoggable(Level.FINE)) {
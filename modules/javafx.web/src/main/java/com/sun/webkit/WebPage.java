@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -130,6 +130,11 @@ public final class WebPage {
     // Accessed on: Event thread only.
     private RenderFrame currentFrame = new RenderFrame();
 
+    // The rendering statistics of the last frame generated by updateDirty().
+    // Written on: Event thread only.
+    private volatile WCRenderQueue.Statistics frameStatistics =
+            WCRenderQueue.Statistics.EMPTY;
+
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
 
@@ -322,6 +327,7 @@ public final class WebPage {
         }
         List<WCRectangle> oldDirtyRects = dirtyRects;
         dirtyRects = new LinkedList<>();
+        WCRenderQueue.Statistics stats = WCRenderQueue.Statistics.EMPTY;
         twkPrePaint(getPage());
         while (!oldDirtyRects.isEmpty()) {
             WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
@@ -333,6 +339,7 @@ public final class WebPage {
                     .createRenderQueue(r, true);
             twkUpdateContent(getPage(), rq, r.getIntX() - 1, r.getIntY() - 1,
                              r.getIntWidth() + 2, r.getIntHeight() + 2);
+            stats = stats.add(rq.getStatistics());
             currentFrame.addRenderQueue(rq);
         }
         {
@@ -341,8 +348,10 @@ public final class WebPage {
             twkPostPaint(getPage(), rq,
                          clip.getIntX(), clip.getIntY(),
                          clip.getIntWidth(), clip.getIntHeight());
+            stats = stats.add(rq.getStatistics());
             currentFrame.addRenderQueue(rq);
         }
+        frameStatistics = stats;
 
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Dirty rects processed, dirtyRects: {0}, currentFrame: {1}",
@@ -681,6 +690,14 @@ public final class WebPage {
         twkUpdateRendering(getPage());
     }
 
+    /**
+     * Returns the number of rendering commands, bytes and buffers encoded
+     * by the last update of the page content, and the time it took.
+     */
+    public WCRenderQueue.Statistics getFrameStatistics() {
+        return frameStatistics;
+    }
+
     public int getUpdateContentCycleID() {
         return updateContentCycleID;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,66 @@
 
 package com.sun.webkit.graphics;
 
+import java.lang.annotation.Native;
+
 public abstract class WCFont extends Ref {
 
+    // Layout of the array returned by getTextRunData(). The array starts
+    // with the number of runs, followed by each run: a header of
+    // TEXT_RUN_HEADER_SIZE ints, then TEXT_RUN_GLYPH_SIZE ints per glyph.
+    // Float values are stored as Float.floatToRawIntBits().
+    @Native public final static int TEXT_RUN_FLAGS = 0;
+    @Native public final static int TEXT_RUN_START = 1;
+    @Native public final static int TEXT_RUN_END = 2;
+    @Native public final static int TEXT_RUN_GLYPH_COUNT = 3;
+    @Native public final static int TEXT_RUN_INITIAL_ADVANCE_X = 4;
+    @Native public final static int TEXT_RUN_INITIAL_ADVANCE_Y = 5;
+    @Native public final static int TEXT_RUN_HEADER_SIZE = 6;
+
+    @Native public final static int TEXT_RUN_GLYPH_CODE = 0;
+    @Native public final static int TEXT_RUN_GLYPH_CHAR_OFFSET = 1;
+    @Native public final static int TEXT_RUN_GLYPH_ADVANCE = 2;
+    @Native public final static int TEXT_RUN_GLYPH_SIZE = 3;
+
+    @Native public final static int TEXT_RUN_FLAG_LTR = 1;
+
+    // Layout of the array returned by getFontMetrics()
+    @Native public final static int FONT_METRICS_X_HEIGHT = 0;
+    @Native public final static int FONT_METRICS_CAP_HEIGHT = 1;
+    @Native public final static int FONT_METRICS_ASCENT = 2;
+    @Native public final static int FONT_METRICS_DESCENT = 3;
+    @Native public final static int FONT_METRICS_LINE_SPACING = 4;
+    @Native public final static int FONT_METRICS_LINE_GAP = 5;
+    @Native public final static int FONT_METRICS_SIZE = 6;
+
     public abstract Object getPlatformFont();
 
     public abstract WCFont deriveFont(float size);
 
-    public abstract WCTextRun[] getTextRuns(String str);
+    /**
+     * Lays out the string and returns the glyphs, advances and character
+     * offsets of all resulting runs packed into a single array, so that
+     * native code can fetch a whole line with one call.
+     * NB: This method is called from native code!
+     *
+     * @param str the text to lay out
+     * @return the packed runs, or {@code null} if the layout failed
+     */
+    public abstract int[] getTextRunData(String str);
 
     public abstract int[] getGlyphCodes(char[] chars);
 
+    /**
+     * Returns a font that can display the given code point, chosen from the
+     * fallback fonts of this font.
+     * NB: This method is called from native code!
+     *
+     * @param codePoint the code point to display
+     * @return the fallback font, or {@code null} if no font has a glyph for
+     *  the code point
+     */
+    public abstract WCFont getFallbackFont(int codePoint);
+
     public abstract float getXHeight();
 
     public abstract double getGlyphWidth(int glyph);
@@ -88,4 +138,21 @@ public abstract class WCFont extends Ref {
     public abstract boolean hasUniformLineMetrics();
 
     public abstract float getCapHeight();
+
+    /**
+     * Returns all font metrics, indexed by the FONT_METRICS_* constants.
+     * NB: This method is called from native code!
+     *
+     * @return the metrics of this font
+     */
+    public float[] getFontMetrics() {
+        float[] metrics = new float[FONT_METRICS_SIZE];
+        metrics[FONT_METRICS_X_HEIGHT] = getXHeight();
+        metrics[FONT_METRICS_CAP_HEIGHT] = getCapHeight();
+        metrics[FONT_METRICS_ASCENT] = getAscent();
+        metrics[FONT_METRICS_DESCENT] = getDescent();
+        metrics[FONT_METRICS_LINE_SPACING] = getLineSpacing();
+        metrics[FONT_METRICS_LINE_GAP] = getLineGap();
+        return metrics;
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -71,6 +71,8 @@ public abstract class WCGraphicsManager {
 
     protected abstract WCFont getWCFont(String name, boolean bold, boolean italic, float size);
 
+    protected abstract String[] getFontFamilyNames();
+
     private WCFontCustomPlatformData fwkCreateFontCustomPlatformData(
             SharedBuffer sharedBuffer)
     {
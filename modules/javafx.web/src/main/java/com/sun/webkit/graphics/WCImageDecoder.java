@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,19 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
 
 public abstract class WCImageDecoder {
 
     /**
      * Receives a portion of image data.
+     * The buffer is a direct buffer over native memory owned by the
+     * native decoder, it remains valid until {@link #destroy()} returns.
      *
      * @param data  a portion of image data,
      *              or {@code null} if all data received
      */
-    protected abstract void addImageData(byte[] data);
+    protected abstract void addImageData(ByteBuffer data);
 
     /**
      * Returns image size.
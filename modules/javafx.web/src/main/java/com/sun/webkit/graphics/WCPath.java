@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.webkit.graphics;
 
 import java.lang.annotation.Native;
+import java.nio.ByteBuffer;
 
 public abstract class WCPath<P> extends Ref {
 
@@ -80,6 +81,15 @@ public abstract class WCPath<P> extends Ref {
 
     public abstract void addPath(WCPath path);
 
+    /**
+     * Appends segments recorded by the native path. The buffer holds, in native
+     * byte order, the number of verbs and the number of coordinates as ints,
+     * the verbs ({@code WCPathIterator.SEG_*} constants) as bytes padded to a
+     * multiple of 4, and the coordinates as floats. The buffer is only valid
+     * for the duration of the call.
+     */
+    public abstract void addSegments(ByteBuffer segments);
+
     public abstract void closeSubpath();
 
     public abstract boolean isEmpty();
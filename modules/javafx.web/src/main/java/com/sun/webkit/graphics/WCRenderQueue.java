@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,7 @@ public abstract class WCRenderQueue extends Ref {
     private final WCRectangle clip;
     private int size = 0;
     private final boolean opaque;
+    private Statistics statistics = Statistics.EMPTY;
 
     // Associated graphics context (currently used to draw to a buffered image).
     protected final WCGraphicsContext gc;
@@ -82,10 +83,36 @@ public abstract class WCRenderQueue extends Ref {
         }
     }
 
+    /**
+     * Adds the buffers encoded during one paint. All of them share the
+     * strings and arrays referenced so far.
+     */
+    public synchronized void addBuffers(ByteBuffer[] frameBuffers) {
+        if (log.isLoggable(Level.FINE) && buffers.isEmpty()) {
+            log.fine("'{'WCRenderQueue{0}[{1}]",
+                    new Object[]{hashCode(), idCountObj.incrementAndGet()});
+        }
+        for (ByteBuffer buffer : frameBuffers) {
+            buffers.addLast(new BufferData(currentBuffer, buffer));
+            size += buffer.capacity();
+        }
+        currentBuffer = new BufferData();
+        if (size > MAX_QUEUE_SIZE && gc!=null) {
+            flush();
+        }
+    }
+
     public synchronized boolean isEmpty() {
         return buffers.isEmpty();
     }
 
+    /**
+     * Returns the statistics of the last frame committed to this queue.
+     */
+    public synchronized Statistics getStatistics() {
+        return statistics;
+    }
+
     public synchronized void decode(WCGraphicsContext gc) {
         if (gc == null || !gc.isValid()) {
             log.fine("WCRenderQueue::decode : GC is " + (gc == null ? "null" : " invalid"));
@@ -131,6 +158,16 @@ public abstract class WCRenderQueue extends Ref {
         addBuffer(buffer);
     }
 
+    private void fwkAddBuffers(ByteBuffer[] frameBuffers,
+                               int commands, int bytes, long encodeNanos)
+    {
+        addBuffers(frameBuffers);
+        synchronized (this) {
+            statistics = new Statistics(
+                    commands, bytes, frameBuffers.length, encodeNanos);
+        }
+    }
+
     public WCRectangle getClip() {
         return clip;
     }
@@ -189,20 +226,84 @@ public abstract class WCRenderQueue extends Ref {
                 + "opaque=" + opaque
                 + "}";
     }
+
+    /**
+     * Counters of the rendering commands encoded during a frame.
+     */
+    public static final class Statistics {
+        public static final Statistics EMPTY = new Statistics(0, 0, 0, 0);
+
+        private final int commands;
+        private final int bytes;
+        private final int buffers;
+        private final long encodeNanos;
+
+        public Statistics(int commands, int bytes, int buffers, long encodeNanos) {
+            this.commands = commands;
+            this.bytes = bytes;
+            this.buffers = buffers;
+            this.encodeNanos = encodeNanos;
+        }
+
+        public int getCommands() {
+            return commands;
+        }
+
+        public int getBytes() {
+            return bytes;
+        }
+
+        public int getBuffers() {
+            return buffers;
+        }
+
+        public long getEncodeNanos() {
+            return encodeNanos;
+        }
+
+        public Statistics add(Statistics other) {
+            return new Statistics(commands + other.commands,
+                                  bytes + other.bytes,
+                                  buffers + other.buffers,
+                                  encodeNanos + other.encodeNanos);
+        }
+
+        @Override public String toString() {
+            return "Statistics{"
+                    + "commands=" + commands + ", "
+                    + "bytes=" + bytes + ", "
+                    + "buffers=" + buffers + ", "
+                    + "encodeNanos=" + encodeNanos
+                    + "}";
+        }
+    }
 }
 
 final class BufferData {
     /* For passing data that does not fit into the queue */
-    private final AtomicInteger idCount = new AtomicInteger(0);
-    private final HashMap<Integer,String> strMap =
-            new HashMap<>();
-    private final HashMap<Integer,int[]> intArrMap =
-            new HashMap<>();
-    private final HashMap<Integer,float[]> floatArrMap =
-            new HashMap<>();
+    private final AtomicInteger idCount;
+    private final HashMap<Integer,String> strMap;
+    private final HashMap<Integer,int[]> intArrMap;
+    private final HashMap<Integer,float[]> floatArrMap;
 
     private ByteBuffer buffer;
 
+    BufferData() {
+        this.idCount = new AtomicInteger(0);
+        this.strMap = new HashMap<>();
+        this.intArrMap = new HashMap<>();
+        this.floatArrMap = new HashMap<>();
+    }
+
+    /* Shares the referenced data of another buffer of the same frame */
+    BufferData(BufferData refs, ByteBuffer buffer) {
+        this.idCount = refs.idCount;
+        this.strMap = refs.strMap;
+        this.intArrMap = refs.intArrMap;
+        this.floatArrMap = refs.floatArrMap;
+        this.buffer = buffer;
+    }
+
     private int createID() {
         return idCount.incrementAndGet();
     }
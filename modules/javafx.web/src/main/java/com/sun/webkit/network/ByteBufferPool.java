@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import java.nio.ByteBuffer;
 import java.util.Queue;
 import java.util.concurrent.ConcurrentLinkedQueue;
 import java.util.concurrent.Semaphore;
+import java.util.concurrent.atomic.AtomicInteger;
 
 /**
  * A pool of byte buffers that can be shared by multiple concurrent
@@ -42,6 +43,17 @@ final class ByteBufferPool {
     private final Queue<ByteBuffer> byteBuffers =
             new ConcurrentLinkedQueue<>();
 
+    /**
+     * The number of byte buffers in the shared collection.
+     */
+    private final AtomicInteger pooledCount = new AtomicInteger();
+
+    /**
+     * The maximum number of byte buffers kept in the shared collection.
+     * Buffers recycled beyond this limit are left to the garbage collector.
+     */
+    private static final int MAX_POOLED_COUNT = 64;
+
     /**
      * The size of each byte buffer.
      */
@@ -63,6 +75,20 @@ final class ByteBufferPool {
         return new ByteBufferPool(bufferSize);
     }
 
+    /**
+     * Returns a byte buffer detached from its allocator to this pool.
+     * Called by the native code when it no longer uses the buffer content,
+     * possibly long after the load that filled the buffer has completed.
+     */
+    void recycle(ByteBuffer byteBuffer) {
+        if (pooledCount.incrementAndGet() <= MAX_POOLED_COUNT) {
+            byteBuffer.clear();
+            byteBuffers.add(byteBuffer);
+        } else {
+            pooledCount.decrementAndGet();
+        }
+    }
+
     /**
      * Creates a new allocator associated with this pool.
      * The allocator will allow its client to allocate and release
@@ -103,6 +129,8 @@ final class ByteBufferPool {
             ByteBuffer byteBuffer = byteBuffers.poll();
             if (byteBuffer == null) {
                 byteBuffer = ByteBuffer.allocateDirect(bufferSize);
+            } else {
+                pooledCount.decrementAndGet();
             }
             return byteBuffer;
         }
@@ -112,8 +140,15 @@ final class ByteBufferPool {
          */
         @Override
         public void release(ByteBuffer byteBuffer) {
-            byteBuffer.clear();
-            byteBuffers.add(byteBuffer);
+            recycle(byteBuffer);
+            semaphore.release();
+        }
+
+        /**
+         * {@inheritDoc}
+         */
+        @Override
+        public void detach(ByteBuffer byteBuffer) {
             semaphore.release();
         }
     }
@@ -133,4 +168,11 @@ interface ByteBufferAllocator {
      * Releases a byte buffer.
      */
     void release(ByteBuffer byteBuffer);
+
+    /**
+     * Stops counting a byte buffer against this allocator without
+     * returning it to the pool. The buffer is returned later through
+     * {@link ByteBufferPool#recycle}.
+     */
+    void detach(ByteBuffer byteBuffer);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -87,6 +87,9 @@ final class HTTP2Loader extends URLLoaderBase {
     private FormDataElement[] formDataElements;
     private final long data;
     private volatile boolean canceled = false;
+    // Accessed on the event thread only
+    private long bytesReceived;
+    private long bytesCopied;
 
     private final CompletableFuture<Void> response;
     // Use singleton instance of HttpClient to get the maximum benefits
@@ -551,7 +554,24 @@ final class HTTP2Loader extends URLLoaderBase {
                     byteBuffer.remaining(),
                     data));
         }
-        twkDidReceiveData(byteBuffer, byteBuffer.position(), byteBuffer.remaining(), data);
+        // The response body arrives in buffers owned by the HTTP client and
+        // is staged in a shared direct buffer, so it is always copied.
+        int remaining = byteBuffer.remaining();
+        twkDidReceiveData(byteBuffer, byteBuffer.position(), remaining, null, data);
+        bytesReceived += remaining;
+        bytesCopied += 2L * remaining;
+    }
+
+    private void logDataCounters() {
+        if (logger.isLoggable(Level.FINE)) {
+            logger.fine(String.format(
+                    "url: [%s], "
+                    + "bytesReceived: [%d], "
+                    + "bytesCopied: [%d]",
+                    url,
+                    bytesReceived,
+                    bytesCopied));
+        }
     }
 
     private void didFinishLoading() {
@@ -563,6 +583,7 @@ final class HTTP2Loader extends URLLoaderBase {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format("data: [0x%016X]", data));
         }
+        logDataCounters();
         twkDidFinishLoading(data);
     }
 
@@ -613,6 +634,7 @@ final class HTTP2Loader extends URLLoaderBase {
                     message,
                     data));
         }
+        logDataCounters();
         twkDidFail(errorCode, url, message, data);
     }
 
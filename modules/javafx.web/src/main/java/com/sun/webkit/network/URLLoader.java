@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -83,6 +83,9 @@ final class URLLoader extends URLLoaderBase implements Runnable {
     private FormDataElement[] formDataElements;
     private final long data;
     private volatile boolean canceled = false;
+    // Accessed from the callbacks only
+    private long bytesReceived;
+    private long bytesCopied;
 
 
     /**
@@ -733,19 +736,24 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                                 final ByteBufferAllocator allocator)
     {
         callBack(() -> {
+            boolean adopted = false;
             if (!canceled) {
-                notifyDidReceiveData(
+                adopted = notifyDidReceiveData(
                         byteBuffer,
                         byteBuffer.position(),
                         byteBuffer.remaining());
             }
-            allocator.release(byteBuffer);
+            if (adopted) {
+                allocator.detach(byteBuffer);
+            } else {
+                allocator.release(byteBuffer);
+            }
         });
     }
 
-    private void notifyDidReceiveData(ByteBuffer byteBuffer,
-                                      int position,
-                                      int remaining)
+    private boolean notifyDidReceiveData(ByteBuffer byteBuffer,
+                                         int position,
+                                         int remaining)
     {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format(
@@ -758,7 +766,25 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                     remaining,
                     data));
         }
-        twkDidReceiveData(byteBuffer, position, remaining, data);
+        boolean adopted = twkDidReceiveData(byteBuffer, position, remaining,
+                                            byteBufferPool, data);
+        bytesReceived += remaining;
+        if (!adopted) {
+            bytesCopied += remaining;
+        }
+        return adopted;
+    }
+
+    private void logDataCounters() {
+        if (logger.isLoggable(Level.FINE)) {
+            logger.fine(String.format(
+                    "url: [%s], "
+                    + "bytesReceived: [%d], "
+                    + "bytesCopied: [%d]",
+                    url,
+                    bytesReceived,
+                    bytesCopied));
+        }
     }
 
     private void didFinishLoading() {
@@ -773,6 +799,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format("data: [0x%016X]", data));
         }
+        logDataCounters();
         twkDidFinishLoading(data);
     }
 
@@ -797,6 +824,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                     message,
                     data));
         }
+        logDataCounters();
         twkDidFail(errorCode, url, message, data);
     }
 
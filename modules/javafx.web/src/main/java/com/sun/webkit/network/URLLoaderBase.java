@@ -56,9 +56,16 @@ abstract class URLLoaderBase {
                                                      String url,
                                                      long data);
 
-    protected static native void twkDidReceiveData(ByteBuffer byteBuffer,
+    /**
+     * Passes received data to WebCore. If {@code pool} is not null, WebCore
+     * may keep using the buffer instead of copying it, in which case this
+     * method returns {@code true} and the buffer is later handed back to
+     * {@link ByteBufferPool#recycle}.
+     */
+    protected static native boolean twkDidReceiveData(ByteBuffer byteBuffer,
                                                  int position,
                                                  int remaining,
+                                                 ByteBufferPool pool,
                                                  long data);
 
     protected static native void twkDidFinishLoading(long data);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,7 +27,6 @@ package com.sun.webkit.perf;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.graphics.WCFont;
-import com.sun.webkit.graphics.WCTextRun;
 
 public final class WCFontPerfLogger extends WCFont {
     private static final PlatformLogger log =
@@ -67,11 +66,11 @@ public final class WCFontPerfLogger extends WCFont {
     }
 
     @Override
-    public WCTextRun[] getTextRuns(String str) {
-        logger.resumeCount("GETTEXTRUNS");
-        final WCTextRun runs[] = fnt.getTextRuns(str);
-        logger.suspendCount("GETTEXTRUNS");
-        return runs;
+    public int[] getTextRunData(String str) {
+        logger.resumeCount("GETTEXTRUNDATA");
+        int[] res = fnt.getTextRunData(str);
+        logger.suspendCount("GETTEXTRUNDATA");
+        return res;
     }
 
     @Override
@@ -82,6 +81,14 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    @Override
+    public WCFont getFallbackFont(int codePoint) {
+        logger.resumeCount("GETFALLBACKFONT");
+        WCFont res = fnt.getFallbackFont(codePoint);
+        logger.suspendCount("GETFALLBACKFONT");
+        return (res != null) ? new WCFontPerfLogger(res) : null;
+    }
+
     @Override
     public float getXHeight() {
         logger.resumeCount("GETXHEIGHT");
@@ -169,4 +176,12 @@ public final class WCFontPerfLogger extends WCFont {
         logger.suspendCount("GETCAPHEIGHT");
         return res;
     }
+
+    @Override
+    public float[] getFontMetrics() {
+        logger.resumeCount("GETFONTMETRICS");
+        float[] res = fnt.getFontMetrics();
+        logger.suspendCount("GETFONTMETRICS");
+        return res;
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -355,6 +355,10 @@ struct SSizeCounterLogger {\
 #define LOG_COMMON_SIZE_ADD(size)    __lSizeCount__.add((LONG)size);
 #define LOG_COMMON_SIZE_REMOVE(size) __lSizeCount__.remove((LONG)size);
 
+#define LOG_POOL_STATS(T, inFlight, hits, misses, peakBytes) \
+    DBG::snTrace(L"%p " L#T L" InFlight:%d Hits:%d Misses:%d PeakBytes:%d",\
+        this, (int)(inFlight), (int)(hits), (int)(misses), (int)(peakBytes));
+
 #else //WIN32 & debug
 
 #define DBG_CHECKPOINT(a1, a2)
@@ -363,6 +367,7 @@ struct SSizeCounterLogger {\
 #define LOG_COMMON_SIZE(T)
 #define LOG_COMMON_SIZE_ADD(size)
 #define LOG_COMMON_SIZE_REMOVE(size)
+#define LOG_POOL_STATS(T, inFlight, hits, misses, peakBytes)
 
 #endif//WIN32 & debug
 
@@ -371,11 +376,13 @@ struct SSizeCounterLogger {\
 #define RQ_LOG_COMMON_SIZE(T) LOG_COMMON_SIZE(T)
 #define RQ_LOG_COMMON_SIZE_ADD(size) LOG_COMMON_SIZE_ADD(size)
 #define RQ_LOG_COMMON_SIZE_REMOVE(size) LOG_COMMON_SIZE_REMOVE(size)
+#define RQ_LOG_POOL_STATS(T, inFlight, hits, misses, peakBytes) LOG_POOL_STATS(T, inFlight, hits, misses, peakBytes)
 #else
 #define RQ_LOG_INSTANCE_COUNT(T)
 #define RQ_LOG_COMMON_SIZE(T)
 #define RQ_LOG_COMMON_SIZE_ADD(size)
 #define RQ_LOG_COMMON_SIZE_REMOVE(size)
+#define RQ_LOG_POOL_STATS(T, inFlight, hits, misses, peakBytes)
 #endif
 
 #endif//_DBGUTILS_H
@@ -92,6 +92,7 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     bindings/java/JavaNodeFilterCondition.h
     bridge/jni/jsc/BridgeUtils.h
     dom/DOMStringList.h
+    platform/graphics/java/FontFallbackCacheJava.h
     platform/graphics/java/ImageBufferJavaBackend.h
     platform/graphics/java/ImageJava.h
     platform/graphics/java/PlatformContextJava.h
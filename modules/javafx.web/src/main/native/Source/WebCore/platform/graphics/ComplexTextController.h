@@ -95,9 +95,9 @@ public:
         }
 
 #if PLATFORM(JAVA)
-        static Ref<ComplexTextRun> create(JLObject jRun, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
+        static Ref<ComplexTextRun> create(const jint* runData, const Font& font, const UChar* characters, unsigned stringLocation, unsigned stringLength)
         {
-            return adoptRef(*new ComplexTextRun(jRun, font, characters, stringLocation, stringLength));
+            return adoptRef(*new ComplexTextRun(runData, font, characters, stringLocation, stringLength));
         }
 #endif
 
@@ -134,7 +134,7 @@ public:
         ComplexTextRun(CTRunRef, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength, unsigned indexBegin, unsigned indexEnd);
         ComplexTextRun(hb_buffer_t*, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength, unsigned indexBegin, unsigned indexEnd);
 #if PLATFORM(JAVA)
-        ComplexTextRun(JLObject, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength);
+        ComplexTextRun(const jint* runData, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength);
 #endif
         ComplexTextRun(const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength, unsigned indexBegin, unsigned indexEnd, bool ltr);
         WEBCORE_EXPORT ComplexTextRun(const Vector<FloatSize>& advances, const Vector<FloatPoint>& origins, const Vector<Glyph>& glyphs, const Vector<unsigned>& stringIndices, FloatSize initialAdvance, const Font&, const UChar* characters, unsigned stringLocation, unsigned stringLength, unsigned indexBegin, unsigned indexEnd, bool ltr);
@@ -76,6 +76,10 @@
 #include "FontSetCache.h"
 #endif
 
+#if PLATFORM(JAVA)
+#include "FontFallbackCacheJava.h"
+#endif
+
 namespace WebCore {
 
 class Font;
@@ -256,6 +260,10 @@ private:
     FontSetCache m_fontSetCache;
 #endif
 
+#if PLATFORM(JAVA)
+    FontFallbackCacheJava m_fallbackCache;
+#endif
+
     friend class Font;
 };
 
@@ -264,7 +272,7 @@ inline std::unique_ptr<FontPlatformData> FontCache::createFontPlatformDataForTes
     return createFontPlatformData(fontDescription, family, { });
 }
 
-#if !PLATFORM(COCOA) && !USE(FREETYPE)
+#if !PLATFORM(COCOA) && !USE(FREETYPE) && !PLATFORM(JAVA)
 
 inline void FontCache::platformPurgeInactiveFontData()
 {
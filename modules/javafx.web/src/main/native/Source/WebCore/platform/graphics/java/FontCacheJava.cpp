@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,10 @@
 #include "FontPlatformData.h"
 #include "Font.h"
 #include "FontSelector.h"
+#include "GraphicsContextJava.h"
+
+#include <wtf/java/JavaRef.h>
+#include <wtf/text/StringView.h>
 
 namespace WebCore {
 
@@ -53,10 +57,27 @@ Ref<Font> FontCache::lastResortFallbackFont(const FontDescription& fontDescripti
 
 Vector<String> FontCache::systemFontFamilies()
 {
-    // FIXME: <https://webkit.org/b/147018> Web Inspector: [Freetype] Allow inspector to retrieve a list of system fonts
-    // FIXME: JDK-8146864
-    notImplemented();
-    return Vector<String>();
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
+        "getFontFamilyNames", "()[Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLocalRef<jobjectArray> jFamilies(static_cast<jobjectArray>(
+        env->CallObjectMethod(PL_GetGraphicsManager(env), mid)));
+    WTF::CheckAndClearException(env);
+    if (!jFamilies)
+        return { };
+
+    jsize count = env->GetArrayLength(jFamilies);
+    Vector<String> fontFamilies;
+    fontFamilies.reserveInitialCapacity(count);
+    for (jsize i = 0; i < count; i++) {
+        JLString jFamily(static_cast<jstring>(env->GetObjectArrayElement(jFamilies, i)));
+        if (jFamily)
+            fontFamilies.append(String(env, jFamily));
+    }
+    return fontFamilies;
 }
 
 bool FontCache::isSystemFontForbiddenForEditing(const String&)
@@ -72,7 +93,12 @@ std::optional<ASCIILiteral> FontCache::platformAlternateFamilyName(const String&
 
 void FontCache::platformInvalidate()
 {
-  // not implemented
+    m_fallbackCache.clear();
+}
+
+void FontCache::platformPurgeInactiveFontData()
+{
+    m_fallbackCache.clear();
 }
 
 Vector<FontSelectionCapabilities> FontCache::getFontSelectionCapabilitiesInFamily(const AtomString&, AllowUserInstalledFonts)
@@ -81,10 +107,15 @@ Vector<FontSelectionCapabilities> FontCache::getFontSelectionCapabilitiesInFamil
     return { };
 }
 
-RefPtr<Font> FontCache::systemFallbackForCharacterCluster(const FontDescription& description, const Font&, IsForPlatformFont, PreferColoredFont preferColoredFont, StringView stringView)
+RefPtr<Font> FontCache::systemFallbackForCharacterCluster(const FontDescription&, const Font& originalFontData, IsForPlatformFont, PreferColoredFont, StringView stringView)
 {
-    notImplemented();
-    return nullptr;
+    // The fallback fonts of a Java font are those of its Prism composite
+    // font, which come from fontconfig on Linux. Resolve the cluster by its
+    // first code point.
+    auto codePoints = stringView.codePoints();
+    if (codePoints.begin() == codePoints.end())
+        return nullptr;
+    return m_fallbackCache.fallbackForCharacter(originalFontData, *codePoints.begin());
 }
 }
 
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "FontFallbackCacheJava.h"
+
+#include "Font.h"
+#include "FontCache.h"
+#include "FontPlatformData.h"
+#include "PlatformJavaClasses.h"
+
+#include <wtf/java/JavaRef.h>
+
+namespace WebCore {
+
+namespace {
+
+RefPtr<RQRef> getJavaFallbackFont(RQRef& font, char32_t character)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetFontClass(env),
+        "getFallbackFont", "(I)Lcom/sun/webkit/graphics/WCFont;");
+    ASSERT(mid);
+
+    JLObject wcFont(env->CallObjectMethod(font, mid, jint(character)));
+    WTF::CheckAndClearException(env);
+
+    return RQRef::create(wcFont);
+}
+
+}
+
+RefPtr<Font> FontFallbackCacheJava::fallbackForCharacter(const Font& font, char32_t character)
+{
+    RefPtr<RQRef> jFont = font.platformData().nativeFontData();
+    if (!jFont)
+        return nullptr;
+
+    auto key = std::make_pair(static_cast<const RQRef*>(jFont.get()), static_cast<unsigned>(character >> blockShift));
+    auto it = m_cache.find(key);
+    // Fallback fonts usually cover a whole block, but the chosen font is
+    // checked for the character since the block may span several scripts.
+    if (it != m_cache.end() && it->value.fallbackFont->glyphForCharacter(character))
+        return it->value.fallbackFont;
+
+    RefPtr<RQRef> jFallbackFont = getJavaFallbackFont(*jFont, character);
+    if (!jFallbackFont)
+        return nullptr;
+
+    Ref<Font> fallbackFont = FontCache::forCurrentThread().fontForPlatformData(
+        FontPlatformData(jFallbackFont, font.platformData().size()));
+    m_cache.set(key, Entry { WTFMove(jFont), fallbackFont.copyRef() });
+    return fallbackFont;
+}
+
+void FontFallbackCacheJava::clear()
+{
+    m_cache.clear();
+}
+
+} // namespace WebCore
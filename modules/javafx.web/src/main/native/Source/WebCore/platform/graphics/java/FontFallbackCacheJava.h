@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,14 +23,38 @@
  * questions.
  */
 
-package com.sun.webkit.graphics;
-
-public interface WCTextRun {
-    boolean isLeftToRight();
-    float[] getGlyphPosAndAdvance(int glyphIndex);
-    int getCharOffset(int index);
-    int getEnd();
-    int getGlyph(int index);
-    int getGlyphCount();
-    int getStart();
-}
+#pragma once
+
+#include "RQRef.h"
+#include <wtf/HashMap.h>
+#include <wtf/RefPtr.h>
+
+namespace WebCore {
+
+class Font;
+
+// Remembers the fallback font chosen for a block of code points of a font,
+// so that a run of text in a script the font does not cover is resolved
+// through Java once per block instead of once per character.
+class FontFallbackCacheJava {
+    WTF_MAKE_NONCOPYABLE(FontFallbackCacheJava);
+public:
+    FontFallbackCacheJava() = default;
+
+    RefPtr<Font> fallbackForCharacter(const Font&, char32_t);
+    void clear();
+
+private:
+    static constexpr unsigned blockShift = 7;
+
+    struct Entry {
+        // Keeps the font alive so that its address is not reused by
+        // another font while the entry is cached.
+        RefPtr<RQRef> font;
+        RefPtr<Font> fallbackFont;
+    };
+
+    HashMap<std::pair<const RQRef*, unsigned>, Entry> m_cache;
+};
+
+} // namespace WebCore
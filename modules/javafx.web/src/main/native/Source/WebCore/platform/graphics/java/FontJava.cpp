@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,8 +33,10 @@
 #include "FontSelector.h"
 #include "GraphicsContextJava.h"
 #include "NotImplemented.h"
+#include "com_sun_webkit_graphics_WCFont.h"
 
 #include <wtf/Assertions.h>
+#include <wtf/java/JavaRef.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/text/CString.h>
 
@@ -48,43 +50,26 @@ void Font::platformInit()
     if (!jFont)
         return;
 
-    static jmethodID getXHeight_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getXHeight", "()F");
-    ASSERT(getXHeight_mID);
-    m_fontMetrics.setXHeight(env->CallFloatMethod(*jFont, getXHeight_mID));
+    // Fetch all metrics with a single call, see WCFont.getFontMetrics().
+    static jmethodID getFontMetrics_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getFontMetrics", "()[F");
+    ASSERT(getFontMetrics_mID);
+    JLocalRef<jfloatArray> jMetrics(static_cast<jfloatArray>(
+        env->CallObjectMethod(*jFont, getFontMetrics_mID)));
     WTF::CheckAndClearException(env);
+    if (!jMetrics || env->GetArrayLength(jMetrics) < com_sun_webkit_graphics_WCFont_FONT_METRICS_SIZE)
+        return;
 
-    static jmethodID getCapHeight_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getCapHeight", "()F");
-    ASSERT(getCapHeight_mID);
-    m_fontMetrics.setCapHeight(env->CallFloatMethod(*jFont, getCapHeight_mID));
-    WTF::CheckAndClearException(env);
+    jfloat metrics[com_sun_webkit_graphics_WCFont_FONT_METRICS_SIZE];
+    env->GetFloatArrayRegion(jMetrics, 0, com_sun_webkit_graphics_WCFont_FONT_METRICS_SIZE, metrics);
 
-    static jmethodID getAscent_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getAscent", "()F");
-    ASSERT(getAscent_mID);
-    m_fontMetrics.setAscent(env->CallFloatMethod(*jFont, getAscent_mID));
-    WTF::CheckAndClearException(env);
-
-    static jmethodID getDescent_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getDescent", "()F");
-    ASSERT(getDescent_mID);
-    m_fontMetrics.setDescent(env->CallFloatMethod(*jFont, getDescent_mID));
-    WTF::CheckAndClearException(env);
-
-    static jmethodID getLineSpacing_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getLineSpacing", "()F");
-    ASSERT(getLineSpacing_mID);
+    m_fontMetrics.setXHeight(metrics[com_sun_webkit_graphics_WCFont_FONT_METRICS_X_HEIGHT]);
+    m_fontMetrics.setCapHeight(metrics[com_sun_webkit_graphics_WCFont_FONT_METRICS_CAP_HEIGHT]);
+    m_fontMetrics.setAscent(metrics[com_sun_webkit_graphics_WCFont_FONT_METRICS_ASCENT]);
+    m_fontMetrics.setDescent(metrics[com_sun_webkit_graphics_WCFont_FONT_METRICS_DESCENT]);
     // Match CoreGraphics metrics.
-    m_fontMetrics.setLineSpacing(lroundf(
-        env->CallFloatMethod(*jFont, getLineSpacing_mID)));
-    WTF::CheckAndClearException(env);
-
-    static jmethodID getLineGap_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getLineGap", "()F");
-    ASSERT(getLineGap_mID);
-    m_fontMetrics.setLineGap(env->CallFloatMethod(*jFont, getLineGap_mID));
-    WTF::CheckAndClearException(env);
+    m_fontMetrics.setLineSpacing(lroundf(metrics[com_sun_webkit_graphics_WCFont_FONT_METRICS_LINE_SPACING]));
+    m_fontMetrics.setLineGap(metrics[com_sun_webkit_graphics_WCFont_FONT_METRICS_LINE_GAP]);
 }
 
 void Font::determinePitch()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -107,18 +107,20 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
     static jmethodID midAddImageData = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "addImageData",
-        "([B)V");
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(midAddImageData);
 
     while (m_receivedDataSize < data.size()) {
-        const auto& someData = data.getSomeData(m_receivedDataSize);
-        unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
-            // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+        auto someData = data.getSomeData(m_receivedDataSize);
+        size_t length = someData.size();
+        // The Java decoder reads the segment in place through a direct
+        // buffer, the segment is kept alive until the decoder is destroyed.
+        JLObject jBuffer(env->NewDirectByteBuffer(
+            const_cast<uint8_t*>(someData.data()), length));
+        if (jBuffer && !WTF::CheckAndClearException(env)) {
+            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)jBuffer);
             WTF::CheckAndClearException(env);
+            m_receivedData.append(WTFMove(someData));
         }
         m_receivedDataSize += length;
     }
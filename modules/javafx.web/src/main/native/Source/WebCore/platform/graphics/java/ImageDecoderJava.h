@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,8 @@ protected:
     mutable EncodedDataStatus m_encodedDataStatus { EncodedDataStatus::Unknown };
     // Native Handle for Java object.
     JGObject m_nativeDecoder;
+    // Data passed to the Java decoder as direct buffers, must outlive it.
+    Vector<SharedBufferDataView> m_receivedData;
     mutable IntSize m_size;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,13 +29,14 @@
 #include "FloatRect.h"
 #include "PlatformContextJava.h"
 #include "PlatformJavaClasses.h"
-#include "NotImplemented.h"
 #include "GraphicsContextJava.h"
 #include "RQRef.h"
 #include "GraphicsContext.h"
 #include "ImageBuffer.h"
 #include "PathStream.h"
 
+#include <wtf/MathExtras.h>
+#include <wtf/StdLibExtras.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/java/JavaRef.h>
 
@@ -43,6 +44,31 @@
 
 namespace WebCore {
 
+static constexpr uint8_t segMoveTo = com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO;
+static constexpr uint8_t segLineTo = com_sun_webkit_graphics_WCPathIterator_SEG_LINETO;
+static constexpr uint8_t segQuadTo = com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO;
+static constexpr uint8_t segCubicTo = com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO;
+static constexpr uint8_t segClose = com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE;
+
+// Maximum distance between a curve and the polyline used to answer
+// hit testing queries natively.
+static constexpr float flatteningTolerance = 0.05f;
+static constexpr unsigned maxFlatteningSteps = 128;
+
+static unsigned pointCount(uint8_t verb)
+{
+    switch (verb) {
+    case segMoveTo:
+    case segLineTo:
+        return 1;
+    case segQuadTo:
+        return 2;
+    case segCubicTo:
+        return 3;
+    }
+    return 0;
+}
+
 Ref<PathJava> PathJava::create()
 {
     return adoptRef(*new PathJava);
@@ -103,179 +129,252 @@ RefPtr<RQRef> copyPath(RefPtr<RQRef> p)
     return RQRef::create(ref);
 }
 
-Ref<PathJava> PathJava::create(RefPtr<RQRef>&& platformPath, RefPtr<PathStream>&& elementsStream)
-{
-    return adoptRef(*new PathJava(WTFMove(platformPath), WTFMove(elementsStream)));
-}
-
 PathJava::PathJava()
-    : m_platformPath(createEmptyPath())
-    , m_elementsStream(PathStream::create())
+    : m_elementsStream(PathStream::create())
 {
 }
 
-PathJava::PathJava(RefPtr<RQRef>&& platformPath, RefPtr<PathStream>&& elementsStream)
-    : m_platformPath(WTFMove(platformPath))
-    , m_elementsStream(WTFMove(elementsStream))
-{
-    ASSERT(m_platformPath);
-}
-
 Ref<PathImpl> PathJava::copy() const
 {
-    RefPtr<RQRef> platformPathCopy(copyPath(platformPath()));
+    auto pathCopy = PathJava::create();
+    pathCopy->m_verbs = m_verbs;
+    pathCopy->m_coords = m_coords;
+    pathCopy->m_currentPoint = m_currentPoint;
+    pathCopy->m_subpathStart = m_subpathStart;
 
     auto elementsStream = m_elementsStream ? RefPtr<PathImpl> { m_elementsStream->copy() } : nullptr;
+    pathCopy->m_elementsStream = downcast<PathStream>(WTFMove(elementsStream));
 
-    return PathJava::create(WTFMove(platformPathCopy), downcast<PathStream>(WTFMove(elementsStream)));
+    return pathCopy;
 }
 
 PlatformPathPtr PathJava::platformPath() const
 {
+    syncPlatformPath();
     return m_platformPath.get();
 }
 
-
-void PathJava::add(PathMoveTo moveto)
+/*
+ * Ships the segments recorded since the last call to the java path
+ * in a single direct ByteBuffer laid out (in native byte order) as:
+ *   jint verbCount, jint coordCount,
+ *   verbCount bytes of verbs padded to a multiple of 4,
+ *   coordCount jfloats.
+ */
+void PathJava::syncPlatformPath() const
 {
-    ASSERT(m_platformPath);
+    if (!m_platformPath) {
+        m_platformPath = createEmptyPath();
+    }
+
+    size_t verbCount = m_verbs.size() - m_syncedVerbCount;
+    if (!verbCount) {
+        return;
+    }
+    size_t coordCount = m_coords.size() - m_syncedCoordCount;
+    size_t coordOffset = roundUpToMultipleOf<sizeof(jfloat)>(2 * sizeof(jint) + verbCount);
+
+    Vector<uint8_t> segments(coordOffset + coordCount * sizeof(jfloat), 0);
+    jint header[2] = { static_cast<jint>(verbCount), static_cast<jint>(coordCount) };
+    memcpy(segments.data(), header, sizeof(header));
+    memcpy(segments.data() + sizeof(header), m_verbs.data() + m_syncedVerbCount, verbCount);
+    memcpy(segments.data() + coordOffset, m_coords.data() + m_syncedCoordCount, coordCount * sizeof(jfloat));
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
+    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addSegments",
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)moveto.point.x(), (jdouble)moveto.point.y());
+    // The java side copies the segments into its own path before returning.
+    JLObject buffer(env->NewDirectByteBuffer(segments.data(), segments.size()));
+    env->CallVoidMethod(*m_platformPath, mid, (jobject)buffer);
     WTF::CheckAndClearException(env);
+
+    m_syncedVerbCount = m_verbs.size();
+    m_syncedCoordCount = m_coords.size();
 }
 
-void PathJava::add(PathLineTo lineTo)
+void PathJava::appendSegment(uint8_t verb, std::initializer_list<FloatPoint> points)
 {
-    ASSERT(m_platformPath);
+    ASSERT(points.size() == pointCount(verb));
 
-    JNIEnv* env = WTF::GetJavaEnv();
+    if (verb == segClose) {
+        // Closing an empty or already closed subpath is a no-op.
+        if (m_verbs.isEmpty() || m_verbs.last() == segClose) {
+            return;
+        }
+        m_verbs.append(segClose);
+        m_currentPoint = m_subpathStart;
+        return;
+    }
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
+    // A segment without a current point starts a new subpath.
+    if (verb != segMoveTo && m_verbs.isEmpty()) {
+        appendSegment(segMoveTo, { *points.begin() });
+    }
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)lineTo.point.x(), (jdouble)lineTo.point.y());
-    WTF::CheckAndClearException(env);
+    m_verbs.append(verb);
+    for (auto& point : points) {
+        m_coords.append(point.x());
+        m_coords.append(point.y());
+    }
+    m_currentPoint = *(points.end() - 1);
+    if (verb == segMoveTo) {
+        m_subpathStart = m_currentPoint;
+    }
 }
 
-void PathJava::add(PathQuadCurveTo quadTo)
+void PathJava::add(PathMoveTo moveTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
+    appendSegment(segMoveTo, { moveTo.point });
+}
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
+void PathJava::add(PathLineTo lineTo)
+{
+    appendSegment(segLineTo, { lineTo.point });
+}
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)quadTo.controlPoint.x(), (jdouble)quadTo.controlPoint.y(), (jdouble)quadTo.endPoint.x(), (jdouble)quadTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+void PathJava::add(PathQuadCurveTo quadTo)
+{
+    appendSegment(segQuadTo, { quadTo.controlPoint, quadTo.endPoint });
 }
 
 void PathJava::add(PathBezierCurveTo bezierTo)
 {
-    ASSERT(m_platformPath);
+    appendSegment(segCubicTo, { bezierTo.controlPoint1, bezierTo.controlPoint2, bezierTo.endPoint });
+}
 
-    JNIEnv* env = WTF::GetJavaEnv();
+/*
+ * Appends the arc of the unit circle starting at startAngle and spanning
+ * sweepAngle radians, mapped to user space. The arc is connected to the
+ * current subpath by a line, and split into cubic curves of at most 90 degrees.
+ */
+void PathJava::addArcCurves(const AffineTransform& unitCircleToUser, float startAngle, float sweepAngle)
+{
+    auto pointAt = [&](float angle, float tangentScale) {
+        return FloatPoint(std::cos(angle), std::sin(angle)) + FloatSize(-std::sin(angle) * tangentScale, std::cos(angle) * tangentScale);
+    };
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
+    FloatPoint start = unitCircleToUser.mapPoint(pointAt(startAngle, 0));
+    if (m_verbs.isEmpty()) {
+        appendSegment(segMoveTo, { start });
+    } else if (m_currentPoint != start || m_verbs.last() == segClose) {
+        appendSegment(segLineTo, { start });
+    }
 
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)bezierTo.controlPoint1.x(), (jdouble)bezierTo.controlPoint1.y(),
-                        (jdouble)bezierTo.controlPoint2.x(), (jdouble)bezierTo.controlPoint2.y(),
-                        (jdouble)bezierTo.endPoint.x(), (jdouble)bezierTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    unsigned curveCount = std::max(1u, static_cast<unsigned>(std::ceil(std::abs(sweepAngle) / piOverTwoFloat - 1e-4f)));
+    float step = sweepAngle / curveCount;
+    float kappa = 4.f / 3.f * std::tan(step / 4);
+    for (unsigned i = 0; i < curveCount; ++i) {
+        float angle0 = startAngle + i * step;
+        float angle1 = (i + 1 == curveCount) ? startAngle + sweepAngle : angle0 + step;
+        appendSegment(segCubicTo, {
+            unitCircleToUser.mapPoint(pointAt(angle0, kappa)),
+            unitCircleToUser.mapPoint(pointAt(angle1, -kappa)),
+            unitCircleToUser.mapPoint(pointAt(angle1, 0))
+        });
+    }
 }
 
-static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
+void PathJava::addEllipticArc(const FloatPoint& center, float radiusX, float radiusY, float rotation,
+    float startAngle, float endAngle, bool anticlockwise)
 {
-    return p1.x() * (p2.y() - p3.y()) + p2.x() * (p3.y() - p1.y()) + p3.x() * (p1.y() - p2.y());
+    // See http://www.whatwg.org/specs/web-apps/current-work/multipage/the-canvas-element.html#dom-context-2d-arc
+    // Angles are already normalized by CanvasPath. When startAngle = 0, endAngle = 2Pi
+    // and anticlockwise = true the entire circle is drawn, because some web sites
+    // use arc(x, y, r, 0, 2*Math.PI, true) to draw circles.
+    constexpr float twoPi = 2 * piFloat;
+    float newEndAngle = endAngle;
+    if (!anticlockwise && startAngle > endAngle) {
+        newEndAngle = startAngle + (twoPi - std::fmod(startAngle - endAngle, twoPi));
+    } else if (anticlockwise && startAngle < endAngle) {
+        newEndAngle = startAngle - (twoPi - std::fmod(endAngle - startAngle, twoPi));
+    }
+
+    AffineTransform unitCircleToUser;
+    unitCircleToUser.translate(center);
+    unitCircleToUser.rotateRadians(rotation);
+    unitCircleToUser.scaleNonUniform(radiusX, radiusY);
+    addArcCurves(unitCircleToUser, startAngle, clampTo<float>(newEndAngle - startAngle, -twoPi, twoPi));
 }
 
 void PathJava::add(PathArcTo arcTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
+    const FloatPoint& p1 = arcTo.controlPoint1;
+    const FloatPoint& p2 = arcTo.controlPoint2;
+    if (m_verbs.isEmpty()) {
+        appendSegment(segMoveTo, { p1 });
+    }
+    FloatPoint p0 = m_currentPoint;
+
+    FloatSize v1 = p0 - p1;
+    FloatSize v2 = p2 - p1;
+    float cross = v1.width() * v2.height() - v1.height() * v2.width();
+    if (!arcTo.radius || v1.isZero() || v2.isZero() || !cross) {
+        appendSegment(segLineTo, { p1 });
+        return;
+    }
+    v1.scale(1 / v1.diagonalLength());
+    v2.scale(1 / v2.diagonalLength());
+
+    // The arc is tangent to both p0-p1 and p1-p2, its center lies on the bisector.
+    float halfAngle = std::acos(clampTo<float>(v1.width() * v2.width() + v1.height() * v2.height(), -1, 1)) / 2;
+    float tangentDistance = arcTo.radius / std::tan(halfAngle);
+    FloatPoint tangent1 = p1 + FloatSize(v1.width() * tangentDistance, v1.height() * tangentDistance);
+    FloatPoint tangent2 = p1 + FloatSize(v2.width() * tangentDistance, v2.height() * tangentDistance);
+    FloatSize bisector = v1 + v2;
+    bisector.scale(arcTo.radius / std::sin(halfAngle) / bisector.diagonalLength());
+    FloatPoint center = p1 + bisector;
+
+    float startAngle = std::atan2(tangent1.y() - center.y(), tangent1.x() - center.x());
+    float endAngle = std::atan2(tangent2.y() - center.y(), tangent2.x() - center.x());
+    float sweepAngle = endAngle - startAngle;
+    if (sweepAngle > piFloat) {
+        sweepAngle -= 2 * piFloat;
+    } else if (sweepAngle < -piFloat) {
+        sweepAngle += 2 * piFloat;
+    }
 
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)arcTo.controlPoint1.x(), (jdouble)arcTo.controlPoint1.y(),
-                        (jdouble)arcTo.controlPoint2.x(), (jdouble)arcTo.controlPoint2.y(), (jdouble)arcTo.radius);
-    WTF::CheckAndClearException(env);
+    AffineTransform unitCircleToUser;
+    unitCircleToUser.translate(center);
+    unitCircleToUser.scale(arcTo.radius);
+    addArcCurves(unitCircleToUser, startAngle, sweepAngle);
 }
 
 void PathJava::add(PathArc arc)
 {
-    ASSERT(m_platformPath);
-    bool clockwise = false;
-    const RotationDirection direction = arc.direction;
-    if (direction == RotationDirection::Counterclockwise) {
-        clockwise = true;
-    } else if (direction == RotationDirection::Clockwise) {
-        clockwise = false;
-    }
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)arc.center.x(), (jdouble)arc.center.y(),
-        (jdouble)arc.radius, (jdouble)arc.startAngle, (jdouble)arc.endAngle,
-        bool_to_jbool(clockwise));
-    WTF::CheckAndClearException(env);
+    addEllipticArc(arc.center, arc.radius, arc.radius, 0, arc.startAngle, arc.endAngle,
+        arc.direction == RotationDirection::Counterclockwise);
 }
+
 void PathJava::add(PathClosedArc closedArc)
 {
-    notImplemented();
+    add(closedArc.arc);
+    appendSegment(segClose, { });
 }
 
 void PathJava::add(PathEllipse ellipse)
 {
-    notImplemented();
+    addEllipticArc(ellipse.center, ellipse.radiusX, ellipse.radiusY, ellipse.rotation,
+        ellipse.startAngle, ellipse.endAngle, ellipse.direction == RotationDirection::Counterclockwise);
 }
 
 void PathJava::add(PathEllipseInRect ellipseInRect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
+    const FloatRect& rect = ellipseInRect.rect;
+    AffineTransform unitCircleToUser;
+    unitCircleToUser.translate(rect.center());
+    unitCircleToUser.scaleNonUniform(rect.width() / 2, rect.height() / 2);
 
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)ellipseInRect.rect.x(), (jdouble)ellipseInRect.rect.y(),
-                        (jdouble)ellipseInRect.rect.width(), (jdouble)ellipseInRect.rect.height());
-    WTF::CheckAndClearException(env);
+    appendSegment(segMoveTo, { unitCircleToUser.mapPoint(FloatPoint(1, 0)) });
+    addArcCurves(unitCircleToUser, 0, 2 * piFloat);
+    appendSegment(segClose, { });
 }
 
 void PathJava::add(PathRect rect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)rect.rect.x(), (jdouble)rect.rect.y(),
-                              (jdouble)rect.rect.width(), (jdouble)rect.rect.height());
-    WTF::CheckAndClearException(env);
+    addLinesForRect(rect.rect);
 }
 
 void PathJava::add(PathRoundedRect roundedRect)
@@ -285,21 +384,40 @@ void PathJava::add(PathRoundedRect roundedRect)
 
 void PathJava::add(PathCloseSubpath)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
+    appendSegment(segClose, { });
 }
 
 void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
 {
-    notImplemented();
+    size_t coordIndex = 0;
+    auto nextPoint = [&] {
+        FloatPoint point(path.m_coords[coordIndex], path.m_coords[coordIndex + 1]);
+        coordIndex += 2;
+        return transform.mapPoint(point);
+    };
+
+    for (uint8_t verb : path.m_verbs) {
+        switch (verb) {
+        case segMoveTo:
+        case segLineTo:
+            appendSegment(verb, { nextPoint() });
+            break;
+        case segQuadTo: {
+            FloatPoint controlPoint = nextPoint();
+            appendSegment(verb, { controlPoint, nextPoint() });
+            break;
+        }
+        case segCubicTo: {
+            FloatPoint controlPoint1 = nextPoint();
+            FloatPoint controlPoint2 = nextPoint();
+            appendSegment(verb, { controlPoint1, controlPoint2, nextPoint() });
+            break;
+        }
+        case segClose:
+            appendSegment(verb, { });
+            break;
+        }
+    }
 }
 
 void PathJava::applySegments(const PathSegmentApplier& applier) const
@@ -331,36 +449,58 @@ void PathJava::applySegments(const PathSegmentApplier& applier) const
 
 bool PathJava::applyElements(const PathElementApplier& applier) const
 {
-    // need to implement this method after looking into cairo implementation
+    size_t coordIndex = 0;
+    for (uint8_t verb : m_verbs) {
+        PathElement element;
+        switch (verb) {
+        case segMoveTo:
+            element.type = PathElement::Type::MoveToPoint;
+            break;
+        case segLineTo:
+            element.type = PathElement::Type::AddLineToPoint;
+            break;
+        case segQuadTo:
+            element.type = PathElement::Type::AddQuadCurveToPoint;
+            break;
+        case segCubicTo:
+            element.type = PathElement::Type::AddCurveToPoint;
+            break;
+        default:
+            element.type = PathElement::Type::CloseSubpath;
+            break;
+        }
+        for (unsigned i = 0; i < pointCount(verb); ++i, coordIndex += 2) {
+            element.points[i] = FloatPoint(m_coords[coordIndex], m_coords[coordIndex + 1]);
+        }
+        applier(element);
+    }
     return true;
 }
 
 bool PathJava::isEmpty() const
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                                            "isEmpty", "()Z");
-    ASSERT(mid);
-
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
-
-    return jbool_to_bool(res);
+    return m_verbs.isEmpty();
 }
 
 FloatPoint PathJava::currentPoint() const
 {
-    //utatodo: return current point of subpath.
-    float quietNaN = std::numeric_limits<float>::quiet_NaN();
-    return FloatPoint(quietNaN, quietNaN);
+    return m_currentPoint;
 }
 
 bool PathJava::transform(const AffineTransform& transform)
 {
-    ASSERT(m_platformPath);
+    for (size_t i = 0; i + 1 < m_coords.size(); i += 2) {
+        FloatPoint point = transform.mapPoint(FloatPoint(m_coords[i], m_coords[i + 1]));
+        m_coords[i] = point.x();
+        m_coords[i + 1] = point.y();
+    }
+    m_currentPoint = transform.mapPoint(m_currentPoint);
+    m_subpathStart = transform.mapPoint(m_subpathStart);
+
+    // The segments not shipped yet are transformed already.
+    if (!m_platformPath || !m_syncedVerbCount) {
+        return true;
+    }
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -376,29 +516,122 @@ bool PathJava::transform(const AffineTransform& transform)
     return true;
 }
 
-bool PathJava::contains(const FloatPoint &point, WindRule rule) const
+namespace {
+
+struct FlattenedEdge {
+    FloatPoint from;
+    FloatPoint to;
+    // The edge starts inside of a flattened curve rather than at a path vertex.
+    bool smoothStart;
+    // The edge is not part of the path, it closes an open subpath for filling.
+    bool implicitClose;
+};
+
+template<typename EdgeVisitor>
+void flattenPath(const Vector<uint8_t>& verbs, const Vector<float>& coords, const EdgeVisitor& visitor)
 {
-    if (isEmpty() || !std::isfinite(point.x()) || !std::isfinite(point.y()))
-        return false;
+    FloatPoint current;
+    FloatPoint subpathStart;
+    bool subpathOpen = false;
+    size_t coordIndex = 0;
 
-    ASSERT(m_platformPath);
+    auto point = [&](unsigned i) {
+        return FloatPoint(coords[coordIndex + 2 * i], coords[coordIndex + 2 * i + 1]);
+    };
+    auto closeSubpath = [&](bool implicit) {
+        if (subpathOpen) {
+            visitor(FlattenedEdge { current, subpathStart, false, implicit });
+        }
+        current = subpathStart;
+        subpathOpen = false;
+    };
+    auto flattenCurve = [&](float maxSecondDifference, float errorScale, const auto& evaluate) {
+        unsigned steps = clampTo<unsigned>(std::ceil(std::sqrt(errorScale * maxSecondDifference / flatteningTolerance)), 1, maxFlatteningSteps);
+        for (unsigned i = 1; i <= steps; ++i) {
+            FloatPoint next = evaluate(static_cast<float>(i) / steps);
+            visitor(FlattenedEdge { current, next, i > 1, false });
+            current = next;
+        }
+    };
 
-    JNIEnv* env = WTF::GetJavaEnv();
+    for (uint8_t verb : verbs) {
+        switch (verb) {
+        case segMoveTo:
+            closeSubpath(true);
+            current = subpathStart = point(0);
+            break;
+        case segLineTo:
+            visitor(FlattenedEdge { current, point(0), false, false });
+            current = point(0);
+            subpathOpen = true;
+            break;
+        case segQuadTo: {
+            FloatPoint p0 = current, p1 = point(0), p2 = point(1);
+            // The distance between a quadratic curve and its chords is bounded
+            // by |p0 - 2 p1 + p2| / (4 n^2) for n chords.
+            flattenCurve((p0 - p1 - (p1 - p2)).diagonalLength(), 0.25f, [&](float t) {
+                float mt = 1 - t;
+                return FloatPoint(mt * mt * p0.x() + 2 * mt * t * p1.x() + t * t * p2.x(),
+                    mt * mt * p0.y() + 2 * mt * t * p1.y() + t * t * p2.y());
+            });
+            subpathOpen = true;
+            break;
+        }
+        case segCubicTo: {
+            FloatPoint p0 = current, p1 = point(0), p2 = point(1), p3 = point(2);
+            // ... and by 3/4 max(|p0 - 2 p1 + p2|, |p1 - 2 p2 + p3|) / n^2 for a cubic one.
+            float secondDifference = std::max((p0 - p1 - (p1 - p2)).diagonalLength(), (p1 - p2 - (p2 - p3)).diagonalLength());
+            flattenCurve(secondDifference, 0.75f, [&](float t) {
+                float mt = 1 - t;
+                float a = mt * mt * mt, b = 3 * mt * mt * t, c = 3 * mt * t * t, d = t * t * t;
+                return FloatPoint(a * p0.x() + b * p1.x() + c * p2.x() + d * p3.x(),
+                    a * p0.y() + b * p1.y() + c * p2.y() + d * p3.y());
+            });
+            subpathOpen = true;
+            break;
+        }
+        case segClose:
+            closeSubpath(false);
+            break;
+        }
+        coordIndex += 2 * pointCount(verb);
+    }
+    closeSubpath(true);
+}
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "contains",
-        "(IDD)Z");
-    ASSERT(mid);
+float distanceToEdge(const FloatPoint& point, const FlattenedEdge& edge, float& projection)
+{
+    FloatSize direction = edge.to - edge.from;
+    FloatSize offset = point - edge.from;
+    float lengthSquared = direction.diagonalLengthSquared();
+    projection = lengthSquared ? (offset.width() * direction.width() + offset.height() * direction.height()) / lengthSquared : 0;
+    FloatPoint closest = edge.from + direction * clampTo<float>(projection, 0, 1);
+    return (point - closest).diagonalLength();
+}
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jint)rule,
-        (jdouble)point.x(), (jdouble)point.y());
-    WTF::CheckAndClearException(env);
+} // namespace
 
-    return jbool_to_bool(res);
+bool PathJava::contains(const FloatPoint &point, WindRule rule) const
+{
+    if (isEmpty() || !std::isfinite(point.x()) || !std::isfinite(point.y()))
+        return false;
+
+    int winding = 0;
+    flattenPath(m_verbs, m_coords, [&](const FlattenedEdge& edge) {
+        if ((edge.from.y() <= point.y()) == (edge.to.y() <= point.y())) {
+            return;
+        }
+        float t = (point.y() - edge.from.y()) / (edge.to.y() - edge.from.y());
+        if (point.x() < edge.from.x() + t * (edge.to.x() - edge.from.x())) {
+            winding += edge.to.y() > edge.from.y() ? 1 : -1;
+        }
+    });
+
+    return rule == WindRule::EvenOdd ? (winding & 1) : winding;
 }
 
 bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
     ASSERT(strokeStyleApplier);
 
     GraphicsContext& gc = scratchContext();
@@ -419,6 +652,40 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
     gc.restore();
 
+    size_t size = strokeStyle == StrokeStyle::SolidStroke ? 0 : dashes.size();
+
+    // Solid strokes are hit tested natively, except for the points close to
+    // joins and caps where the result depends on their exact shape.
+    if (!size && std::isfinite(p.x()) && std::isfinite(p.y())) {
+        float halfThickness = thickness / 2;
+        float outlineFactor = std::max(join == LineJoin::Miter ? std::max(miterLimit, 1.f) : 1.f,
+            cap == LineCap::Square ? sqrtOfTwoFloat : 1.f);
+        bool hasEdges = false;
+        bool inside = false;
+        float minDistance = std::numeric_limits<float>::infinity();
+        flattenPath(m_verbs, m_coords, [&](const FlattenedEdge& edge) {
+            if (edge.implicitClose || inside) {
+                return;
+            }
+            hasEdges = true;
+            float projection;
+            float distance = distanceToEdge(p, edge, projection);
+            minDistance = std::min(minDistance, distance);
+            if (distance <= halfThickness - flatteningTolerance
+                && ((projection >= 0 && projection <= 1) || (edge.smoothStart && projection < 0))) {
+                inside = true;
+            }
+        });
+        if (inside) {
+            return true;
+        }
+        if (hasEdges && minDistance > halfThickness * outlineFactor + flatteningTolerance) {
+            return false;
+        }
+    }
+
+    syncPlatformPath();
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "strokeContains",
@@ -426,7 +693,6 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
     ASSERT(mid);
 
-    size_t size = strokeStyle == StrokeStyle::SolidStroke ? 0 : dashes.size();
     JLocalRef<jdoubleArray> dashArray(env->NewDoubleArray(size));
     env->SetDoubleArrayRegion(dashArray, 0, size, dashes.data());
 
@@ -441,7 +707,14 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
 FloatRect PathJava::fastBoundingRect() const
 {
-    return boundingRect();
+    FloatRect bounds = FloatRect::smallestRect();
+    for (size_t i = 0; i + 1 < m_coords.size(); i += 2) {
+        bounds.extend(FloatPoint(m_coords[i], m_coords[i + 1]));
+    }
+    if (bounds.isSmallest()) {
+        return FloatRect();
+    }
+    return bounds;
 }
 
 FloatRect PathJava::boundingRect() const
@@ -451,46 +724,46 @@ FloatRect PathJava::boundingRect() const
 
 FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
+    FloatPoint currentPoint;
+    FloatPoint lastMoveToPoint;
+    FloatRect bounds = FloatRect::smallestRect();
 
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "getBounds",
-            "()Lcom/sun/webkit/graphics/WCRectangle;");
-    ASSERT(mid);
-
-    JLObject rect(env->CallObjectMethod(*m_platformPath, mid));
-    WTF::CheckAndClearException(env);
-    if (rect) {
-        static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
-        ASSERT(rectxFID);
-        static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
-        ASSERT(rectyFID);
-        static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
-        ASSERT(rectwFID);
-        static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
-        ASSERT(recthFID);
-
-        FloatRect bounds(
-            float(env->GetFloatField(rect, rectxFID)),
-            float(env->GetFloatField(rect, rectyFID)),
-            float(env->GetFloatField(rect, rectwFID)),
-            float(env->GetFloatField(rect, recthFID)));
-        WTF::CheckAndClearException(env);
-
-        float thickness;
-        if (strokeStyleApplier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            strokeStyleApplier(gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
+    auto extend = [&](const auto& segment) {
+        segment.extendBoundingRect(currentPoint, lastMoveToPoint, bounds);
+        currentPoint = segment.calculateEndPoint(currentPoint, lastMoveToPoint);
+    };
+    applyElements([&](const PathElement& element) {
+        switch (element.type) {
+        case PathElement::Type::MoveToPoint:
+            extend(PathMoveTo { element.points[0] });
+            break;
+        case PathElement::Type::AddLineToPoint:
+            extend(PathLineTo { element.points[0] });
+            break;
+        case PathElement::Type::AddQuadCurveToPoint:
+            extend(PathQuadCurveTo { element.points[0], element.points[1] });
+            break;
+        case PathElement::Type::AddCurveToPoint:
+            extend(PathBezierCurveTo { element.points[0], element.points[1], element.points[2] });
+            break;
+        case PathElement::Type::CloseSubpath:
+            extend(PathCloseSubpath { });
+            break;
         }
-        return bounds;
-    } else {
+    });
+    if (bounds.isSmallest()) {
         return FloatRect();
     }
+
+    if (strokeStyleApplier) {
+        GraphicsContext& gc = scratchContext();
+        gc.save();
+        strokeStyleApplier(gc);
+        float thickness = gc.strokeThickness();
+        gc.restore();
+        bounds.inflate(thickness / 2);
+    }
+    return bounds;
 }
 
 } // namespace WebCore
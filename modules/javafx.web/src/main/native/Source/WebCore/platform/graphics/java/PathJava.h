@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,21 +30,28 @@
 #include "PlatformPath.h"
 #include "RQRef.h"
 #include "WindRule.h"
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
+class AffineTransform;
 class GraphicsContext;
 class PathStream;
 
+/*
+ * The path is recorded natively as a compact list of verbs (the SEG_* constants
+ * of WCPathIterator) and float coordinates. The java WCPath is only created
+ * and updated when the platform path is requested for painting, at which point
+ * all the segments recorded since the last request are shipped in one call.
+ * Hit testing and bounds queries are answered natively whenever possible.
+ */
 class PathJava final : public PathImpl {
 public:
     static Ref<PathJava> create();
     static Ref<PathJava> create(const PathSegment&);
     static Ref<PathJava> create(const PathStream&);
-    static Ref<PathJava> create(RefPtr<RQRef>&&, RefPtr<PathStream>&& = nullptr);
 
     PathJava();
-    PathJava(RefPtr<RQRef>&&, RefPtr<PathStream>&&);
 
     PlatformPathPtr platformPath() const;
 
@@ -83,7 +90,21 @@ private:
     FloatRect fastBoundingRect() const final;
     FloatRect boundingRect() const final;
 
-    RefPtr<RQRef> m_platformPath;
+    void appendSegment(uint8_t verb, std::initializer_list<FloatPoint>);
+    void addArcCurves(const AffineTransform& unitCircleToUser, float startAngle, float sweepAngle);
+    void addEllipticArc(const FloatPoint& center, float radiusX, float radiusY, float rotation,
+        float startAngle, float endAngle, bool anticlockwise);
+    void syncPlatformPath() const;
+
+    Vector<uint8_t> m_verbs;
+    Vector<float> m_coords;
+    FloatPoint m_currentPoint;
+    FloatPoint m_subpathStart;
+
+    mutable RefPtr<RQRef> m_platformPath;
+    mutable size_t m_syncedVerbCount { 0 };
+    mutable size_t m_syncedCoordCount { 0 };
+
     RefPtr<PathStream> m_elementsStream;
 };
 
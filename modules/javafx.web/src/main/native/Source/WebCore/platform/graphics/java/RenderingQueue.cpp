@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,43 @@ static Addr2ByteBuffer& getAddr2ByteBuffer()
     return container.get();
 }
 
+RefPtr<ByteBuffer> ByteBufferPool::acquire(int size)
+{
+    RefPtr<ByteBuffer> buffer;
+    if (size <= m_bufferCapacity && !m_freeBuffers.isEmpty()) {
+        buffer = m_freeBuffers.takeLast();
+        ++m_statistics.hits;
+    } else {
+        buffer = ByteBuffer::create(std::max(m_bufferCapacity, size));
+        ++m_statistics.misses;
+        m_statistics.bytes += buffer->capacity();
+        m_statistics.peakBytes = std::max(m_statistics.peakBytes, m_statistics.bytes);
+    }
+    ++m_statistics.buffersInFlight;
+    buffer->setPool(this);
+
+    RQ_LOG_POOL_STATS(ByteBufferPool, m_statistics.buffersInFlight,
+        m_statistics.hits, m_statistics.misses, m_statistics.peakBytes)
+    return buffer;
+}
+
+void ByteBufferPool::recycle(RefPtr<ByteBuffer>&& buffer)
+{
+    ASSERT(m_statistics.buffersInFlight > 0);
+    --m_statistics.buffersInFlight;
+
+    buffer->reset();
+    if (buffer->capacity() == m_bufferCapacity
+            && m_freeBuffers.size() < m_maxPooledBuffers) {
+        m_freeBuffers.append(WTFMove(buffer));
+    } else {
+        m_statistics.bytes -= buffer->capacity();
+    }
+
+    RQ_LOG_POOL_STATS(ByteBufferPool, m_statistics.buffersInFlight,
+        m_statistics.hits, m_statistics.misses, m_statistics.peakBytes)
+}
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
@@ -58,6 +95,7 @@ RefPtr<RenderingQueue> RenderingQueue::create(
 }
 
 RenderingQueue& RenderingQueue::freeSpace(int size) {
+    ++m_frameStatistics.commands;
     if (m_buffer && !m_buffer->hasFreeSpace(size)) {
         flushBuffer();
         if (m_autoFlush) {
@@ -65,11 +103,24 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = m_bufferPool->acquire(size);
     }
     return *this;
 }
 
+RenderingQueue::~RenderingQueue() {
+    // The current buffer and the buffers of an uncommitted frame
+    // have never been handed over to java.
+    if (m_buffer) {
+        m_frameBuffers.append(std::exchange(m_buffer, nullptr));
+    }
+    for (auto& buffer : m_frameBuffers) {
+        buffer->takePool();
+        m_bufferPool->recycle(WTFMove(buffer));
+    }
+    disposeGraphics();
+}
+
 void RenderingQueue::flush() {
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -103,6 +154,10 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     if (isEmpty()) {
         return *this;
     }
+    if (m_inFrame) {
+        m_frameBuffers.append(std::exchange(m_buffer, nullptr));
+        return *this;
+    }
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
@@ -121,6 +176,63 @@ RenderingQueue& RenderingQueue::flushBuffer() {
 
     return *this;
 }
+
+void RenderingQueue::beginFrame() {
+    ASSERT(!m_inFrame);
+    flushBuffer();
+    m_inFrame = true;
+    m_frameStatistics = FrameStatistics();
+    m_frameStart = MonotonicTime::now();
+}
+
+/*
+ * The method is called on Event thread at the end of a paint.
+ */
+void RenderingQueue::commitFrame() {
+    ASSERT(m_inFrame);
+    flushBuffer();
+    m_inFrame = false;
+    m_frameStatistics.encodeTime = MonotonicTime::now() - m_frameStart;
+
+    Vector< RefPtr<ByteBuffer> > buffers = std::exchange(m_frameBuffers, { });
+    if (buffers.isEmpty()) {
+        return;
+    }
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static JGClass byteBufferClass(env->FindClass("java/nio/ByteBuffer"));
+    ASSERT(byteBufferClass);
+
+    static jmethodID midFwkAddBuffers = env->GetMethodID(PG_GetRenderQueueClass(env),
+        "fwkAddBuffers", "([Ljava/nio/ByteBuffer;IIJ)V");
+    ASSERT(midFwkAddBuffers);
+
+    JLocalRef<jobjectArray> jbuffers(env->NewObjectArray(buffers.size(), byteBufferClass, nullptr));
+    if (WTF::CheckAndClearException(env) || !jbuffers) {
+        for (auto& buffer : buffers) {
+            buffer->takePool();
+            m_bufferPool->recycle(WTFMove(buffer));
+        }
+        return;
+    }
+
+    Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        a2bb.set(buffers[i]->bufferAddress(), buffers[i]);
+        m_frameStatistics.bytes += buffers[i]->size();
+        env->SetObjectArrayElement(jbuffers, i, (jobject)(buffers[i]->createDirectByteBuffer(env)));
+    }
+    m_frameStatistics.buffers = buffers.size();
+
+    env->CallVoidMethod(
+        getWCRenderingQueue(),
+        midFwkAddBuffers,
+        (jobjectArray)jbuffers,
+        m_frameStatistics.commands,
+        m_frameStatistics.bytes,
+        static_cast<jlong>(m_frameStatistics.encodeTime.nanoseconds()));
+    WTF::CheckAndClearException(env);
+}
 }
 
 
@@ -139,7 +251,10 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
         char *key = (char *)env->GetDirectBufferAddress(
             JLObject(env->GetObjectArrayElement(bufs, i)));
         if (key != 0) {
-            a2bb.remove(key);
+            RefPtr<ByteBuffer> buffer = a2bb.take(key);
+            if (RefPtr<ByteBufferPool> pool = buffer ? buffer->takePool() : nullptr) {
+                pool->recycle(WTFMove(buffer));
+            }
         }
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include <wtf/Vector.h>
 #include <wtf/RefCounted.h>
 #include <wtf/HashSet.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/java/DbgUtils.h>
 
 #include "RQRef.h"
@@ -36,10 +37,15 @@
 namespace WebCore {
 
 class RQRef;
+class ByteBufferPool;
 
 class ByteBuffer : public RefCounted<ByteBuffer> {
     RQ_LOG_INSTANCE_COUNT(ByteBuffer)
 public:
+    // Command buffers are cache line aligned, so that the Render thread
+    // never shares a line with unrelated data while decoding them.
+    static const size_t BUFFER_ALIGNMENT = 64;
+
     static RefPtr<ByteBuffer> create(int capacity) {
         return adoptRef(new ByteBuffer(capacity));
     }
@@ -76,13 +82,28 @@ public:
 
     bool isEmpty() { return m_position == 0; }
 
+    int size() const { return m_position; }
+
+    int capacity() const { return m_capacity; }
+
+    // Drops the content and the resources referenced by it,
+    // so that the buffer can be encoded again.
+    void reset() {
+        m_position = 0;
+        m_refList.clear();
+        m_nio_holder.clear();
+    }
+
+    void setPool(RefPtr<ByteBufferPool>&& pool) { m_pool = WTFMove(pool); }
+    RefPtr<ByteBufferPool> takePool() { return std::exchange(m_pool, nullptr); }
+
     ~ByteBuffer() {
-        delete[] m_buffer;
+        fastAlignedFree(m_buffer);
     }
 
 private:
     ByteBuffer(int capacity) :
-        m_buffer(new char[capacity]),
+        m_buffer(static_cast<char*>(fastAlignedMalloc(BUFFER_ALIGNMENT, capacity))),
         m_capacity(capacity),
         m_position(0)
     {}
@@ -92,6 +113,49 @@ private:
     int m_position;
     JGObject m_nio_holder;
     Vector< RefPtr<RQRef> > m_refList;
+    // The pool to return the buffer to, set only while the buffer is in use
+    // (being encoded or processed on the java side).
+    RefPtr<ByteBufferPool> m_pool;
+};
+
+/*
+ * A bounded per-queue pool of ByteBuffers. Instead of being freed, a buffer
+ * released by the java side (see WCRenderQueue.twkRelease) is reset and kept
+ * for the next flush of the queue it came from. Buffers of non-standard size
+ * (a single command larger than the queue capacity) are never pooled.
+ *
+ * Both acquisition and recycling happen on the Event thread, so no locking is required.
+ */
+class ByteBufferPool : public RefCounted<ByteBufferPool> {
+    RQ_LOG_INSTANCE_COUNT(ByteBufferPool)
+public:
+    struct Statistics {
+        size_t buffersInFlight { 0 };
+        size_t hits { 0 };
+        size_t misses { 0 };
+        size_t bytes { 0 };
+        size_t peakBytes { 0 };
+    };
+
+    static RefPtr<ByteBufferPool> create(int bufferCapacity, size_t maxPooledBuffers) {
+        return adoptRef(new ByteBufferPool(bufferCapacity, maxPooledBuffers));
+    }
+
+    RefPtr<ByteBuffer> acquire(int size);
+    void recycle(RefPtr<ByteBuffer>&& buffer);
+
+    const Statistics& statistics() const { return m_statistics; }
+
+private:
+    ByteBufferPool(int bufferCapacity, size_t maxPooledBuffers) :
+        m_bufferCapacity(bufferCapacity),
+        m_maxPooledBuffers(maxPooledBuffers)
+    {}
+
+    int m_bufferCapacity;
+    size_t m_maxPooledBuffers;
+    Vector< RefPtr<ByteBuffer> > m_freeBuffers;
+    Statistics m_statistics;
 };
 
 /*
@@ -109,6 +173,13 @@ class RenderingQueue : public RefCounted<RenderingQueue> {
 public:
     static const size_t MAX_BUFFER_COUNT = 8;
 
+    struct FrameStatistics {
+        int commands { 0 };
+        int bytes { 0 };
+        int buffers { 0 };
+        Seconds encodeTime;
+    };
+
     static RefPtr<RenderingQueue> create(
         const JLObject &jRQ,
         int capacity,
@@ -134,6 +205,16 @@ public:
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
+    /*
+     * Starts a frame: until commitFrame() is called, the filled buffers are
+     * kept on the native side instead of being handed over one by one, and
+     * they all reach the java queue in a single call when the frame is
+     * committed, together with the statistics of the frame.
+     */
+    void beginFrame();
+    void commitFrame();
+    const FrameStatistics& frameStatistics() const { return m_frameStatistics; }
+
     bool isEmpty() {
         return m_buffer == nullptr || m_buffer->isEmpty();
     }
@@ -148,16 +229,20 @@ public:
         return m_rqoRenderingQueue;
     }
 
-    ~RenderingQueue() {
-        disposeGraphics();
+    const ByteBufferPool::Statistics& bufferPoolStatistics() const {
+        return m_bufferPool->statistics();
     }
 
+    ~RenderingQueue();
+
 private:
     RenderingQueue(const JLObject& jRQ, int capacity, bool autoFlush) :
         m_rqoRenderingQueue(RQRef::create(jRQ)),
         m_capacity(capacity),
         m_autoFlush(autoFlush),
-        m_buffer(nullptr)
+        m_buffer(nullptr),
+        m_bufferPool(ByteBufferPool::create(capacity, MAX_BUFFER_COUNT)),
+        m_inFrame(false)
     {}
 
     void flush();
@@ -170,6 +255,11 @@ private:
     int m_capacity;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
+    RefPtr<ByteBufferPool> m_bufferPool;
 
+    bool m_inFrame;
+    Vector< RefPtr<ByteBuffer> > m_frameBuffers; // filled, not yet committed
+    MonotonicTime m_frameStart;
+    FrameStatistics m_frameStatistics;
 };
 } // namespace WebCore
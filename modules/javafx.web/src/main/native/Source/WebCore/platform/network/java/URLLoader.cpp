@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,8 @@
 #include "com_sun_webkit_LoadListenerClient.h"
 #include "com_sun_webkit_network_URLLoaderBase.h"
 #include <wtf/CompletionHandler.h>
+#include <wtf/MainThread.h>
+#include <wtf/ThreadSafeRefCounted.h>
 
 namespace WebCore {
 class Page;
@@ -66,6 +68,9 @@ static JGClass formDataElementClass;
 static jmethodID createFromFileMethod;
 static jmethodID createFromByteArrayMethod;
 
+static JGClass byteBufferPoolClass;
+static jmethodID recycleMethod;
+
 static void initRefs(JNIEnv* env)
 {
     if (!networkContextClass) {
@@ -108,8 +113,64 @@ static void initRefs(JNIEnv* env)
                 "Lcom/sun/webkit/network/FormDataElement;");
         ASSERT(createFromFileMethod);
     }
+    if (!byteBufferPoolClass) {
+        byteBufferPoolClass = JLClass(env->FindClass(
+                "com/sun/webkit/network/ByteBufferPool"));
+        ASSERT(byteBufferPoolClass);
+
+        recycleMethod = env->GetMethodID(
+                byteBufferPoolClass,
+                "recycle",
+                "(Ljava/nio/ByteBuffer;)V");
+        ASSERT(recycleMethod);
+    }
 }
 
+// A direct ByteBuffer whose content is used by WebCore without copying.
+// The buffer is handed back to its pool once the last SharedBuffer
+// referencing it goes away.
+class AdoptedByteBuffer : public ThreadSafeRefCounted<AdoptedByteBuffer> {
+public:
+    static Ref<AdoptedByteBuffer> create(JNIEnv* env, jobject byteBuffer, jobject pool,
+                                         const uint8_t* data, size_t size)
+    {
+        return adoptRef(*new AdoptedByteBuffer(env, byteBuffer, pool, data, size));
+    }
+
+    ~AdoptedByteBuffer()
+    {
+        // The last reference may be dropped on a thread not attached to
+        // the JVM, so the buffer is recycled on the main thread.
+        ensureOnMainThread([byteBuffer = m_byteBuffer, pool = m_pool] {
+            JNIEnv* env = WTF::GetJavaEnv();
+            if (!env)
+                return;
+            env->CallVoidMethod(pool, recycleMethod, byteBuffer);
+            WTF::CheckAndClearException(env);
+            env->DeleteGlobalRef(byteBuffer);
+            env->DeleteGlobalRef(pool);
+        });
+    }
+
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    AdoptedByteBuffer(JNIEnv* env, jobject byteBuffer, jobject pool,
+                      const uint8_t* data, size_t size)
+        : m_byteBuffer(env->NewGlobalRef(byteBuffer))
+        , m_pool(env->NewGlobalRef(pool))
+        , m_data(data)
+        , m_size(size)
+    {
+    }
+
+    jobject m_byteBuffer;
+    jobject m_pool;
+    const uint8_t* m_data;
+    size_t m_size;
+};
+
 }
 
 URLLoader::URLLoader()
@@ -497,19 +558,32 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveRe
     target->didReceiveResponse(response);
 }
 
-JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveData
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveData
   (JNIEnv* env, jclass, jobject byteBuffer, jint position, jint remaining,
-   jlong data)
+   jobject pool, jlong data)
 {
     using namespace WebCore;
+    using namespace URLLoaderJavaInternal;
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
     const uint8_t* address =
-            static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<FragmentedSharedBuffer> tmp_buf = FragmentedSharedBuffer::create(address,remaining);
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+            static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer)) + position;
+
+    // Mostly empty buffers are copied rather than kept alive by WebCore.
+    if (!pool || remaining < env->GetDirectBufferCapacity(byteBuffer) / 2) {
+        target->didReceiveData(SharedBuffer::create(address, remaining).ptr(), remaining);
+        return JNI_FALSE;
+    }
+
+    initRefs(env);
+    auto adopted = AdoptedByteBuffer::create(env, byteBuffer, pool, address, remaining);
+    auto buffer = SharedBuffer::create(DataSegment::Provider {
+        [adopted = adopted.copyRef()] { return adopted->data(); },
+        [adopted = adopted.copyRef()] { return adopted->size(); }
+    });
+    target->didReceiveData(buffer.ptr(), remaining);
+    return JNI_TRUE;
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -267,6 +267,7 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
     // Will be deleted by GraphicsContext destructor
     PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
     GraphicsContextJava gc(ppgc);
+    gc.platformContext()->rq().beginFrame();
 
     // TODO: Following JS synchronization is not necessary for single thread model
     JSGlobalContextRef globalContext = toGlobalRef(localFrame->script().globalObject(mainThreadNormalWorld()));
@@ -277,7 +278,7 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
         drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 0, 255, 128 });
     }
 
-    gc.platformContext()->rq().flushBuffer();
+    gc.platformContext()->rq().commitFrame();
 }
 
 void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
@@ -291,6 +292,7 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
     // Will be deleted by GraphicsContext destructor
     PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
     GraphicsContextJava gc(ppgc);
+    gc.platformContext()->rq().beginFrame();
 
     if (m_rootLayer) {
         if (m_syncLayers) {
@@ -310,7 +312,7 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
         m_page->inspectorController().drawHighlight(gc);
     }
 
-    gc.platformContext()->rq().flushBuffer();
+    gc.platformContext()->rq().commitFrame();
 }
 
 void WebPage::scroll(const IntSize& scrollDelta,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -162,6 +162,66 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasPointInPath() {
+        final String htmlCanvasContent = "<canvas id='canvas' width='200' height='200'></canvas> <script>" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "ctx.beginPath();" +
+                "ctx.moveTo(10, 10);" +
+                "ctx.lineTo(110, 10);" +
+                "ctx.quadraticCurveTo(160, 60, 110, 110);" +
+                "ctx.arc(60, 110, 50, 0, Math.PI, false);" +
+                "ctx.closePath();" +
+                "ctx.rect(40, 40, 40, 40);" +
+                "</script>";
+
+        loadContent(htmlCanvasContent);
+        submit(() -> {
+            final String ctx = "document.getElementById('canvas').getContext('2d')";
+            assertEquals(Boolean.TRUE, getEngine().executeScript(ctx + ".isPointInPath(20, 20)"), "Inside");
+            assertEquals(Boolean.TRUE, getEngine().executeScript(ctx + ".isPointInPath(60, 150)"), "Inside arc");
+            assertEquals(Boolean.FALSE, getEngine().executeScript(ctx + ".isPointInPath(150, 150)"), "Outside");
+            assertEquals(Boolean.FALSE, getEngine().executeScript(ctx + ".isPointInPath(60, 60, 'evenodd')"), "Hole, evenodd");
+            assertEquals(Boolean.TRUE, getEngine().executeScript(ctx + ".isPointInPath(60, 60, 'nonzero')"), "Hole, nonzero");
+        });
+    }
+
+    @Test public void testCanvasPointInStroke() {
+        final String htmlCanvasContent = "<canvas id='canvas' width='200' height='200'></canvas> <script>" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "ctx.lineWidth = 10;" +
+                "ctx.beginPath();" +
+                "ctx.moveTo(20, 20);" +
+                "ctx.lineTo(120, 20);" +
+                "ctx.lineTo(120, 120);" +
+                "</script>";
+
+        loadContent(htmlCanvasContent);
+        submit(() -> {
+            final String ctx = "document.getElementById('canvas').getContext('2d')";
+            assertEquals(Boolean.TRUE, getEngine().executeScript(ctx + ".isPointInStroke(70, 23)"), "On the first segment");
+            assertEquals(Boolean.TRUE, getEngine().executeScript(ctx + ".isPointInStroke(124, 16)"), "Miter join");
+            assertEquals(Boolean.FALSE, getEngine().executeScript(ctx + ".isPointInStroke(70, 70)"), "Far from the stroke");
+            assertEquals(Boolean.FALSE, getEngine().executeScript(ctx + ".isPointInStroke(14, 20)"), "Beyond the butt cap");
+        });
+    }
+
+    @Test public void testCanvasEllipse() {
+        final String htmlCanvasContent = "<canvas id='canvas' width='200' height='200'></canvas> <script>" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "ctx.beginPath();" +
+                "ctx.ellipse(100, 100, 80, 40, Math.PI / 2, 0, 2 * Math.PI);" +
+                "ctx.fillStyle = 'red';" +
+                "ctx.fill();" +
+                "</script>";
+
+        loadContent(htmlCanvasContent);
+        submit(() -> {
+            final String ctx = "document.getElementById('canvas').getContext('2d')";
+            assertEquals(255, (int) getEngine().executeScript(ctx + ".getImageData(100, 30, 1, 1).data[0]"), "Inside the rotated ellipse");
+            assertEquals(0, (int) getEngine().executeScript(ctx + ".getImageData(30, 100, 1, 1).data[0]"), "Outside the rotated ellipse");
+        });
+    }
+
     private BufferedImage htmlCanvasToBufferedImage(final String mime) throws Exception {
         ByteArrayOutputStream errStream = new ByteArrayOutputStream();
         System.setErr(new PrintStream(errStream));
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Correctness check and micro benchmark for the Decora box blur and box
+ * shadow kernels in native-decora/SSEKernels.cc.
+ *
+ * Every kernel level supported by the CPU is checked for bit-exact results
+ * against the scalar reference on random images, and then timed on a
+ * 1024x1024 image for a few blur sizes.  Build and run from the top of the
+ * repository with:
+ *
+ *   g++ -O2 -ffast-math -Imodules/javafx.graphics/src/main/native-decora \
+ *       tests/performance/decora/BoxBlurBench/src/BoxBlurBench.cc \
+ *       modules/javafx.graphics/src/main/native-decora/SSEKernels.cc \
+ *       -o BoxBlurBench && ./BoxBlurBench
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "SSEKernels.h"
+
+static const char *levelNames[] = { "scalar", "sse2", "avx2" };
+
+static std::vector<int32_t> randomImage(std::mt19937 &rng, int w, int h, int scan)
+{
+    std::vector<int32_t> pixels((size_t) scan * h);
+    for (size_t i = 0; i < pixels.size(); i++) {
+        pixels[i] = (int32_t) rng();
+    }
+    return pixels;
+}
+
+static bool samePixels(const std::vector<int32_t> &a, const std::vector<int32_t> &b,
+                       int w, int h, int scan)
+{
+    for (int y = 0; y < h; y++) {
+        if (memcmp(&a[(size_t) y * scan], &b[(size_t) y * scan], w * sizeof(int32_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static BoxShadowParams shadowParams(int ksize, float spread, const float color[4])
+{
+    int32_t amax = ksize * 255;
+    amax += (int32_t) ((255 - amax) * spread);
+    int32_t kscale = 0x7fffffff / amax;
+    BoxShadowParams params;
+    params.amin = amax / 255;
+    params.amax = amax;
+    params.kscalea = (int32_t) (kscale * color[3]);
+    params.kscaler = (int32_t) (kscale * color[0]);
+    params.kscaleg = (int32_t) (kscale * color[1]);
+    params.kscaleb = (int32_t) (kscale * color[2]);
+    params.shadowRGB =
+        (((int32_t) (color[0] * 255)) << 16) |
+        (((int32_t) (color[1] * 255)) <<  8) |
+        (((int32_t) (color[2] * 255))      ) |
+        (((int32_t) (color[3] * 255)) << 24);
+    return params;
+}
+
+static int checkLevel(int level, std::mt19937 &rng)
+{
+    const float color[4] = { 0.25f, 0.5f, 0.75f, 0.8f };
+    int failures = 0;
+    for (int iter = 0; iter < 200; iter++) {
+        int srcw = 1 + (int) (rng() % 67);
+        int srch = 1 + (int) (rng() % 67);
+        int ksize = 1 + (int) (rng() % 31);
+        int srcscan = srcw + (int) (rng() % 5);
+        std::vector<int32_t> src = randomImage(rng, srcw, srch, srcscan);
+
+        // Horizontal blur: dst is srcw + ksize - 1 wide.
+        int dstw = srcw + ksize - 1;
+        int dstscan = dstw + 3;
+        std::vector<int32_t> ref((size_t) dstscan * srch), out((size_t) dstscan * srch);
+        boxBlurHorizontal(KERNEL_LEVEL_SCALAR, &ref[0], dstw, srch, dstscan, &src[0], srcw, srcscan);
+        boxBlurHorizontal(level, &out[0], dstw, srch, dstscan, &src[0], srcw, srcscan);
+        if (!samePixels(ref, out, dstw, srch, dstscan)) {
+            printf("boxBlurHorizontal %s mismatch: %dx%d k=%d\n", levelNames[level], srcw, srch, ksize);
+            failures++;
+        }
+
+        // Vertical blur and shadow: dst is srch + ksize - 1 tall.
+        int dsth = srch + ksize - 1;
+        dstscan = srcw + 2;
+        ref.assign((size_t) dstscan * dsth, 0);
+        out.assign((size_t) dstscan * dsth, 0);
+        boxBlurVertical(KERNEL_LEVEL_SCALAR, &ref[0], srcw, dsth, dstscan, &src[0], srch, srcscan);
+        boxBlurVertical(level, &out[0], srcw, dsth, dstscan, &src[0], srch, srcscan);
+        if (!samePixels(ref, out, srcw, dsth, dstscan)) {
+            printf("boxBlurVertical %s mismatch: %dx%d k=%d\n", levelNames[level], srcw, srch, ksize);
+            failures++;
+        }
+
+        BoxShadowParams params = shadowParams(ksize, (rng() % 4) * 0.25f, color);
+        boxShadowVertical(KERNEL_LEVEL_SCALAR, &ref[0], srcw, dsth, dstscan, &src[0], srch, srcscan, &params);
+        boxShadowVertical(level, &out[0], srcw, dsth, dstscan, &src[0], srch, srcscan, &params);
+        if (!samePixels(ref, out, srcw, dsth, dstscan)) {
+            printf("boxShadowVertical %s mismatch: %dx%d k=%d\n", levelNames[level], srcw, srch, ksize);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+template <typename Kernel>
+static double timeMillis(Kernel kernel)
+{
+    const int reps = 20;
+    kernel();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < reps; i++) {
+        kernel();
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / reps;
+}
+
+static void benchLevel(int level, std::mt19937 &rng)
+{
+    const int size = 1024;
+    const float color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    std::vector<int32_t> src = randomImage(rng, size, size, size);
+    for (int ksize : { 3, 9, 31 }) {
+        int dim = size + ksize - 1;
+        std::vector<int32_t> dst((size_t) dim * dim);
+        BoxShadowParams params = shadowParams(ksize, 0.0f, color);
+        double h = timeMillis([&] {
+            boxBlurHorizontal(level, &dst[0], dim, size, dim, &src[0], size, size);
+        });
+        double v = timeMillis([&] {
+            boxBlurVertical(level, &dst[0], size, dim, size, &src[0], size, size);
+        });
+        double s = timeMillis([&] {
+            boxShadowVertical(level, &dst[0], size, dim, size, &src[0], size, size, &params);
+        });
+        printf("%-6s k=%-2d  blurH %7.3f ms  blurV %7.3f ms  shadowV %7.3f ms\n",
+               levelNames[level], ksize, h, v, s);
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(12345);
+    int maxLevel = getKernelLevel();
+    printf("CPU kernel level: %s\n", levelNames[maxLevel]);
+
+    int failures = 0;
+    for (int level = KERNEL_LEVEL_SSE2; level <= maxLevel; level++) {
+        failures += checkLevel(level, rng);
+    }
+    if (failures != 0) {
+        printf("%d mismatches against the scalar kernels\n", failures);
+        return 1;
+    }
+    printf("All kernel levels match the scalar kernels\n");
+
+    for (int level = KERNEL_LEVEL_SCALAR; level <= maxLevel; level++) {
+        benchLevel(level, rng);
+    }
+    return 0;
+}
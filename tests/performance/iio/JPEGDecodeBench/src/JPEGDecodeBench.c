@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Decode throughput benchmark for the scanline delivery of the JPEG loader
+ * (decompressIndirect in native-iio/jpegloader.c).
+ *
+ * A fixed corpus of images is encoded in memory with the bundled libjpeg:
+ * the same synthetic content at several sizes (including odd widths),
+ * chroma subsamplings, qualities and decode scales. Each image is decoded
+ * reading one scanline at a time, and reading batches of up to
+ * ROW_BATCH_BYTES (at most MAX_BATCH_ROWS rows) into a staging buffer that
+ * is then copied to the output the way decompressIndirect copies it into
+ * the Java array. The decoded pixels must be identical, and the decode
+ * throughput of the whole corpus is reported for both. Build and run from
+ * the top of the repository with:
+ *
+ *   D=modules/javafx.graphics/src/main/native-iio
+ *   gcc -O2 -I$D/libjpeg \
+ *       tests/performance/iio/JPEGDecodeBench/src/JPEGDecodeBench.c \
+ *       $D/libjpeg/j*.c -o JPEGDecodeBench && \
+ *   ./JPEGDecodeBench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <jpeglib.h>
+
+/* Same limits as decompressIndirect */
+#define ROW_BATCH_BYTES (64 * 1024)
+#define MAX_BATCH_ROWS  64
+#define ITERATIONS 5
+
+typedef struct {
+    int width;
+    int height;
+    int hsamp;      /* luma sampling factors; chroma is always 1x1 */
+    int vsamp;
+    int quality;
+    int scaleDenom;
+} ImageSpec;
+
+static const ImageSpec corpus[] = {
+    { 1920, 1080, 2, 2, 90, 1 },
+    { 1920, 1080, 2, 1, 75, 1 },
+    { 1920, 1080, 1, 1, 95, 1 },
+    { 1001,  777, 2, 2, 85, 1 },
+    {  640,  480, 2, 2, 75, 2 },
+    { 4000, 3000, 2, 2, 80, 4 },
+    {   17,   33, 2, 2, 90, 1 },
+    {   15,    9, 1, 1, 50, 1 },
+};
+#define NUM_IMAGES (sizeof(corpus) / sizeof(corpus[0]))
+
+static unsigned int seed = 12345;
+
+static int
+nextRandom() {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7fff;
+}
+
+/*
+ * Smooth gradients with noise and hard edges, so that the reconstructed
+ * chroma covers the whole range and the results need clamping.
+ */
+static unsigned char*
+makeImage(int w, int h) {
+    unsigned char* rgb = malloc((size_t) w * h * 3);
+    int x, y;
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            unsigned char* p = rgb + ((size_t) y * w + x) * 3;
+            int edge = ((x / 37) + (y / 23)) & 1;
+            int noise = nextRandom() & 31;
+            p[0] = (unsigned char) (edge ? 255 - (x * 255 / w) : noise);
+            p[1] = (unsigned char) ((y * 255 / h + noise) & 255);
+            p[2] = (unsigned char) (edge ? noise * 8 : (x + y) & 255);
+        }
+    }
+    return rgb;
+}
+
+/*
+ * The bundled libjpeg does not include the jdatasrc.c and jdatadst.c
+ * memory managers, so minimal ones are defined here.
+ */
+
+typedef struct {
+    struct jpeg_destination_mgr pub;
+    unsigned char* buffer;
+    size_t capacity;
+} MemDest;
+
+static void
+initDest(j_compress_ptr cinfo) {
+    MemDest* dest = (MemDest*) cinfo->dest;
+    dest->pub.next_output_byte = dest->buffer;
+    dest->pub.free_in_buffer = dest->capacity;
+}
+
+static boolean
+growDest(j_compress_ptr cinfo) {
+    MemDest* dest = (MemDest*) cinfo->dest;
+    size_t used = dest->capacity;
+    dest->capacity *= 2;
+    dest->buffer = realloc(dest->buffer, dest->capacity);
+    dest->pub.next_output_byte = dest->buffer + used;
+    dest->pub.free_in_buffer = dest->capacity - used;
+    return TRUE;
+}
+
+static void
+termDest(j_compress_ptr cinfo) {
+}
+
+static void
+initSource(j_decompress_ptr cinfo) {
+}
+
+static boolean
+fillSource(j_decompress_ptr cinfo) {
+    static const JOCTET eoi[2] = { 0xFF, JPEG_EOI };
+    cinfo->src->next_input_byte = eoi;
+    cinfo->src->bytes_in_buffer = 2;
+    return TRUE;
+}
+
+static void
+skipSource(j_decompress_ptr cinfo, long count) {
+    if (count > (long) cinfo->src->bytes_in_buffer) {
+        count = (long) cinfo->src->bytes_in_buffer;
+    }
+    cinfo->src->next_input_byte += count;
+    cinfo->src->bytes_in_buffer -= count;
+}
+
+static void
+termSource(j_decompress_ptr cinfo) {
+}
+
+static unsigned char*
+encode(const ImageSpec* spec, unsigned long* size) {
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    unsigned char* rgb = makeImage(spec->width, spec->height);
+    MemDest dest;
+    JSAMPROW row;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    dest.pub.init_destination = initDest;
+    dest.pub.empty_output_buffer = growDest;
+    dest.pub.term_destination = termDest;
+    dest.capacity = 64 * 1024;
+    dest.buffer = malloc(dest.capacity);
+    cinfo.dest = &dest.pub;
+    cinfo.image_width = spec->width;
+    cinfo.image_height = spec->height;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, spec->quality, TRUE);
+    cinfo.comp_info[0].h_samp_factor = spec->hsamp;
+    cinfo.comp_info[0].v_samp_factor = spec->vsamp;
+    jpeg_start_compress(&cinfo, TRUE);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        row = rgb + (size_t) cinfo.next_scanline * spec->width * 3;
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    *size = dest.capacity - dest.pub.free_in_buffer;
+    jpeg_destroy_compress(&cinfo);
+    free(rgb);
+    return dest.buffer;
+}
+
+/*
+ * Decodes into dst, which must hold the whole output image, reading
+ * scanlines in batches of at most maxRows rows into a staging buffer.
+ * Returns the number of output pixels.
+ */
+static long
+decode(const unsigned char* jpg, unsigned long size, int scaleDenom,
+       int maxRows, unsigned char* dst) {
+    struct jpeg_decompress_struct cinfo;
+    struct jpeg_error_mgr jerr;
+    struct jpeg_source_mgr src;
+    JSAMPROW rows[MAX_BATCH_ROWS];
+    unsigned char* staging;
+    long pixels;
+    int stride, batchRows, i;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    src.init_source = initSource;
+    src.fill_input_buffer = fillSource;
+    src.skip_input_data = skipSource;
+    src.resync_to_restart = jpeg_resync_to_restart;
+    src.term_source = termSource;
+    src.next_input_byte = jpg;
+    src.bytes_in_buffer = size;
+    cinfo.src = &src;
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = scaleDenom;
+    jpeg_start_decompress(&cinfo);
+    stride = cinfo.output_width * cinfo.output_components;
+
+    batchRows = ROW_BATCH_BYTES / stride;
+    if (batchRows > maxRows) {
+        batchRows = maxRows;
+    }
+    if (batchRows < 1) {
+        batchRows = 1;
+    }
+    staging = malloc((size_t) batchRows * stride);
+    for (i = 0; i < batchRows; i++) {
+        rows[i] = staging + (size_t) i * stride;
+    }
+
+    while (cinfo.output_scanline < cinfo.output_height) {
+        JDIMENSION first = cinfo.output_scanline;
+        int n = 0;
+        while (n < batchRows && cinfo.output_scanline < cinfo.output_height) {
+            n += jpeg_read_scanlines(&cinfo, rows + n, batchRows - n);
+        }
+        memcpy(dst + (size_t) first * stride, staging, (size_t) n * stride);
+    }
+    pixels = (long) cinfo.output_width * cinfo.output_height;
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    free(staging);
+    return pixels;
+}
+
+static double
+now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main() {
+    static const int modes[] = { 1, MAX_BATCH_ROWS };
+    static const char* modeNames[] = { "row", "batched" };
+    unsigned char* jpg[NUM_IMAGES];
+    unsigned long size[NUM_IMAGES];
+    size_t maxBytes = 0;
+    unsigned char* expected;
+    unsigned char* actual;
+    int failures = 0;
+    int m, it;
+    size_t n;
+
+    for (n = 0; n < NUM_IMAGES; n++) {
+        size_t bytes = (size_t) corpus[n].width * corpus[n].height * 3;
+        jpg[n] = encode(&corpus[n], &size[n]);
+        if (bytes > maxBytes) {
+            maxBytes = bytes;
+        }
+    }
+    expected = malloc(maxBytes);
+    actual = malloc(maxBytes);
+
+    for (n = 0; n < NUM_IMAGES; n++) {
+        long pixels = decode(jpg[n], size[n], corpus[n].scaleDenom, 1, expected);
+        memset(actual, 0xA5, maxBytes);
+        decode(jpg[n], size[n], corpus[n].scaleDenom, MAX_BATCH_ROWS, actual);
+        if (memcmp(expected, actual, (size_t) pixels * 3) != 0) {
+            printf("FAILED: %dx%d h%dv%d q%d 1/%d differs when batched\n",
+                   corpus[n].width, corpus[n].height,
+                   corpus[n].hsamp, corpus[n].vsamp, corpus[n].quality,
+                   corpus[n].scaleDenom);
+            failures++;
+        }
+    }
+
+    for (m = 0; m < 2; m++) {
+        long pixels = 0;
+        double start = now();
+        double elapsed;
+        for (it = 0; it < ITERATIONS; it++) {
+            for (n = 0; n < NUM_IMAGES; n++) {
+                pixels += decode(jpg[n], size[n], corpus[n].scaleDenom,
+                                 modes[m], actual);
+            }
+        }
+        elapsed = now() - start;
+        printf("%-8s %8.1f Mpixels/s\n", modeNames[m],
+               pixels / elapsed / 1e6);
+    }
+
+    for (n = 0; n < NUM_IMAGES; n++) {
+        free(jpg[n]);
+    }
+    free(expected);
+    free(actual);
+    printf(failures == 0 ? "PASSED\n" : "FAILED\n");
+    return failures == 0 ? 0 : 1;
+}
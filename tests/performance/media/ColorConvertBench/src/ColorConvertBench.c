@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Regression test and throughput benchmark for ColorConvert_Rows() of the
+ * jfxmedia color converter (jfxmedia/Utils/ColorConverter.c).
+ *
+ * Every source layout is built from the same random 4:2:0 frame: NV12
+ * interleaves its chroma, P010 shifts every sample left by 8, YUY2 and
+ * UYVY repeat each chroma row twice. All of them must then convert to the
+ * same pixels as the SSE2 ColorConvert_YCbCr420p_*_no_alpha() functions,
+ * at every SIMD level supported by the CPU and when converted in stripes.
+ * P010 is also checked with random 10 bit samples across the levels.
+ * The throughput is then reported per resolution, layout, level and number
+ * of stripe threads. Build and run from the top of the repository with:
+ *
+ *   D=modules/javafx.media/src/main/native/jfxmedia
+ *   gcc -O2 -DLINUX -I$D -I$D/Utils \
+ *       tests/performance/media/ColorConvertBench/src/ColorConvertBench.c \
+ *       $D/Utils/ColorConverter.c -lpthread -o ColorConvertBench && \
+ *   ./ColorConvertBench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <ColorConverter.h>
+
+#define MAX_THREADS 8
+#define MIN_SECONDS 0.5
+
+typedef struct {
+    int width;
+    int height;
+} FrameSize;
+
+static const FrameSize checkSizes[] = {
+    { 1920, 1080 },
+    { 1998,  100 },
+    {   18,    6 },
+    {    2,    2 },
+};
+
+static const FrameSize benchSizes[] = {
+    { 1280,  720 },
+    { 1920, 1080 },
+    { 3840, 2160 },
+};
+
+#define NUM_CHECK_SIZES (sizeof(checkSizes) / sizeof(checkSizes[0]))
+#define NUM_BENCH_SIZES (sizeof(benchSizes) / sizeof(benchSizes[0]))
+#define NUM_FORMATS 5
+
+static const char* formatNames[NUM_FORMATS] = {
+    "I420", "NV12", "P010", "YUY2", "UYVY"
+};
+
+typedef struct {
+    int width;
+    int height;
+    /* 4:2:0 planes every layout is derived from */
+    unsigned char* y;
+    unsigned char* u;
+    unsigned char* v;
+    int yStride;
+    int cStride;
+    unsigned char* data[NUM_FORMATS][2];
+    ColorConvertSource source[NUM_FORMATS];
+} Frame;
+
+static unsigned int seed = 12345;
+
+static int
+nextRandom() {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7fff;
+}
+
+/* Strides are padded and odd so that nothing happens to be aligned. */
+static void
+makeFrame(Frame* f, int w, int h) {
+    int cw = w / 2, ch = h / 2;
+    int x, j, k;
+
+    f->width = w;
+    f->height = h;
+    f->yStride = w + 7;
+    f->cStride = cw + 5;
+    f->y = malloc((size_t) f->yStride * h);
+    f->u = malloc((size_t) f->cStride * ch);
+    f->v = malloc((size_t) f->cStride * ch);
+    for (j = 0; j < h; j++) {
+        for (x = 0; x < w; x++) {
+            f->y[j * f->yStride + x] = (unsigned char) nextRandom();
+        }
+    }
+    for (j = 0; j < ch; j++) {
+        for (x = 0; x < cw; x++) {
+            f->u[j * f->cStride + x] = (unsigned char) nextRandom();
+            f->v[j * f->cStride + x] = (unsigned char) nextRandom();
+        }
+    }
+
+    for (k = 0; k < NUM_FORMATS; k++) {
+        ColorConvertSource* s = &f->source[k];
+        memset(s, 0, sizeof(*s));
+        s->format = k;
+        s->width = w;
+        s->height = h;
+    }
+
+    f->source[COLOR_CONVERT_YCbCr420p].planes[0] = f->y;
+    f->source[COLOR_CONVERT_YCbCr420p].planes[1] = f->u;
+    f->source[COLOR_CONVERT_YCbCr420p].planes[2] = f->v;
+    f->source[COLOR_CONVERT_YCbCr420p].strides[0] = f->yStride;
+    f->source[COLOR_CONVERT_YCbCr420p].strides[1] = f->cStride;
+    f->source[COLOR_CONVERT_YCbCr420p].strides[2] = f->cStride;
+    f->data[COLOR_CONVERT_YCbCr420p][0] = f->data[COLOR_CONVERT_YCbCr420p][1] = NULL;
+
+    {
+        ColorConvertSource* s = &f->source[COLOR_CONVERT_NV12];
+        unsigned char* uv = malloc((size_t) (w + 3) * ch);
+        for (j = 0; j < ch; j++) {
+            for (x = 0; x < cw; x++) {
+                uv[j * (w + 3) + 2 * x] = f->u[j * f->cStride + x];
+                uv[j * (w + 3) + 2 * x + 1] = f->v[j * f->cStride + x];
+            }
+        }
+        s->planes[0] = f->y;
+        s->planes[1] = uv;
+        s->strides[0] = f->yStride;
+        s->strides[1] = w + 3;
+        f->data[COLOR_CONVERT_NV12][0] = uv;
+        f->data[COLOR_CONVERT_NV12][1] = NULL;
+    }
+
+    {
+        ColorConvertSource* s = &f->source[COLOR_CONVERT_P010];
+        int ys = w * 2 + 6, cs = w * 2 + 10;
+        unsigned char* y16 = malloc((size_t) ys * h + 2);
+        unsigned char* uv16 = malloc((size_t) cs * ch + 2);
+        for (j = 0; j < h; j++) {
+            unsigned short* row = (unsigned short*) (y16 + 2 + j * ys);
+            for (x = 0; x < w; x++) {
+                row[x] = (unsigned short) (f->y[j * f->yStride + x] << 8);
+            }
+        }
+        for (j = 0; j < ch; j++) {
+            unsigned short* row = (unsigned short*) (uv16 + 2 + j * cs);
+            for (x = 0; x < cw; x++) {
+                row[2 * x] = (unsigned short) (f->u[j * f->cStride + x] << 8);
+                row[2 * x + 1] = (unsigned short) (f->v[j * f->cStride + x] << 8);
+            }
+        }
+        s->planes[0] = y16 + 2;
+        s->planes[1] = uv16 + 2;
+        s->strides[0] = ys;
+        s->strides[1] = cs;
+        f->data[COLOR_CONVERT_P010][0] = y16;
+        f->data[COLOR_CONVERT_P010][1] = uv16;
+    }
+
+    for (k = COLOR_CONVERT_YUY2; k <= COLOR_CONVERT_UYVY; k++) {
+        ColorConvertSource* s = &f->source[k];
+        int stride = w * 2 + 9;
+        int yo = (k == COLOR_CONVERT_YUY2) ? 0 : 1;
+        int uo = (k == COLOR_CONVERT_YUY2) ? 1 : 0;
+        unsigned char* p = malloc((size_t) stride * h);
+        for (j = 0; j < h; j++) {
+            unsigned char* row = p + j * stride;
+            for (x = 0; x < cw; x++) {
+                row[4 * x + yo] = f->y[j * f->yStride + 2 * x];
+                row[4 * x + yo + 2] = f->y[j * f->yStride + 2 * x + 1];
+                row[4 * x + uo] = f->u[(j / 2) * f->cStride + x];
+                row[4 * x + uo + 2] = f->v[(j / 2) * f->cStride + x];
+            }
+        }
+        s->planes[0] = p;
+        s->strides[0] = stride;
+        f->data[k][0] = p;
+        f->data[k][1] = NULL;
+    }
+}
+
+static void
+freeFrame(Frame* f) {
+    int k;
+    free(f->y);
+    free(f->u);
+    free(f->v);
+    for (k = 0; k < NUM_FORMATS; k++) {
+        free(f->data[k][0]);
+        free(f->data[k][1]);
+    }
+}
+
+/* Destination with a 16 byte aligned stride, as allocated by GstVideoFrame. */
+static unsigned char*
+allocDest(int w, int h, int* stride) {
+    void* p = NULL;
+    *stride = (w * 4 + 15) & ~15;
+    if (posix_memalign(&p, 16, (size_t) *stride * h) != 0) {
+        exit(1);
+    }
+    return p;
+}
+
+typedef struct {
+    const ColorConvertSource* source;
+    unsigned char* dst;
+    int stride;
+    int bgra;
+    int first;
+    int count;
+    int status;
+} Stripe;
+
+static void*
+convertStripe(void* arg) {
+    Stripe* s = (Stripe*) arg;
+    s->status = ColorConvert_Rows(s->source, s->dst, s->stride, s->bgra,
+                                  s->first, s->count);
+    return NULL;
+}
+
+/* Converts the frame in even sized stripes, one per thread. */
+static int
+convert(const ColorConvertSource* source, unsigned char* dst, int stride,
+        int bgra, int threads) {
+    pthread_t tid[MAX_THREADS];
+    Stripe stripes[MAX_THREADS];
+    int rows = ((source->height + threads - 1) / threads + 1) & ~1;
+    int i, n = 0, status = 0;
+
+    for (i = 0; i < threads && i * rows < source->height; i++) {
+        Stripe* s = &stripes[n++];
+        s->source = source;
+        s->dst = dst;
+        s->stride = stride;
+        s->bgra = bgra;
+        s->first = i * rows;
+        s->count = source->height - s->first;
+        if (s->count > rows) {
+            s->count = rows;
+        }
+    }
+    for (i = 1; i < n; i++) {
+        pthread_create(&tid[i], NULL, convertStripe, &stripes[i]);
+    }
+    convertStripe(&stripes[0]);
+    for (i = 1; i < n; i++) {
+        pthread_join(tid[i], NULL);
+    }
+    for (i = 0; i < n; i++) {
+        status |= stripes[i].status;
+    }
+    return status;
+}
+
+static int
+rowsDiffer(const unsigned char* a, const unsigned char* b, int w, int h,
+           int stride) {
+    int j;
+    for (j = 0; j < h; j++) {
+        if (memcmp(a + (size_t) j * stride, b + (size_t) j * stride,
+                   (size_t) w * 4) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static double
+now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static const char*
+levelName(int level) {
+    switch (level) {
+        case COLOR_CONVERT_SIMD_SSE2: return "sse2";
+        case COLOR_CONVERT_SIMD_AVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+static int
+checkFrame(const FrameSize* size, int numLevels) {
+    Frame f;
+    unsigned char *expected, *actual;
+    int stride, bgra, k, l, t, failures = 0;
+
+    makeFrame(&f, size->width, size->height);
+    expected = allocDest(f.width, f.height, &stride);
+    actual = allocDest(f.width, f.height, &stride);
+
+    for (bgra = 0; bgra <= 1; bgra++) {
+        memset(expected, 0xA5, (size_t) stride * f.height);
+        if (bgra) {
+            ColorConvert_YCbCr420p_to_BGRA32_no_alpha(expected, stride,
+                    f.width, f.height, f.y, f.v, f.u,
+                    f.yStride, f.cStride, f.cStride);
+        } else {
+            ColorConvert_YCbCr420p_to_ARGB32_no_alpha(expected, stride,
+                    f.width, f.height, f.y, f.v, f.u,
+                    f.yStride, f.cStride, f.cStride);
+        }
+        for (l = 0; l < numLevels; l++) {
+            ColorConvert_SetSIMDLevel(l);
+            for (k = 0; k < NUM_FORMATS; k++) {
+                for (t = 1; t <= 3; t++) {
+                    memset(actual, 0x5A, (size_t) stride * f.height);
+                    if (convert(&f.source[k], actual, stride, bgra, t) != 0 ||
+                        rowsDiffer(expected, actual, f.width, f.height, stride)) {
+                        printf("FAILED: %dx%d %s %s level %s, %d threads\n",
+                               f.width, f.height, formatNames[k],
+                               bgra ? "BGRA" : "ARGB", levelName(l), t);
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+
+    /* 10 bit samples, which have no 8 bit equivalent */
+    {
+        ColorConvertSource* s = &f.source[COLOR_CONVERT_P010];
+        int j, x;
+        for (j = 0; j < f.height; j++) {
+            unsigned short* row = (unsigned short*) (s->planes[0] + j * s->strides[0]);
+            for (x = 0; x < f.width; x++) {
+                row[x] = (unsigned short) ((nextRandom() & 0x3ff) << 6);
+            }
+        }
+        for (j = 0; j < f.height / 2; j++) {
+            unsigned short* row = (unsigned short*) (s->planes[1] + j * s->strides[1]);
+            for (x = 0; x < f.width; x++) {
+                row[x] = (unsigned short) ((nextRandom() & 0x3ff) << 6);
+            }
+        }
+        ColorConvert_SetSIMDLevel(COLOR_CONVERT_SIMD_NONE);
+        convert(s, expected, stride, 1, 1);
+        for (l = 1; l < numLevels; l++) {
+            ColorConvert_SetSIMDLevel(l);
+            convert(s, actual, stride, 1, 2);
+            if (rowsDiffer(expected, actual, f.width, f.height, stride)) {
+                printf("FAILED: %dx%d 10 bit P010 level %s\n",
+                       f.width, f.height, levelName(l));
+                failures++;
+            }
+        }
+    }
+
+    free(expected);
+    free(actual);
+    freeFrame(&f);
+    return failures;
+}
+
+static void
+benchFrame(const FrameSize* size, int numLevels) {
+    static const int threadCounts[] = { 1, 2, 4 };
+    Frame f;
+    unsigned char* dst;
+    int stride, k, l, t;
+
+    makeFrame(&f, size->width, size->height);
+    dst = allocDest(f.width, f.height, &stride);
+
+    for (k = 0; k < NUM_FORMATS; k++) {
+        for (l = 0; l < numLevels; l++) {
+            ColorConvert_SetSIMDLevel(l);
+            for (t = 0; t < 3; t++) {
+                double start = now();
+                double elapsed;
+                long frames = 0;
+                do {
+                    convert(&f.source[k], dst, stride, 1, threadCounts[t]);
+                    frames++;
+                    elapsed = now() - start;
+                } while (elapsed < MIN_SECONDS);
+                printf("%4dx%-4d %s %-6s %d thread(s) %8.1f Mpixels/s %7.1f fps\n",
+                       f.width, f.height, formatNames[k], levelName(l),
+                       threadCounts[t],
+                       (double) frames * f.width * f.height / elapsed / 1e6,
+                       frames / elapsed);
+            }
+        }
+    }
+
+    free(dst);
+    freeFrame(&f);
+}
+
+int
+main() {
+    int numLevels = ColorConvert_GetSIMDLevel() + 1;
+    int failures = 0;
+    size_t n;
+
+    for (n = 0; n < NUM_CHECK_SIZES; n++) {
+        failures += checkFrame(&checkSizes[n], numLevels);
+    }
+    for (n = 0; n < NUM_BENCH_SIZES; n++) {
+        benchFrame(&benchSizes[n], numLevels);
+    }
+
+    printf(failures == 0 ? "PASSED\n" : "FAILED\n");
+    return failures == 0 ? 0 : 1;
+}
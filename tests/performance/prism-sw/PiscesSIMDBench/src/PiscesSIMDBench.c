@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Pixel-exact regression test and micro benchmark for the vectorized
+ * compositing and paint generation loops of the Prism SW pipeline
+ * (native-prism-sw/PiscesSIMD.c).
+ *
+ * For every SIMD level supported by the CPU, the SRC_OVER blits and the
+ * gradient generators are run on random input at that level and at
+ * SIMD_LEVEL_SCALAR, and the results must be identical. The SSE2 bilinear
+ * interpolation is compared against a copy of the scalar one. Each loop
+ * is then timed at every level. Build and run from the top of the
+ * repository, after the native headers of javafx.graphics have been
+ * generated, with:
+ *
+ *   D=modules/javafx.graphics/src/main/native-prism-sw
+ *   gcc -O2 -DINLINE=inline -I$D \
+ *       -Imodules/javafx.graphics/build/gensrc/headers/javafx.graphics \
+ *       -I$JAVA_HOME/include -I$JAVA_HOME/include/linux \
+ *       tests/performance/prism-sw/PiscesSIMDBench/src/PiscesSIMDBench.c \
+ *       $D/PiscesBlit.c $D/PiscesPaint.c $D/PiscesSIMD.c $D/PiscesUtil.c \
+ *       $D/PiscesSysutils.c $D/PiscesMath.c -lm -o PiscesSIMDBench && \
+ *   ./PiscesSIMDBench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <PiscesBlit.h>
+#include <PiscesRenderer.h>
+#include <PiscesSIMD.h>
+
+#define WIDTH 1024
+#define HEIGHT NUM_ALPHA_ROWS
+#define MAX_COVERAGE 256
+#define ITERATIONS 200
+
+static const char* levelNames[] = { "scalar", "sse2", "avx2" };
+
+static jint dst[WIDTH * HEIGHT];
+static jint paint[WIDTH * HEIGHT];
+static jint rowAA[WIDTH + 1];
+static jbyte mask[WIDTH * HEIGHT];
+static jbyte alphaMap[MAX_COVERAGE + 1];
+static jint colors[GRADIENT_MAP_SIZE];
+
+static unsigned int seed = 1;
+
+static jint
+rnd() {
+    seed = seed * 1103515245u + 12345u;
+    return (jint)(seed >> 1);
+}
+
+static jint
+randomPremultiplied() {
+    jint a = rnd() & 0xff;
+    jint r = (rnd() & 0xff) * a / 255;
+    jint g = (rnd() & 0xff) * a / 255;
+    jint b = (rnd() & 0xff) * a / 255;
+    // bias towards transparent and opaque pixels, the special cases
+    switch (rnd() % 4) {
+    case 0:
+        return 0;
+    case 1:
+        return 0xff000000 | (rnd() & 0xffffff);
+    }
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+static void
+randomPixels(jint* pixels, jint len) {
+    jint i;
+    for (i = 0; i < len; i++) {
+        pixels[i] = randomPremultiplied();
+    }
+}
+
+static void
+randomMask(jint len) {
+    jint i;
+    for (i = 0; i < len; i++) {
+        switch (rnd() % 4) {
+        case 0:
+            mask[i] = 0;
+            break;
+        case 1:
+            mask[i] = (jbyte)0xff;
+            break;
+        default:
+            mask[i] = (jbyte)rnd();
+        }
+    }
+}
+
+/*
+ * Fills the AA accumulation row with deltas whose running sum stays in
+ * 0..MAX_COVERAGE, as produced by the rasterizer.
+ */
+static void
+randomCoverage(jint w) {
+    jint i, sum = 0;
+    for (i = 0; i < w; i++) {
+        jint next = (rnd() % 3 == 0) ? rnd() % (MAX_COVERAGE + 1) : sum;
+        rowAA[i] = next - sum;
+        sum = next;
+    }
+}
+
+static void
+initRenderer(Renderer* rdr, jint level, jint width) {
+    memset(rdr, 0, sizeof(Renderer));
+    rdr->_simdLevel = level;
+    rdr->_data = dst;
+    rdr->_imageScanlineStride = WIDTH;
+    rdr->_imagePixelStride = 1;
+    rdr->_currImageOffset = 0;
+    rdr->_alphaWidth = width;
+    rdr->_minTouched = 0;
+    rdr->_maxTouched = width - 1;
+    rdr->_rowAAInt = rowAA;
+    rdr->alphaMap = alphaMap;
+    rdr->_mask_byteData = mask;
+    rdr->_maskOffset = 0;
+    rdr->_paint = paint;
+    rdr->_paint_length = WIDTH * HEIGHT;
+    memcpy(rdr->_gradient_colors, colors, sizeof(colors));
+}
+
+static void
+randomColor(Renderer* rdr) {
+    rdr->_calpha = (rnd() % 3 == 0) ? 255 : rnd() & 0xff;
+    rdr->_cred = rnd() & 0xff;
+    rdr->_cgreen = rnd() & 0xff;
+    rdr->_cblue = rnd() & 0xff;
+}
+
+static void
+randomGradient(Renderer* rdr) {
+    rdr->_gradient_cycleMethod = rnd() % 3;
+    rdr->_currX = rnd() % 2000 - 1000;
+    rdr->_currY = rnd() % 2000 - 1000;
+    rdr->_lg_mx = (rnd() % 20000 - 10000) / 100.0f;
+    rdr->_lg_my = (rnd() % 20000 - 10000) / 100.0f;
+    rdr->_lg_b = (jfloat)(rnd() % 200000 - 100000);
+    rdr->_rg_a00 = (rnd() % 2000 - 1000) / 1000.0f;
+    rdr->_rg_a01 = (rnd() % 2000 - 1000) / 1000.0f;
+    rdr->_rg_a02 = (jfloat)(rnd() % 2000 - 1000);
+    rdr->_rg_a10 = (rnd() % 2000 - 1000) / 1000.0f;
+    rdr->_rg_a11 = (rnd() % 2000 - 1000) / 1000.0f;
+    rdr->_rg_a12 = (jfloat)(rnd() % 2000 - 1000);
+    rdr->_rg_a00a00 = rdr->_rg_a00 * rdr->_rg_a00;
+    rdr->_rg_a10a10 = rdr->_rg_a10 * rdr->_rg_a10;
+    rdr->_rg_a00a10 = rdr->_rg_a00 * rdr->_rg_a10;
+    rdr->_rg_cx = (jfloat)(rnd() % 200 - 100);
+    rdr->_rg_cy = (jfloat)(rnd() % 200 - 100);
+    rdr->_rg_fx = rdr->_rg_cx + (rnd() % 100 - 50);
+    rdr->_rg_fy = rdr->_rg_cy + (rnd() % 100 - 50);
+    rdr->_rg_r = (jfloat)(rnd() % 500 + 100);
+    rdr->_rg_rsq = rdr->_rg_r * rdr->_rg_r;
+}
+
+typedef void BlitFunc(Renderer* rdr, jint height);
+
+typedef struct {
+    const char* name;
+    BlitFunc* func;
+    jboolean paint;
+    jboolean coverage;
+} BlitCase;
+
+static const BlitCase blitCases[] = {
+    { "blitSrcOver8888_pre",       blitSrcOver8888_pre,       XNI_FALSE, XNI_TRUE },
+    { "blitSrcOverMask8888_pre",   blitSrcOverMask8888_pre,   XNI_FALSE, XNI_FALSE },
+    { "blitPTSrcOver8888_pre",     blitPTSrcOver8888_pre,     XNI_TRUE,  XNI_TRUE },
+    { "blitPTSrcOverMask8888_pre", blitPTSrcOverMask8888_pre, XNI_TRUE,  XNI_FALSE },
+};
+
+/*
+ * Runs one blit on random input at the scalar level and at level, with the
+ * same input, and compares the destinations.
+ */
+static jboolean
+checkBlit(const BlitCase* bc, jint level, jint width) {
+    static jint src[WIDTH * HEIGHT];
+    static jint expected[WIDTH * HEIGHT];
+    static jint savedAA[WIDTH + 1];
+    Renderer rdr;
+    jint height = bc->coverage ? 1 : HEIGHT;
+    unsigned int colorSeed;
+
+    randomPixels(src, WIDTH * HEIGHT);
+    randomPixels(paint, WIDTH * HEIGHT);
+    randomMask(WIDTH * HEIGHT);
+    randomCoverage(width);
+    memcpy(savedAA, rowAA, sizeof(rowAA));
+    colorSeed = seed;
+
+    initRenderer(&rdr, SIMD_LEVEL_SCALAR, width);
+    randomColor(&rdr);
+    memcpy(dst, src, sizeof(dst));
+    bc->func(&rdr, height);
+    memcpy(expected, dst, sizeof(dst));
+
+    memcpy(rowAA, savedAA, sizeof(rowAA));
+    seed = colorSeed;
+    initRenderer(&rdr, level, width);
+    randomColor(&rdr);
+    memcpy(dst, src, sizeof(dst));
+    bc->func(&rdr, height);
+
+    if (memcmp(expected, dst, sizeof(dst)) != 0) {
+        printf("FAILED: %s at %s, width %d\n", bc->name, levelNames[level], width);
+        return XNI_FALSE;
+    }
+    return XNI_TRUE;
+}
+
+static jboolean
+checkGradient(jboolean radial, jint level, jint width, jint height) {
+    static jint expected[WIDTH * HEIGHT];
+    Renderer rdr;
+    unsigned int gradientSeed = seed;
+
+    initRenderer(&rdr, SIMD_LEVEL_SCALAR, width);
+    randomGradient(&rdr);
+    memset(paint, 0, sizeof(paint));
+    (radial ? genRadialGradientPaint : genLinearGradientPaint)(&rdr, height);
+    memcpy(expected, paint, sizeof(paint));
+
+    seed = gradientSeed;
+    initRenderer(&rdr, level, width);
+    randomGradient(&rdr);
+    memset(paint, 0, sizeof(paint));
+    (radial ? genRadialGradientPaint : genLinearGradientPaint)(&rdr, height);
+
+    if (memcmp(expected, paint, sizeof(paint)) != 0) {
+        printf("FAILED: %s gradient at %s, width %d, height %d\n",
+               radial ? "radial" : "linear", levelNames[level], width, height);
+        return XNI_FALSE;
+    }
+    return XNI_TRUE;
+}
+
+#ifdef PISCES_USE_SSE2
+
+// copy of interp() and interpolate4points() in PiscesPaint.c
+static jint
+interp(jint x0, jint x1, jint frac) {
+    return ((x0 << 16) + (x1 - x0) * frac + 0x8000) >> 16;
+}
+
+static jint
+interpolate4points(jint p00, jint p01, jint p10, jint p11,
+                   jint hfrac, jint vfrac) {
+    jint result = 0;
+    jint shift;
+    for (shift = 0; shift < 32; shift += 8) {
+        jint c0 = interp((p00 >> shift) & 0xff, (p01 >> shift) & 0xff, hfrac);
+        jint c1 = interp((p10 >> shift) & 0xff, (p11 >> shift) & 0xff, hfrac);
+        result |= interp(c0, c1, vfrac) << shift;
+    }
+    return result;
+}
+
+static jboolean
+checkInterpolate() {
+    static const jint fracs[] = { 0, 1, 0x7fff, 0x8000, 0x8001, 0xfffe, 0xffff };
+    jint i;
+    for (i = 0; i < 1000000; i++) {
+        jint p00 = rnd() ^ (rnd() << 16), p01 = rnd() ^ (rnd() << 16);
+        jint p10 = rnd() ^ (rnd() << 16), p11 = rnd() ^ (rnd() << 16);
+        jint hfrac = (i & 1) ? fracs[rnd() % 7] : rnd() & 0xffff;
+        jint vfrac = (i & 2) ? fracs[rnd() % 7] : rnd() & 0xffff;
+        if (interpolate4points(p00, p01, p10, p11, hfrac, vfrac) !=
+            simd_interpolate4points(p00, p01, p10, p11, hfrac, vfrac))
+        {
+            printf("FAILED: interpolate4points(%08x, %08x, %08x, %08x, %d, %d)\n",
+                   p00, p01, p10, p11, hfrac, vfrac);
+            return XNI_FALSE;
+        }
+    }
+    return XNI_TRUE;
+}
+
+#endif /* PISCES_USE_SSE2 */
+
+static double
+now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void
+benchmark(jint maxLevel) {
+    Renderer rdr;
+    jint level, c, i;
+    for (c = 0; c < 6; c++) {
+        const char* name = (c < 4) ? blitCases[c].name :
+            (c == 4) ? "genLinearGradientPaint" : "genRadialGradientPaint";
+        printf("%-28s", name);
+        for (level = SIMD_LEVEL_SCALAR; level <= maxLevel; level++) {
+            double t0, t1;
+            seed = 1;
+            randomPixels(dst, WIDTH * HEIGHT);
+            randomPixels(paint, WIDTH * HEIGHT);
+            randomMask(WIDTH * HEIGHT);
+            initRenderer(&rdr, level, WIDTH);
+            randomColor(&rdr);
+            randomGradient(&rdr);
+            t0 = now();
+            for (i = 0; i < ITERATIONS; i++) {
+                if (c < 4) {
+                    if (blitCases[c].coverage) {
+                        randomCoverage(WIDTH);
+                    }
+                    blitCases[c].func(&rdr, blitCases[c].coverage ? 1 : HEIGHT);
+                } else if (c == 4) {
+                    genLinearGradientPaint(&rdr, HEIGHT);
+                } else {
+                    genRadialGradientPaint(&rdr, HEIGHT);
+                }
+            }
+            t1 = now();
+            printf("  %s %7.3f ms", levelNames[level], (t1 - t0) / ITERATIONS);
+        }
+        printf("\n");
+    }
+}
+
+int
+main() {
+    static const jint widths[] = { 1, 3, 4, 7, 8, 15, 17, 255, 256, 257, 1000, WIDTH };
+    jint maxLevel = simd_getLevel();
+    jint level, w, c, i, h;
+    jboolean ok = XNI_TRUE;
+
+    for (i = 0; i <= MAX_COVERAGE; i++) {
+        alphaMap[i] = (jbyte)(i * 255 / MAX_COVERAGE);
+    }
+    for (i = 0; i < GRADIENT_MAP_SIZE; i++) {
+        colors[i] = randomPremultiplied();
+    }
+
+    for (level = SIMD_LEVEL_SSE2; level <= maxLevel; level++) {
+        for (w = 0; w < (jint)(sizeof(widths) / sizeof(widths[0])); w++) {
+            for (i = 0; i < 20; i++) {
+                for (c = 0; c < 4; c++) {
+                    ok &= checkBlit(&blitCases[c], level, widths[w]);
+                }
+                for (h = 1; h <= HEIGHT; h++) {
+                    ok &= checkGradient(XNI_FALSE, level, widths[w], h);
+                    ok &= checkGradient(XNI_TRUE, level, widths[w], h);
+                }
+            }
+        }
+    }
+#ifdef PISCES_USE_SSE2
+    ok &= checkInterpolate();
+#endif
+    printf("%s up to level %s\n", ok ? "PASSED" : "FAILED", levelNames[maxLevel]);
+
+    benchmark(maxLevel);
+    return ok ? 0 : 1;
+}
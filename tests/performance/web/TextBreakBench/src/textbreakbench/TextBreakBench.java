@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package textbreakbench;
+
+import java.util.Arrays;
+
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures WebView text segmentation over a large document.
+ * <p>
+ * The line break pass changes the width of the document on each iteration,
+ * so that every paragraph is broken into lines again, and forces a
+ * synchronous layout. The caret pass moves a collapsed selection over the
+ * document by words and by characters, which walks the word and grapheme
+ * cluster break iterators.
+ * <p>
+ * The paragraphs mix Latin, Thai, CJK and combining mark samples, whose
+ * break rules differ, and are long enough that the line breaker needs
+ * many boundaries per paragraph.
+ * <p>
+ * Usage: {@code java textbreakbench.TextBreakBench [paragraphs] [iterations]}
+ */
+public class TextBreakBench extends Application {
+
+    private static final String[] SAMPLES = {
+        "Line breaking in long documents needs a boundary for every word, "
+            + "hyphen-separated compound and punctuation mark (like this one). ",
+        "การตัดคำภาษาไทยต้องใช้พจนานุกรมเพราะไม่มีช่องว่างระหว่างคำ ",
+        "日本語の文章は文字ごとに改行できますが、句読点の前では改行しません。",
+        "Café näive résumé with combining marks, "
+            + "and emoji 👨‍👩‍👧 clusters. "
+    };
+
+    private static int paragraphs = 2000;
+    private static int iterations = 30;
+
+    private static String createDocument() {
+        StringBuilder sb = new StringBuilder();
+        sb.append("<html><head><style>body { font-family: sans-serif; ")
+          .append("margin: 0; }</style></head><body>");
+        for (int i = 0; i < paragraphs; i++) {
+            sb.append("<p>");
+            for (int j = 0; j < 8; j++) {
+                sb.append(SAMPLES[(i + j) % SAMPLES.length]);
+            }
+            sb.append("</p>");
+        }
+        return sb.append("</body></html>").toString();
+    }
+
+    private static double[] measure(Runnable pass) {
+        // Warm up the caches and the JIT.
+        for (int i = 0; i < 3; i++) {
+            pass.run();
+        }
+        double[] times = new double[iterations];
+        for (int i = 0; i < iterations; i++) {
+            long start = System.nanoTime();
+            pass.run();
+            times[i] = (System.nanoTime() - start) / 1e6;
+        }
+        Arrays.sort(times);
+        return times;
+    }
+
+    private static void report(String name, double[] times) {
+        double total = Arrays.stream(times).sum();
+        System.out.printf("  %s: median %.2f ms, min %.2f ms, max %.2f ms, mean %.2f ms%n",
+                name, times[times.length / 2], times[0], times[times.length - 1],
+                total / times.length);
+    }
+
+    private void run(WebEngine engine) {
+        int[] width = { 0 };
+        double[] lineBreak = measure(() -> {
+            // A new width per pass, so no line box can be reused.
+            width[0] = (width[0] + 37) % 400;
+            engine.executeScript("document.body.style.width = '"
+                    + (400 + width[0]) + "px'; document.body.offsetHeight");
+        });
+
+        double[] words = measure(() -> engine.executeScript(
+                "var s = window.getSelection(); "
+                + "s.collapse(document.body, 0); "
+                + "for (var i = 0; i < 2000; i++) s.modify('move', 'forward', 'word');"));
+
+        double[] characters = measure(() -> engine.executeScript(
+                "var s = window.getSelection(); "
+                + "s.collapse(document.body, 0); "
+                + "for (var i = 0; i < 5000; i++) s.modify('move', 'forward', 'character');"));
+
+        System.out.printf("TextBreakBench: %d paragraphs, %d iterations%n", paragraphs, iterations);
+        report("line breaking", lineBreak);
+        report("2000 word moves", words);
+        report("5000 character moves", characters);
+        Platform.exit();
+    }
+
+    @Override
+    public void start(Stage stage) {
+        WebView view = new WebView();
+        WebEngine engine = view.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED) {
+                Platform.runLater(() -> run(engine));
+            } else if (n == Worker.State.FAILED) {
+                System.err.println("TextBreakBench: failed to load the document");
+                Platform.exit();
+            }
+        });
+        stage.setScene(new Scene(view, 1024, 768));
+        stage.show();
+        engine.loadContent(createDocument());
+    }
+
+    public static void main(String[] args) {
+        if (args.length > 0) {
+            paragraphs = Integer.parseInt(args[0]);
+        }
+        if (args.length > 1) {
+            iterations = Integer.parseInt(args[1]);
+        }
+        launch(args);
+    }
+}
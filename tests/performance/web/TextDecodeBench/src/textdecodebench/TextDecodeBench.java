@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package textdecodebench;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.charset.Charset;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.beans.value.ChangeListener;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures the throughput of WebView's text decoders per encoding.
+ * <p>
+ * For each encoding a large document is written to a temporary file in
+ * that encoding and loaded repeatedly. The document is a {@code plaintext}
+ * element, so the parser does little more than append the decoded text and
+ * the load time is dominated by decoding. The reported throughput is in
+ * megabytes of encoded input per second.
+ * <p>
+ * Usage: {@code java textdecodebench.TextDecodeBench [kilobytes] [iterations]}
+ */
+public class TextDecodeBench extends Application {
+
+    private static final String ASCII =
+        "The quick brown fox jumps over the lazy dog 0123456789.\n";
+    private static final String LATIN =
+        "Größe, Café, Ærø, Señor, Ça va? Déjà vu à la carte.\n";
+    private static final String CYRILLIC =
+        "Съешь же ещё этих мягких французских булок, да выпей чаю.\n";
+    private static final String CJK =
+        "日本語の文章と中文的句子，한국어 문장도 포함합니다。\n";
+
+    private static final Object[][] CASES = {
+        // encoding, text
+        { "UTF-8", ASCII },
+        { "UTF-8", LATIN + CYRILLIC + CJK },
+        { "ISO-8859-1", ASCII + LATIN },
+        { "windows-1252", ASCII + LATIN },
+        { "KOI8-R", ASCII + CYRILLIC },
+        { "UTF-16LE", ASCII + LATIN + CJK },
+        { "Shift_JIS", ASCII + "日本語の文章を読み込みます。\n" },
+        { "EUC-KR", ASCII + "한국어 문장을 읽습니다.\n" },
+        { "GB18030", ASCII + "中文的句子在这里。\n" },
+    };
+
+    private static int kilobytes = 4096;
+    private static int iterations = 10;
+
+    private final List<String> results = new ArrayList<>();
+    private final List<File> files = new ArrayList<>();
+    private WebEngine engine;
+    private int currentCase = -1;
+    private int currentIteration;
+    private long start;
+    private long[] fileSizes;
+    private double[] times;
+
+    private static File createDocument(String encoding, String text) throws IOException {
+        Charset cs = Charset.forName(encoding);
+        StringBuilder sb = new StringBuilder();
+        // UTF-16 is recognized by its byte order mark, the other
+        // encodings by the meta element.
+        if (encoding.startsWith("UTF-16")) {
+            sb.append('\uFEFF');
+        }
+        sb.append("<html><head><meta charset=\"").append(encoding)
+          .append("\"></head><body><plaintext>");
+        while (sb.length() * 2 < kilobytes * 1024L) {
+            sb.append(text);
+        }
+        File file = File.createTempFile("TextDecodeBench", ".html");
+        file.deleteOnExit();
+        Files.write(file.toPath(), sb.toString().getBytes(cs));
+        return file;
+    }
+
+    private void next() {
+        if (currentCase >= 0) {
+            times[currentIteration++] = (System.nanoTime() - start) / 1e6;
+        }
+        if (currentCase < 0 || currentIteration == iterations + 1) {
+            if (currentCase >= 0) {
+                report();
+            }
+            currentCase++;
+            currentIteration = 0;
+            times = new double[iterations + 1];
+            if (currentCase == CASES.length) {
+                System.out.printf("TextDecodeBench: %d KB per document, %d iterations%n",
+                        kilobytes, iterations);
+                results.forEach(System.out::println);
+                Platform.exit();
+                return;
+            }
+        }
+        start = System.nanoTime();
+        engine.load(files.get(currentCase).toURI().toString());
+    }
+
+    private void report() {
+        // The first load is a warm up.
+        double[] t = Arrays.copyOfRange(times, 1, times.length);
+        Arrays.sort(t);
+        double median = t[t.length / 2];
+        double mb = fileSizes[currentCase] / (1024.0 * 1024.0);
+        results.add(String.format("  %-12s %-14s median %8.2f ms, %8.2f MB/s",
+                CASES[currentCase][0],
+                CASES[currentCase][1] == ASCII ? "(ASCII only)" : "(mixed)",
+                median, mb / (median / 1000)));
+    }
+
+    @Override
+    public void start(Stage stage) throws IOException {
+        fileSizes = new long[CASES.length];
+        for (int i = 0; i < CASES.length; i++) {
+            File file = createDocument((String) CASES[i][0], (String) CASES[i][1]);
+            files.add(file);
+            fileSizes[i] = file.length();
+        }
+
+        WebView view = new WebView();
+        engine = view.getEngine();
+        ChangeListener<Worker.State> listener = (ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED) {
+                Platform.runLater(this::next);
+            } else if (n == Worker.State.FAILED) {
+                System.err.println("TextDecodeBench: failed to load " + files.get(currentCase));
+                Platform.exit();
+            }
+        };
+        engine.getLoadWorker().stateProperty().addListener(listener);
+        stage.setScene(new Scene(view, 800, 600));
+        stage.show();
+        next();
+    }
+
+    public static void main(String[] args) {
+        if (args.length > 0) {
+            kilobytes = Integer.parseInt(args[0]);
+        }
+        if (args.length > 1) {
+            iterations = Integer.parseInt(args[1]);
+        }
+        launch(args);
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package textlayoutbench;
+
+import java.util.Arrays;
+
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures WebView text layout over a large document.
+ * <p>
+ * The document mixes Latin, Arabic, Hebrew and CJK paragraphs and enables
+ * kerning and ligatures, so that all text goes through the complex text
+ * path, which fetches the glyph runs and font metrics from Java. Each
+ * iteration changes the font size of the document, which creates new fonts
+ * and shapes all text again, and then forces a synchronous layout.
+ * <p>
+ * For an A/B comparison run the benchmark against two builds of the
+ * javafx.web module and compare the reported times. The number of calls into
+ * the font code can be logged by enabling the
+ * {@code com.sun.webkit.perf.WCFontPerfLogger} logger at FINE level.
+ * <p>
+ * Usage: {@code java textlayoutbench.TextLayoutBench [paragraphs] [iterations]}
+ */
+public class TextLayoutBench extends Application {
+
+    private static final String[] SAMPLES = {
+        "The quick brown fox jumps over the lazy dog. Office affluent waffles "
+            + "find efficient ligatures in typography; AV WA To kerning pairs. ",
+        "السلام عليكم ورحمة الله وبركاته 123 mixed text. ",
+        "שלום עולם, זהו טקסט לדוגמה. ",
+        "文字列のレイアウトを測定します。中文排版测试。 "
+    };
+
+    private static int paragraphs = 2000;
+    private static int iterations = 50;
+
+    private static String createDocument() {
+        StringBuilder sb = new StringBuilder();
+        sb.append("<html><head><style>body { font-family: sans-serif; ")
+          .append("text-rendering: optimizeLegibility; ")
+          .append("font-feature-settings: 'kern' 1, 'liga' 1; }</style></head><body>");
+        for (int i = 0; i < paragraphs; i++) {
+            sb.append("<p>");
+            for (int j = 0; j < 4; j++) {
+                sb.append(SAMPLES[(i + j) % SAMPLES.length]);
+            }
+            sb.append("<b>").append(SAMPLES[i % SAMPLES.length]).append("</b>");
+            sb.append("<i>").append(SAMPLES[(i + 1) % SAMPLES.length]).append("</i>");
+            sb.append("</p>");
+        }
+        return sb.append("</body></html>").toString();
+    }
+
+    private void run(WebEngine engine) {
+        // Warm up the fonts and the JIT.
+        for (int i = 0; i < 5; i++) {
+            layout(engine, 13 + i);
+        }
+
+        double[] times = new double[iterations];
+        for (int i = 0; i < iterations; i++) {
+            // A new size per iteration, so the layout never hits the fonts
+            // or widths cached by earlier iterations.
+            float size = 12 + i * 0.25f + 0.125f;
+            long start = System.nanoTime();
+            layout(engine, size);
+            times[i] = (System.nanoTime() - start) / 1e6;
+        }
+
+        Arrays.sort(times);
+        double total = Arrays.stream(times).sum();
+        System.out.printf("TextLayoutBench: %d paragraphs, %d iterations%n", paragraphs, iterations);
+        System.out.printf("  median %.2f ms, min %.2f ms, max %.2f ms, mean %.2f ms per layout%n",
+                times[iterations / 2], times[0], times[iterations - 1], total / iterations);
+        Platform.exit();
+    }
+
+    private static void layout(WebEngine engine, float size) {
+        engine.executeScript("document.body.style.fontSize = '" + size + "px'; "
+                + "document.body.offsetHeight");
+    }
+
+    @Override
+    public void start(Stage stage) {
+        WebView view = new WebView();
+        WebEngine engine = view.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED) {
+                Platform.runLater(() -> run(engine));
+            } else if (n == Worker.State.FAILED) {
+                System.err.println("TextLayoutBench: failed to load the document");
+                Platform.exit();
+            }
+        });
+        stage.setScene(new Scene(view, 1024, 768));
+        stage.show();
+        engine.loadContent(createDocument());
+    }
+
+    public static void main(String[] args) {
+        if (args.length > 0) {
+            paragraphs = Integer.parseInt(args[0]);
+        }
+        if (args.length > 1) {
+            iterations = Integer.parseInt(args[1]);
+        }
+        launch(args);
+    }
+}